@@ -1,6 +1,6 @@
 // control.cpp
 
-#include "control.h"
+#include "Control.h"
 
 void Control::begin() {
     // Setup Row Pins (OUTPUT)
@@ -24,6 +24,13 @@ void Control::begin() {
 
 uint16_t Control::getPressedKeysBitmap() {
     uint16_t currentBitmap = 0;
+
+    // --- SCAN TIMING ---
+    unsigned long now = micros();
+    if (lastScanMicros != 0 && (now - lastScanMicros) > maxScanIntervalUs) {
+        maxScanIntervalUs = now - lastScanMicros;
+    }
+    lastScanMicros = now;
     
     // --- SCAN THE 4x4 MATRIX AND BUILD BITMAP (same as before) ---
     for (int row = 0; row < NUM_ROWS; row++) {
@@ -61,4 +68,10 @@ uint16_t Control::getPressedKeysBitmap() {
     previousBitmap = currentBitmap;
     
     return currentStableBitmap; // Return the stable, debounced bitmap
+}
+
+unsigned long Control::takeMaxScanInterval() {
+    unsigned long worst = maxScanIntervalUs;
+    maxScanIntervalUs = 0;
+    return worst;
 }
\ No newline at end of file
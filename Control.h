@@ -24,9 +24,17 @@ private:
     // Set to 10ms—a reliable value for mechanical switches
     const unsigned long DEBOUNCE_DELAY = 10; 
 
+    // Scan timing (worst interval between consecutive scans)
+    unsigned long lastScanMicros = 0;
+    volatile unsigned long maxScanIntervalUs = 0;
+
 public:
     void begin();
     uint16_t getPressedKeysBitmap();
+    unsigned long takeMaxScanInterval(); // Returns and resets the worst interval
 };
 
+// The keypad instance lives in the main sketch
+extern Control synthControl;
+
 #endif
\ No newline at end of file
@@ -1,48 +1,158 @@
 // main.ino
 
-#include "control.h"
-#include "synth.h"
+#include "Control.h"
+#include "Synth.h"
+#include "MidiInput.h"
+#include "OscServer.h"
+#include "Preset.h"
+#include "Footprint.h"
+#include "EventLog.h"
 #include "UI.h" 
 
+// --- Input Scan Task Configuration ---
+// Keys and MIDI are read by their own timer-driven task on Core 0. It runs above
+// loop() (priority 1), so a slow HTTP client can only delay the Web UI.
+#define INPUT_SCAN_PERIOD_MS 1
+#define INPUT_SCAN_PRIORITY 3
+#define TIMING_REPORT_INTERVAL_MS 10000
+
+// --- Task Stacks (bytes) ---
+// Check /footprint (stack_free_min) under load before shrinking these
+#define AUDIO_TASK_STACK_SIZE 10000
+#define INPUT_SCAN_STACK_SIZE 4096
+#define NETWORK_START_STACK_SIZE 6144
+
 // Global instances
 Control synthControl;
+MidiInput midiInput;
+OscServer oscServer;
+PresetBank presetBank;
+FootprintMonitor footprint;
+EventLog eventLog;
+TaskHandle_t audioTaskHandle = NULL;
+TaskHandle_t inputScanTaskHandle = NULL;
 // The Synth instance is globally defined in synth.cpp
 
+unsigned long lastTimingReport = 0;
+unsigned long lastFootprintReport = 0;
+
+// Set once the Wi-Fi AP, Web UI and OSC endpoint are up
+volatile bool networkReady = false;
+
+void inputScanTask(void *parameter) {
+    TickType_t lastWake = xTaskGetTickCount();
+
+    while (true) {
+        // Fixed-rate schedule: wake exactly every INPUT_SCAN_PERIOD_MS ticks
+        vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(INPUT_SCAN_PERIOD_MS));
+
+        // 1. Read Keypad state and feed it to the Synth Engine (Note ON/OFF events)
+        synth.setKeyBitmap(synthControl.getPressedKeysBitmap());
+
+        // 2. Feed any received MIDI bytes to the Synth Engine
+        midiInput.poll();
+
+        // 3. Feed any received OSC packets to the Synth Engine
+        if (networkReady) {
+            oscServer.poll();
+        }
+    }
+}
+
+// Wi-Fi bring-up takes far longer than everything else at boot. It runs here,
+// on Core 0 below the input scan, so keys and MIDI already play meanwhile.
+void networkStartTask(void *parameter) {
+    uiSetup();
+    oscServer.begin();
+    networkReady = true;
+
+    // micros() counts from application start
+    Serial.printf("Boot: first audio block at %lu ms, network ready at %lu ms.\n",
+                  (unsigned long)(synth.firstBlockMicros / 1000), (unsigned long)(micros() / 1000));
+    vTaskDelete(NULL);
+}
+
 void setup() {
     Serial.begin(115200); 
 
     // 1. Initialize Control (Keypad Pins)
     synthControl.begin();
     
-    // 2. Initialize Synth Engine (I2S, Sine Table, voices)
+    // 2. Initialize Synth Engine (I2S, voices; lookup tables are constant)
     synth.begin();
-    
-    // 3. Start the Web UI Server
-    uiSetup();
 
-    // 4. Create the audio task and pin it to Core 1
+    // 3. Create the audio task and pin it to Core 1 before anything slow
     xTaskCreatePinnedToCore(
         Synth::audioTask,      
         "AudioTask",    
-        10000,          
+        AUDIO_TASK_STACK_SIZE,
         NULL,           
         2,              // Priority 2
-        NULL,           
+        &audioTaskHandle,
         1               // Core 1
     );
+
+    // 3a. Restore the preset bank from NVS (the recall is picked up by the running audio task)
+    presetBank.begin();
+
+    // 3b. Start the serial MIDI input
+    midiInput.begin();
+
+    // 4. Create the input scan task on Core 0, above the Web UI loop
+    xTaskCreatePinnedToCore(
+        inputScanTask,
+        "InputScan",
+        INPUT_SCAN_STACK_SIZE,
+        NULL,
+        INPUT_SCAN_PRIORITY,
+        &inputScanTaskHandle,
+        0               // Core 0
+    );
+
+    // 5. Bring up Wi-Fi, the Web UI and OSC in the background
+    xTaskCreatePinnedToCore(
+        networkStartTask,
+        "NetworkStart",
+        NETWORK_START_STACK_SIZE,
+        NULL,
+        1,              // Same as loop()
+        NULL,
+        0               // Core 0
+    );
+    
+    // setup() runs on the loop task, which also serves the Web UI
+    footprint.registerTask("AudioTask", audioTaskHandle, AUDIO_TASK_STACK_SIZE);
+    footprint.registerTask("InputScan", inputScanTaskHandle, INPUT_SCAN_STACK_SIZE);
+    footprint.registerTask("loopTask", NULL, getArduinoLoopTaskStackSize());
     
-    Serial.println("System Boot Complete. Polyphonic Synth Ready.");
+    Serial.printf("System Boot Complete. Polyphonic Synth Ready after %lu ms (Wi-Fi starting).\n",
+                  (unsigned long)(micros() / 1000));
 }
 
 void loop() {
-    // 1. Read Keypad state
-    uint16_t keyStateBitmap = synthControl.getPressedKeysBitmap(); 
+    // Handle Web Client Requests (Runs on Core 0, lowest priority)
+    if (networkReady) {
+        uiLoop();
+    }
 
-    // 2. Feed the state to the Synth Engine (triggers Note ON/OFF events)
-    synth.setKeyBitmap(keyStateBitmap);
+    // Periodic worst-case timing report (keys/MIDI are scanned by inputScanTask)
+    if (millis() - lastTimingReport >= TIMING_REPORT_INTERVAL_MS) {
+        lastTimingReport = millis();
+        Serial.printf("Timing: scan interval max %lu us, event->audio max %lu us, OSC %lu packets (%lu rejected, %lu late)\n",
+                      synthControl.takeMaxScanInterval(), (unsigned long)synth.takeMaxEventLatency(),
+                      (unsigned long)oscServer.packetsReceived, (unsigned long)oscServer.packetsRejected,
+                      (unsigned long)oscServer.lateMessages);
+        uint32_t load = synth.takeAudioLoad();
+        Serial.printf("Audio: load %lu.%lu%%, wake max %lu us, %lu idle periods\n",
+                      (unsigned long)(load / 10), (unsigned long)(load % 10),
+                      (unsigned long)synth.takeMaxWakeLatency(), (unsigned long)synth.idleEntries);
+    }
 
-    // 3. Handle Web Client Requests (Runs on Core 0)
-    uiLoop();
+    // Periodic stack / heap report (also served on /footprint)
+    if (millis() - lastFootprintReport >= FOOTPRINT_REPORT_INTERVAL_MS) {
+        lastFootprintReport = millis();
+        footprint.log();
+    }
     
     // Minimal delay to throttle the loop speed
     delay(1); 
@@ -0,0 +1,316 @@
+// eventlog.cpp
+
+#include "EventLog.h"
+#include <stddef.h>
+#include <string.h>
+
+// tools/eventlog.py reads the downloaded blob with this layout
+static_assert(sizeof(EventLogEntry) == 16, "EventLogEntry layout changed");
+static_assert(sizeof(EventLogHeader) == 32, "EventLogHeader layout changed");
+static_assert(offsetof(EventLogSegment, start) == 24, "EventLogSegment layout changed");
+
+// Nibble table: 16 words instead of 256, a few hundred cycles per DMA block
+static const uint32_t CRC32_NIBBLE[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+uint32_t crc32Update(uint32_t crc, const void* data, size_t length) {
+    const uint8_t* p = (const uint8_t*)data;
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= p[i];
+        crc = (crc >> 4) ^ CRC32_NIBBLE[crc & 0x0F];
+        crc = (crc >> 4) ^ CRC32_NIBBLE[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+// -------------------------------------------------------------------
+// --- CONTROL (CORE 0) ---
+// -------------------------------------------------------------------
+
+bool EventLog::startRecording() {
+    if (state != EVENT_LOG_IDLE) return false;
+
+    // The audio core takes the first snapshot at its next block
+    stopRequested = false;
+    state = EVENT_LOG_RECORD_REQUESTED;
+    synth.wakeAudio();
+    return true;
+}
+
+bool EventLog::startReplay() {
+    if (state != EVENT_LOG_IDLE || !isValid()) return false;
+
+    stopRequested = false;
+    state = EVENT_LOG_REPLAY_REQUESTED;
+    synth.wakeAudio();
+    return true;
+}
+
+bool EventLog::stop(uint32_t timeoutMs) {
+    if (state == EVENT_LOG_IDLE) return true;
+
+    stopRequested = true;
+    synth.wakeAudio();
+
+    // The audio core finishes at its next block boundary
+    uint32_t start = millis();
+    while (state != EVENT_LOG_IDLE && millis() - start < timeoutMs) {
+        vTaskDelay(1);
+    }
+    return state == EVENT_LOG_IDLE;
+}
+
+size_t EventLog::size() const {
+    return (data.header.magic == EVENT_LOG_MAGIC) ? sizeof(EventLogData) : 0;
+}
+
+// Anything applyEvent() indexes with must be in range
+static bool eventIsValid(uint8_t type, uint8_t note, int keyIndex, int bend, float paramValue) {
+    if (type > EVENT_PARAM || keyIndex < -1 || keyIndex >= TOTAL_KEYS) return false;
+    if (type == EVENT_PARAM && !paramInRange(note, paramValue)) return false;
+    if ((type == EVENT_NOTE_ON || type == EVENT_NOTE_OFF) && note >= NUM_MIDI_NOTES) return false;
+    return bend >= -8192 && bend <= 8191;
+}
+
+bool EventLog::isValid() const {
+    const EventLogHeader& h = data.header;
+    if (h.magic != EVENT_LOG_MAGIC || h.version != EVENT_LOG_VERSION) return false;
+    if (h.entrySize != sizeof(EventLogEntry) || h.segmentSize != sizeof(EventLogSegment)) return false;
+    if (h.segmentCount < 1 || h.segmentCount > EVENT_LOG_SEGMENTS || h.firstSegment >= EVENT_LOG_SEGMENTS) return false;
+    if (h.entryCount > EVENT_LOG_CAPACITY) return false;
+
+    uint32_t entries = 0, blocks = 0;
+    uint32_t nextEntry = segment(0).firstEntry;
+    if (nextEntry >= EVENT_LOG_CAPACITY) return false;
+
+    for (int k = 0; k < h.segmentCount; k++) {
+        const EventLogSegment& seg = segment(k);
+        const EngineSnapshot& snapshot = seg.start;
+
+        // Segments follow each other in the ring and on the sample clock
+        if (seg.firstEntry != nextEntry || seg.entryCount > EVENT_LOG_CAPACITY - entries) return false;
+        if (seg.blockCount > EVENT_LOG_SEGMENT_BLOCKS) return false;
+        uint32_t end = seg.sample + seg.blockCount * DMA_BUF_LEN;
+        if (k + 1 < h.segmentCount && segment(k + 1).sample != end) return false;
+
+        if (!presetIsValid(snapshot.sound)) return false;
+        if (snapshot.scheduledCount < 0 || snapshot.scheduledCount > SCHEDULED_EVENT_SLOTS) return false;
+        for (int i = 0; i < snapshot.scheduledCount; i++) {
+            const NoteEvent& e = snapshot.scheduled[i].event;
+            if (!eventIsValid(e.type, e.note, e.keyIndex, e.bend, e.paramValue)) return false;
+        }
+
+        // Entries in sample order, inside the segment's blocks (the last
+        // segment may end with entries of a block cut off by truncation)
+        bool last = (k + 1 == h.segmentCount);
+        uint32_t lastSample = seg.sample;
+        for (uint32_t i = 0; i < seg.entryCount; i++) {
+            const EventLogEntry& e = data.entries[(seg.firstEntry + i) % EVENT_LOG_CAPACITY];
+            if ((int32_t)(e.sample - lastSample) < 0 || (!last && (int32_t)(e.sample - end) >= 0)) return false;
+            lastSample = e.sample;
+
+            switch (e.kind) {
+                case LOG_EVENT:
+                    if (!eventIsValid(e.type, e.note, e.keyIndex, e.bend, e.paramValue)) return false;
+                    break;
+                case LOG_PARAM:
+                    if (!paramInRange(e.note, e.paramValue)) return false;
+                    break;
+                default:
+                    return false;
+            }
+        }
+
+        entries += seg.entryCount;
+        blocks += seg.blockCount;
+        nextEntry = (seg.firstEntry + seg.entryCount) % EVENT_LOG_CAPACITY;
+    }
+    return entries == h.entryCount && blocks == h.blockCount;
+}
+
+bool EventLog::beginUpload() {
+    if (state != EVENT_LOG_IDLE) return false;
+    uploadLength = 0;
+    data.header.magic = 0;
+    return true;
+}
+
+bool EventLog::writeUpload(const uint8_t* bytes, size_t length) {
+    if (state != EVENT_LOG_IDLE || length > sizeof(EventLogData) - uploadLength) return false;
+    memcpy((uint8_t*)&data + uploadLength, bytes, length);
+    uploadLength += length;
+    return true;
+}
+
+bool EventLog::endUpload() {
+    // A truncated or inconsistent upload must never reach the audio core
+    if (uploadLength < sizeof(EventLogHeader) || uploadLength != size() || !isValid()) {
+        data.header.magic = 0;
+        return false;
+    }
+    return true;
+}
+
+int EventLog::format(char* json, size_t length) {
+    static const char* STATE_NAMES[] = { "idle", "starting", "recording", "starting", "replaying" };
+    const EventLogHeader& h = data.header;
+    bool idle = (state == EVENT_LOG_IDLE);
+    bool present = idle && h.magic == EVENT_LOG_MAGIC && h.segmentCount > 0;
+    uint32_t mean = replayBlocks ? (uint32_t)(totalBlockMicros / replayBlocks) : 0;
+    long mismatchSample = (present && firstMismatch >= 0 && firstMismatch < h.segmentCount)
+                              ? (long)segment(firstMismatch).sample : -1;
+
+    int written = snprintf(json, length,
+        "{\"state\": \"%s\", \"entries\": %lu, \"capacity\": %d, \"segments\": %d, \"blocks\": %lu, "
+        "\"start_sample\": %lu, \"wrapped\": %s, \"truncated\": %s, \"snapshot_us_max\": %lu, "
+        "\"replay_blocks\": %lu, \"replay_complete\": %s, \"replay_matched\": %s, \"segments_matched\": %d, "
+        "\"first_mismatch_sample\": %ld, \"block_us_max\": %lu, \"block_us_mean\": %lu, \"worst_block\": %lu}",
+        STATE_NAMES[state], (unsigned long)(present ? h.entryCount : 0), EVENT_LOG_CAPACITY,
+        present ? h.segmentCount : 0, (unsigned long)(present ? h.blockCount : 0),
+        (unsigned long)(present ? segment(0).sample : 0), (present && (h.flags & EVENT_LOG_WRAPPED)) ? "true" : "false",
+        (present && (h.flags & EVENT_LOG_TRUNCATED)) ? "true" : "false", (unsigned long)maxSnapshotMicros,
+        (unsigned long)replayBlocks, replayComplete ? "true" : "false", replayMatched ? "true" : "false",
+        segmentsMatched, mismatchSample, (unsigned long)maxBlockMicros, (unsigned long)mean,
+        (unsigned long)worstBlock);
+    return (written < 0 || (size_t)written >= length) ? -1 : written;
+}
+
+// -------------------------------------------------------------------
+// --- RECORD / REPLAY (AUDIO CORE) ---
+// -------------------------------------------------------------------
+
+void EventLog::beginRecording() {
+    EventLogHeader& h = data.header;
+    memset(&h, 0, sizeof(h));
+    h.magic = EVENT_LOG_MAGIC;
+    h.version = EVENT_LOG_VERSION;
+    h.entrySize = sizeof(EventLogEntry);
+    h.segmentSize = sizeof(EventLogSegment);
+    maxSnapshotMicros = 0;
+    state = EVENT_LOG_RECORDING;
+}
+
+bool EventLog::segmentDue() const {
+    const EventLogHeader& h = data.header;
+    if (h.segmentCount == 0) return true;
+
+    const EventLogSegment& last = segment(h.segmentCount - 1);
+    return last.blockCount >= EVENT_LOG_SEGMENT_BLOCKS || last.entryCount >= EVENT_LOG_SEGMENT_ENTRIES;
+}
+
+void EventLog::dropOldestSegment() {
+    EventLogHeader& h = data.header;
+    const EventLogSegment& oldest = segment(0);
+    h.entryCount -= oldest.entryCount;
+    h.blockCount -= oldest.blockCount;
+    h.firstSegment = (h.firstSegment + 1) % EVENT_LOG_SEGMENTS;
+    h.segmentCount--;
+    h.flags |= EVENT_LOG_WRAPPED;
+}
+
+EventLogSegment& EventLog::beginSegment(uint32_t sample, uint32_t flags) {
+    EventLogHeader& h = data.header;
+    if (h.segmentCount == EVENT_LOG_SEGMENTS) dropOldestSegment();
+
+    uint32_t firstEntry = 0;
+    if (h.segmentCount > 0) {
+        const EventLogSegment& last = segment(h.segmentCount - 1);
+        firstEntry = (last.firstEntry + last.entryCount) % EVENT_LOG_CAPACITY;
+    }
+
+    EventLogSegment& seg = data.segments[(h.firstSegment + h.segmentCount) % EVENT_LOG_SEGMENTS];
+    seg.sample = sample;
+    seg.firstEntry = firstEntry;
+    seg.entryCount = 0;
+    seg.blockCount = 0;
+    seg.outputCrc = 0;
+    seg.flags = flags;
+    h.segmentCount++;
+    return seg;
+}
+
+bool EventLog::append(const EventLogEntry& entry) {
+    EventLogHeader& h = data.header;
+    if (h.flags & EVENT_LOG_TRUNCATED) return false;
+
+    // Room comes from the oldest segments; the current one is never cut
+    while (h.entryCount == EVENT_LOG_CAPACITY && h.segmentCount > 1) {
+        dropOldestSegment();
+    }
+    if (h.entryCount == EVENT_LOG_CAPACITY) {
+        h.flags |= EVENT_LOG_TRUNCATED;
+        return false;
+    }
+
+    EventLogSegment& last = data.segments[(h.firstSegment + h.segmentCount - 1) % EVENT_LOG_SEGMENTS];
+    data.entries[(last.firstEntry + last.entryCount) % EVENT_LOG_CAPACITY] = entry;
+    last.entryCount++;
+    h.entryCount++;
+    return true;
+}
+
+void EventLog::addRecordedBlock(const int16_t* words, int count) {
+    EventLogHeader& h = data.header;
+    EventLogSegment& last = data.segments[(h.firstSegment + h.segmentCount - 1) % EVENT_LOG_SEGMENTS];
+    last.outputCrc = crc32Update(last.outputCrc, words, count * sizeof(int16_t));
+    last.blockCount++;
+    h.blockCount++;
+}
+
+void EventLog::finishRecording() {
+    stopRequested = false;
+    state = EVENT_LOG_IDLE;
+}
+
+void EventLog::beginReplay() {
+    replayCursor = 0;
+    replaySegment = 0;
+    replaySegmentBlocks = 0;
+    replayBlocks = 0;
+    replayCrc = 0;
+    segmentsMatched = 0;
+    firstMismatch = -1;
+    replayComplete = false;
+    replayMatched = false;
+    maxBlockMicros = 0;
+    worstBlock = 0;
+    totalBlockMicros = 0;
+    state = EVENT_LOG_REPLAYING;
+}
+
+void EventLog::nextReplaySegment() {
+    const EventLogSegment& seg = segment(replaySegment);
+    if (replaySegmentBlocks == seg.blockCount && replayCrc == seg.outputCrc) {
+        segmentsMatched++;
+    } else if (firstMismatch < 0) {
+        firstMismatch = replaySegment;
+    }
+    replaySegment++;
+    replaySegmentBlocks = 0;
+    replayCrc = 0;
+}
+
+void EventLog::addReplayedBlock(const int16_t* words, int count, uint32_t renderMicros) {
+    replayCrc = crc32Update(replayCrc, words, count * sizeof(int16_t));
+    replaySegmentBlocks++;
+    if (replayBlocks < EVENT_LOG_TIMING_BLOCKS) {
+        blockMicros[replayBlocks] = (uint16_t)min(renderMicros, (uint32_t)0xFFFF);
+    }
+    if (renderMicros > maxBlockMicros) {
+        maxBlockMicros = renderMicros;
+        worstBlock = replayBlocks;
+    }
+    totalBlockMicros += renderMicros;
+    replayBlocks++;
+}
+
+void EventLog::finishReplay() {
+    if (replaySegment < data.header.segmentCount) nextReplaySegment();
+    replayComplete = (replayBlocks == data.header.blockCount);
+    replayMatched = replayComplete && segmentsMatched == data.header.segmentCount;
+    stopRequested = false;
+    state = EVENT_LOG_IDLE;
+}
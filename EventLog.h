@@ -0,0 +1,191 @@
+// eventlog.h
+
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+#include <Arduino.h>
+#include "Synth.h"
+#include "Preset.h"
+
+// --- Event Log Format ---
+// Everything the audio core applied while recording, stamped with the sample
+// it took effect on, in a preallocated ring that keeps the most recent part
+// of a performance. The ring is cut into segments, each starting at a block
+// boundary with a snapshot of the engine (sound, tuning, voices, sequencer
+// and LFO state, timed events). When the ring is full the oldest segment is
+// dropped, so the log always starts at a snapshot: replay restores it and
+// feeds the entries back at their samples, rendering the same output words.
+// Starting a recording changes nothing in the engine.
+#define EVENT_LOG_MAGIC 0x474F4C45    // "ELOG"
+#define EVENT_LOG_VERSION 2
+#define EVENT_LOG_CAPACITY 2048       // entries, 16 bytes each
+#define EVENT_LOG_SEGMENTS 4          // snapshots kept, ~7 KB each
+#define EVENT_LOG_SEGMENT_ENTRIES (EVENT_LOG_CAPACITY / EVENT_LOG_SEGMENTS)
+#define EVENT_LOG_SEGMENT_BLOCKS 1024 // a quiet segment still ends after ~1.5 s
+#define EVENT_LOG_TIMING_BLOCKS (EVENT_LOG_SEGMENTS * EVENT_LOG_SEGMENT_BLOCKS) // per-block replay timings (~6 s)
+
+// Header flags
+#define EVENT_LOG_WRAPPED 0x01        // older segments were dropped to make room
+#define EVENT_LOG_TRUNCATED 0x02      // one segment outgrew the ring, recording stopped
+
+// Segment flags: what changed at its first block, before its first entry
+#define SEGMENT_RECALL 0x01           // a preset was recalled (the snapshot's sound)
+#define SEGMENT_RETUNE 0x02           // the tuning changed (the snapshot's tuning)
+
+enum EventLogKind : uint8_t {
+    LOG_EVENT,    // a NoteEvent handed to applyEvent
+    LOG_PARAM     // one entry of a staged parameter batch
+};
+
+// Entry flags
+#define LOG_FLAG_SCHEDULED 0x01       // LOG_EVENT applied from the schedule, mid-block
+#define LOG_FLAG_BATCH_END 0x02       // last LOG_PARAM of one batch
+
+struct EventLogEntry {
+    uint32_t sample;      // sampleClock at which it was applied
+    uint8_t kind;         // EventLogKind
+    uint8_t flags;
+    uint8_t type;         // LOG_EVENT: NoteEventType
+    uint8_t note;         // NoteEvent note / ParamId
+    uint8_t value;
+    int8_t keyIndex;
+    int16_t bend;
+    float paramValue;     // LOG_PARAM, and LOG_EVENT with EVENT_PARAM
+};
+
+// Engine state at a block boundary. Fixed layout without pointers, so a log
+// recorded on the ESP32 also replays in the Linux host build.
+struct EngineSnapshot {
+    Preset sound;                          // every parameter and coefficient
+    uint32_t tuning[NUM_MIDI_NOTES];
+    VoiceState voices[NUM_VOICES];
+    SequencerState sequencer;
+    ModState modulation;
+    ScheduledEvent scheduled[SCHEDULED_EVENT_SLOTS];
+    int32_t scheduledCount;
+    uint32_t pitchBendRatio;
+    uint32_t voiceCounter;
+    uint8_t sustainPedal;
+    uint8_t reserved[3];
+};
+
+struct EventLogSegment {
+    uint32_t sample;      // sampleClock at its first block
+    uint32_t firstEntry;  // ring index of its first entry
+    uint32_t entryCount;
+    uint32_t blockCount;  // DMA blocks rendered in it
+    uint32_t outputCrc;   // CRC-32 of every output word of those blocks
+    uint32_t flags;       // SEGMENT_*
+    EngineSnapshot start;
+};
+
+struct EventLogHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t entrySize;   // sizeof(EventLogEntry)
+    uint32_t segmentSize; // sizeof(EventLogSegment): logs replay only on the same layout
+    uint8_t segmentCount; // retained segments, oldest at segments[firstSegment]
+    uint8_t firstSegment;
+    uint16_t reserved;
+    uint32_t entryCount;  // retained entries, all of them in those segments
+    uint32_t blockCount;  // DMA blocks rendered in those segments
+    uint32_t flags;
+    uint32_t reserved2;
+};
+
+// Downloaded and uploaded whole; segments and entries are both rings
+struct EventLogData {
+    EventLogHeader header;
+    EventLogSegment segments[EVENT_LOG_SEGMENTS];
+    EventLogEntry entries[EVENT_LOG_CAPACITY];
+};
+
+enum EventLogState : uint8_t {
+    EVENT_LOG_IDLE,
+    EVENT_LOG_RECORD_REQUESTED,   // core 0 -> audio core, taken at the next block
+    EVENT_LOG_RECORDING,
+    EVENT_LOG_REPLAY_REQUESTED,
+    EVENT_LOG_REPLAYING
+};
+
+// --- Event Log ---
+// One preallocated buffer shared by recording, download, upload and replay.
+// Outside EVENT_LOG_IDLE the audio core owns 'data'; core 0 only requests
+// state changes and reads it once the state is back to idle.
+class EventLog {
+private:
+    size_t uploadLength = 0;
+
+    void dropOldestSegment();
+
+public:
+    EventLogData data;
+    volatile EventLogState state = EVENT_LOG_IDLE;
+    volatile bool stopRequested = false;
+
+    // Replay results, valid once a replay has returned to idle
+    uint32_t replayCursor = 0;          // next entry to feed, counted from the oldest (audio core)
+    int replaySegment = 0;              // segment being replayed, counted from the oldest
+    uint32_t replaySegmentBlocks = 0;
+    uint32_t replayBlocks = 0;
+    uint32_t replayCrc = 0;             // of the segment being replayed
+    int segmentsMatched = 0;            // segments whose output CRC matched
+    int firstMismatch = -1;             // oldest segment whose output differed
+    bool replayComplete = false;        // every recorded block was rendered
+    bool replayMatched = false;         // ... and every segment's output CRC matched
+    uint32_t maxSnapshotMicros = 0;     // audio-core cost of the slowest snapshot while recording
+    uint16_t blockMicros[EVENT_LOG_TIMING_BLOCKS]; // render time of the first blocks
+    uint32_t maxBlockMicros = 0;
+    uint32_t worstBlock = 0;
+    uint64_t totalBlockMicros = 0;
+
+    // Core 0: recording starts at the next block, with a snapshot of the engine
+    bool startRecording();
+    // Core 0: replay what 'data' holds (recorded or uploaded)
+    bool startReplay();
+    // Core 0: ask the audio core to finish; waits up to 'timeoutMs' for it
+    bool stop(uint32_t timeoutMs);
+    bool isIdle() const { return state == EVENT_LOG_IDLE; }
+
+    // Bytes of 'data' that make up the current log (the whole buffer, or 0)
+    size_t size() const;
+    // Header, snapshots and entries are consistent (checked before every replay)
+    bool isValid() const;
+    // i-th retained segment / entry, oldest first
+    const EventLogSegment& segment(int i) const {
+        return data.segments[(data.header.firstSegment + i) % EVENT_LOG_SEGMENTS];
+    }
+    const EventLogEntry& entry(uint32_t i) const {
+        return data.entries[(segment(0).firstEntry + i) % EVENT_LOG_CAPACITY];
+    }
+
+    // Core 0, idle only: streamed upload into 'data'
+    bool beginUpload();
+    bool writeUpload(const uint8_t* bytes, size_t length);
+    bool endUpload();
+
+    // Audio core
+    void beginRecording();
+    // A new segment is due at this block (none yet, or the current one is full)
+    bool segmentDue() const;
+    // Opens a segment at 'sample', dropping the oldest if every slot is used;
+    // the caller fills in its snapshot
+    EventLogSegment& beginSegment(uint32_t sample, uint32_t flags);
+    bool append(const EventLogEntry& entry);  // false once truncated
+    void addRecordedBlock(const int16_t* words, int count);
+    void finishRecording();
+    void beginReplay();
+    // Replay reached segment 'replaySegment + 1': scores the one just finished
+    void nextReplaySegment();
+    void addReplayedBlock(const int16_t* words, int count, uint32_t renderMicros);
+    void finishReplay();
+
+    int format(char* json, size_t length);
+};
+
+// Running CRC-32 (start with 0, feed any number of chunks)
+uint32_t crc32Update(uint32_t crc, const void* data, size_t length);
+
+extern EventLog eventLog;
+
+#endif
@@ -0,0 +1,72 @@
+// footprint.cpp
+
+#include "Footprint.h"
+
+void FootprintMonitor::registerTask(const char* name, TaskHandle_t handle, uint32_t stackSize) {
+    if (taskCount == FOOTPRINT_MAX_TASKS) return;
+
+    // Resolve "the calling task" now; the report may be produced elsewhere
+    if (handle == NULL) handle = xTaskGetCurrentTaskHandle();
+    tasks[taskCount++] = { name, handle, stackSize };
+}
+
+void FootprintMonitor::beginHandler() {
+    multi_heap_info_t info;
+    heap_caps_get_info(&info, MALLOC_CAP_8BIT);
+
+    handlerBlocks = info.allocated_blocks;
+    handlerFreeBytes = info.total_free_bytes;
+}
+
+void FootprintMonitor::endHandler() {
+    multi_heap_info_t info;
+    heap_caps_get_info(&info, MALLOC_CAP_8BIT);
+
+    uiRequests++;
+    if (info.allocated_blocks > handlerBlocks) {
+        uiAllocatedBlocks += info.allocated_blocks - handlerBlocks;
+    } else {
+        uiFreedBlocks += handlerBlocks - info.allocated_blocks;
+    }
+    if (info.total_free_bytes < handlerFreeBytes && handlerFreeBytes - info.total_free_bytes > uiMaxRetainedBytes) {
+        uiMaxRetainedBytes = handlerFreeBytes - info.total_free_bytes;
+    }
+}
+
+uint32_t FootprintMonitor::stackFree(int task) const {
+    // ESP-IDF reports the high-water mark in bytes
+    return uxTaskGetStackHighWaterMark(tasks[task].handle);
+}
+
+int FootprintMonitor::format(char* json, size_t length) {
+    size_t freeHeap = ESP.getFreeHeap();
+    size_t largestBlock = ESP.getMaxAllocHeap();
+    // 0 = one contiguous free region, approaching 100 = badly fragmented
+    int fragmentation = (freeHeap > 0) ? 100 - (int)(largestBlock * 100 / freeHeap) : 0;
+
+    int used = snprintf(json, length, "{\"tasks\": [");
+    for (int t = 0; t < taskCount && used < (int)length; t++) {
+        used += snprintf(json + used, length - used, "%s{\"name\": \"%s\", \"stack\": %lu, \"stack_free_min\": %lu}",
+                         t > 0 ? ", " : "", tasks[t].name, (unsigned long)tasks[t].stackSize, (unsigned long)stackFree(t));
+    }
+    if (used >= (int)length) return -1;
+
+    used += snprintf(json + used, length - used,
+                     "], \"heap_total\": %lu, \"heap_free\": %lu, \"heap_free_min\": %lu, \"heap_largest_block\": %lu, "
+                     "\"heap_fragmentation_pct\": %d, \"ui_requests\": %lu, \"ui_allocated_blocks\": %lu, "
+                     "\"ui_freed_blocks\": %lu, \"ui_max_retained_bytes\": %lu}",
+                     (unsigned long)ESP.getHeapSize(), (unsigned long)freeHeap, (unsigned long)ESP.getMinFreeHeap(),
+                     (unsigned long)largestBlock, fragmentation, (unsigned long)uiRequests,
+                     (unsigned long)uiAllocatedBlocks, (unsigned long)uiFreedBlocks, (unsigned long)uiMaxRetainedBytes);
+    return (used < (int)length) ? used : -1;
+}
+
+void FootprintMonitor::log() {
+    for (int t = 0; t < taskCount; t++) {
+        Serial.printf("Footprint: %s stack %lu bytes, min free %lu\n", tasks[t].name,
+                      (unsigned long)tasks[t].stackSize, (unsigned long)stackFree(t));
+    }
+    Serial.printf("Footprint: heap free %lu (min %lu, largest block %lu), UI %lu requests left %lu blocks / freed %lu\n",
+                  (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMinFreeHeap(), (unsigned long)ESP.getMaxAllocHeap(),
+                  (unsigned long)uiRequests, (unsigned long)uiAllocatedBlocks, (unsigned long)uiFreedBlocks);
+}
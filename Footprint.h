@@ -0,0 +1,54 @@
+// footprint.h
+
+#ifndef FOOTPRINT_H
+#define FOOTPRINT_H
+
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+
+// --- Footprint Reporting ---
+// Stack high-water marks of the registered tasks, heap state and the heap
+// blocks left behind by Web UI request handlers. Served on /footprint and
+// logged every FOOTPRINT_REPORT_INTERVAL_MS.
+#define FOOTPRINT_MAX_TASKS 4
+#define FOOTPRINT_REPORT_INTERVAL_MS 60000
+
+struct TaskFootprint {
+    const char* name;
+    TaskHandle_t handle;   // NULL = the calling task (registered from setup(): loopTask)
+    uint32_t stackSize;    // bytes, as passed to xTaskCreatePinnedToCore
+};
+
+class FootprintMonitor {
+private:
+    TaskFootprint tasks[FOOTPRINT_MAX_TASKS];
+    int taskCount = 0;
+
+    // Heap state at the start of the handler being tracked
+    size_t handlerBlocks = 0;
+    size_t handlerFreeBytes = 0;
+
+public:
+    // Web UI handlers (loop task only)
+    uint32_t uiRequests = 0;
+    uint32_t uiAllocatedBlocks = 0;   // blocks a handler left allocated, summed
+    uint32_t uiFreedBlocks = 0;       // blocks a handler released, summed
+    uint32_t uiMaxRetainedBytes = 0;  // largest heap drop across one handler
+
+    void registerTask(const char* name, TaskHandle_t handle, uint32_t stackSize);
+
+    // Bracket a request handler. Only blocks still held (or released) when
+    // the handler returns are counted: a String built and dropped inside it
+    // is invisible here, but anything that outlives the request is not.
+    void beginHandler();
+    void endHandler();
+
+    // Minimum free stack ever seen, in bytes
+    uint32_t stackFree(int task) const;
+    int format(char* json, size_t length);
+    void log();
+};
+
+extern FootprintMonitor footprint;
+
+#endif
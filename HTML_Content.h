@@ -44,6 +44,14 @@ const char INDEX_HTML[] = R"rawliteral(
         }
         .key-map-item label { margin-bottom: 2px; font-size: 0.8em; }
         .key-map-item select { font-size: 0.7em; padding: 2px; height: 25px; margin-bottom: 0; }
+        
+        /* Styles for LFO / Mod Matrix rows */
+        .mod-row { display: grid; grid-template-columns: 1fr 1fr 1fr; gap: 5px; align-items: center; margin-bottom: 5px; }
+        .mod-row select, .mod-row input[type="range"] { margin-bottom: 0; }
+        .preset-row { display: grid; grid-template-columns: 1fr 1fr; gap: 5px; }
+        .preset-row input[type="text"] { padding: 8px; border: 1px solid #666; border-radius: 4px; background-color: #555; color: #eee; }
+        .preset-row button, #save_custom_map { padding: 10px 20px; background-color: #88F; border: none; border-radius: 5px; color: white; cursor: pointer; }
+        #scope_canvas { width: 100%; height: 150px; background-color: #222; border-radius: 4px; margin-bottom: 10px; }
         #save_custom_map { margin-top: 15px; padding: 10px 20px; background-color: #88F; border: none; border-radius: 5px; color: white; cursor: pointer; }
     </style>
 </head>
@@ -52,19 +60,30 @@ const char INDEX_HTML[] = R"rawliteral(
         <h1>ESP32 Polyphonic Synthesizer</h1>
         <div id="note_status">Current Note: None</div>
 
+        <div class="control-group">
+            <h3>Presets</h3>
+            <select id="preset_slot"></select>
+            <div class="preset-row">
+                <input type="text" id="preset_name" maxlength="15" placeholder="Name">
+                <button onclick="storePreset()">Store</button>
+                <button onclick="recallPreset()">Recall</button>
+                <button onclick="erasePreset()">Erase</button>
+            </div>
+        </div>
+
         <div class="control-group">
             <h3>ADSR Envelope (A/D/R in seconds, S is 0-1)</h3>
             <label>Attack Time (A): <span id="adsr_a_value">0.050s</span></label>
-            <input type="range" id="adsr_a" min="0" max="300" value="50" oninput="updateADSRValue('a', this.value)" onmouseup="sendADSR()">
+            <input type="range" id="adsr_a" min="0" max="300" value="50" oninput="updateADSRValue('a', this.value); sendADSR()">
             
             <label>Decay Time (D): <span id="adsr_d_value">0.100s</span></label>
-            <input type="range" id="adsr_d" min="0" max="300" value="100" oninput="updateADSRValue('d', this.value)" onmouseup="sendADSR()">
+            <input type="range" id="adsr_d" min="0" max="300" value="100" oninput="updateADSRValue('d', this.value); sendADSR()">
             
             <label>Sustain Level (S): <span id="adsr_s_value">0.50</span></label>
-            <input type="range" id="adsr_s" min="0" max="100" value="50" oninput="updateADSRValue('s', this.value)" onmouseup="sendADSR()">
+            <input type="range" id="adsr_s" min="0" max="100" value="50" oninput="updateADSRValue('s', this.value); sendADSR()">
             
             <label>Release Time (R): <span id="adsr_r_value">0.500s</span></label>
-            <input type="range" id="adsr_r" min="0" max="500" value="500" oninput="updateADSRValue('r', this.value)" onmouseup="sendADSR()">
+            <input type="range" id="adsr_r" min="0" max="500" value="500" oninput="updateADSRValue('r', this.value); sendADSR()">
         </div>
         
         <div class="control-group">
@@ -75,9 +94,26 @@ const char INDEX_HTML[] = R"rawliteral(
                 <option value="1">Square</option>
                 <option value="2">Sawtooth</option>
                 <option value="3">Triangle</option>
+                <option value="4">Sample</option>
             </select>
+            <div id="sample_row" style="display: none;">
+                <label for="sample_index">Sample:</label>
+                <select id="sample_index" onchange="queueParam(PARAM.SAMPLE, parseInt(this.value))"></select>
+            </div>
             <label>Gain: <span id="gain_value_1">1.00</span></label>
-            <input type="range" id="osc1_gain" min="0" max="100" value="100" oninput="updateGainValue(1, this.value)" onmouseup="sendGain(1, this.value)">
+            <input type="range" id="osc1_gain" min="0" max="100" value="100" oninput="updateGainValue(1, this.value); sendGain(1, this.value)">
+        </div>
+
+        <div class="control-group">
+            <h3>Unison (Oscillator 1)</h3>
+            <label>Voices: <span id="unison_voices_value">1</span></label>
+            <input type="range" id="unison_voices" min="1" max="8" value="1" oninput="updateUnisonValues(); sendUnison()">
+            
+            <label>Detune: <span id="unison_detune_value">20 cents</span></label>
+            <input type="range" id="unison_detune" min="0" max="100" value="20" oninput="updateUnisonValues(); sendUnison()">
+            
+            <label>Stereo Spread: <span id="unison_spread_value">0.50</span></label>
+            <input type="range" id="unison_spread" min="0" max="100" value="50" oninput="updateUnisonValues(); sendUnison()">
         </div>
 
         <div class="control-group">
@@ -90,7 +126,7 @@ const char INDEX_HTML[] = R"rawliteral(
                 <option value="3">Triangle</option>
             </select>
             <label>Gain: <span id="gain_value_2">0.00</span></label>
-            <input type="range" id="osc2_gain" min="0" max="100" value="0" oninput="updateGainValue(2, this.value)" onmouseup="sendGain(2, this.value)">
+            <input type="range" id="osc2_gain" min="0" max="100" value="0" oninput="updateGainValue(2, this.value); sendGain(2, this.value)">
             
             <label>OSC 2 Enable: 
                 <label class="switch">
@@ -100,6 +136,53 @@ const char INDEX_HTML[] = R"rawliteral(
             </label>
         </div>
         
+        <div class="control-group">
+            <h3>FM (Oscillator 2 modulates Oscillator 1)</h3>
+            <label for="fm_mode">Mode:</label>
+            <select id="fm_mode" onchange="sendFM()">
+                <option value="0" selected>Mix (OSC1 + OSC2)</option>
+                <option value="1">FM / Phase Modulation</option>
+            </select>
+            <label>Ratio: <span id="fm_ratio_value">1.00</span></label>
+            <input type="range" id="fm_ratio" min="1" max="32" value="4" oninput="updateFMValues(); sendFM()">
+            
+            <label>Index: <span id="fm_index_value">2.0</span></label>
+            <input type="range" id="fm_index" min="0" max="100" value="20" oninput="updateFMValues(); sendFM()">
+        </div>
+        
+        <div class="control-group">
+            <h3>LFOs</h3>
+            <div id="lfo_rows"></div>
+        </div>
+        
+        <div class="control-group">
+            <h3>Modulation Matrix (Source / Destination / Depth)</h3>
+            <div id="mod_rows"></div>
+        </div>
+        
+        <div class="control-group">
+            <h3>Arpeggiator / Step Sequencer</h3>
+            <div class="mod-row">
+                <select id="seq_mode" onchange="sendSequencer()">
+                    <option value="0" selected>Off</option>
+                    <option value="1">Arpeggiator</option>
+                    <option value="2">Step Sequencer</option>
+                </select>
+                <select id="arp_mode" onchange="sendSequencer()">
+                    <option value="0" selected>Up</option>
+                    <option value="1">Down</option>
+                    <option value="2">Random</option>
+                    <option value="3">Chord</option>
+                </select>
+                <select id="seq_length" onchange="sendSequencer()"></select>
+            </div>
+            <label for="seq_tempo">Tempo: <span id="seq_tempo_value">120</span> BPM</label>
+            <input type="range" id="seq_tempo" min="20" max="300" value="120" oninput="updateSequencerValues(); sendSequencer()">
+            <label for="seq_gate">Gate: <span id="seq_gate_value">50</span>%</label>
+            <input type="range" id="seq_gate" min="5" max="100" value="50" oninput="updateSequencerValues(); sendSequencer()">
+            <div class="key-grid" id="seq_steps"></div>
+        </div>
+
         <div class="control-group">
             <h3>Scale Mapping</h3>
             
@@ -114,9 +197,49 @@ const char INDEX_HTML[] = R"rawliteral(
                 <option value="2">Pentatonic Major</option>
                 <option value="3">Pentatonic Minor</option>
                 <option value="4">Custom/Free Map</option>
+                <option value="5">Chromatic (one tuning step per key)</option>
             </select>
         </div>
 
+        <div class="control-group">
+            <h3>Tuning (Scala .scl / .kbm)</h3>
+            <div id="tuning_status">12-TET</div>
+            <label for="scl_file">Scale (.scl):</label>
+            <input type="file" id="scl_file" accept=".scl">
+            <label for="kbm_file">Keyboard Mapping (.kbm, optional):</label>
+            <input type="file" id="kbm_file" accept=".kbm">
+            <div class="preset-row">
+                <button onclick="uploadTuning()">Load Tuning</button>
+                <button onclick="resetTuning()">Reset to 12-TET</button>
+            </div>
+        </div>
+
+        <div class="control-group">
+            <h3>Scope</h3>
+            <canvas id="scope_canvas" width="460" height="150"></canvas>
+            <div class="preset-row">
+                <select id="scope_mode">
+                    <option value="wave" selected>Waveform</option>
+                    <option value="fft">Spectrum</option>
+                </select>
+                <button id="scope_button" onclick="toggleScope()">Start</button>
+            </div>
+        </div>
+
+        <div class="control-group">
+            <h3>Event Log (Record / Replay)</h3>
+            <div id="eventlog_status">Idle</div>
+            <div class="preset-row">
+                <button onclick="eventLogRequest('record')">Record</button>
+                <button onclick="eventLogRequest('stop')">Stop</button>
+                <button onclick="eventLogRequest('replay')">Replay</button>
+                <button onclick="window.location = '/eventlog/download'">Download</button>
+            </div>
+            <label for="eventlog_file">Log File (.bin):</label>
+            <input type="file" id="eventlog_file" accept=".bin">
+            <button onclick="uploadEventLog()">Upload</button>
+        </div>
+
         <div class="control-group" id="custom_mapping_group">
             <h3>Custom Key Assignments (4x4 Matrix)</h3>
             <div class="key-grid" id="key_map_grid">
@@ -184,6 +307,111 @@ const char INDEX_HTML[] = R"rawliteral(
             keyMapGrid.innerHTML = html;
         }
 
+        // --- Arpeggiator / Step Sequencer UI ---
+        // Default pattern matches Sequencer::Sequencer() on the synth
+        const SEQ_DEFAULT_NOTES = [60, 64, 67, 72];
+
+        function populateSequencer() {
+            let lengths = '';
+            for (let n = 1; n <= 16; n++) {
+                lengths += '<option value="' + n + '"' + (n === 16 ? ' selected' : '') + '>' + n + ' steps</option>';
+            }
+            document.getElementById('seq_length').innerHTML = lengths;
+
+            let html = '';
+            for (let i = 0; i < 16; i++) {
+                const defaultNote = (i % 2 === 0) ? SEQ_DEFAULT_NOTES[(i / 2) % 4] : -1;
+                html += '<div class="key-map-item">';
+                html += '<label>S' + (i + 1) + '</label>';
+                html += '<select id="step_' + i + '" onchange="sendStep(' + i + ')">';
+                html += '<option value="-1"' + (defaultNote < 0 ? ' selected' : '') + '>Rest</option>';
+                for (let midi = 36; midi <= 96; midi++) {
+                    html += '<option value="' + midi + '"' + (midi === defaultNote ? ' selected' : '') + '>' + getNoteName(midi) + '</option>';
+                }
+                html += '</select></div>';
+            }
+            document.getElementById('seq_steps').innerHTML = html;
+        }
+
+        function updateSequencerValues() {
+            document.getElementById('seq_tempo_value').textContent = document.getElementById('seq_tempo').value;
+            document.getElementById('seq_gate_value').textContent = document.getElementById('seq_gate').value;
+        }
+
+        function sendSequencer() {
+            queueParam(PARAM.SEQ_TEMPO, parseInt(document.getElementById('seq_tempo').value));
+            queueParam(PARAM.SEQ_GATE, parseInt(document.getElementById('seq_gate').value));
+            queueParam(PARAM.SEQ_LENGTH, parseInt(document.getElementById('seq_length').value));
+            queueParam(PARAM.ARP_MODE, parseInt(document.getElementById('arp_mode').value));
+            queueParam(PARAM.SEQ_MODE, parseInt(document.getElementById('seq_mode').value));
+        }
+
+        // A rest keeps the note and sends velocity 0
+        function sendStep(step) {
+            const note = parseInt(document.getElementById('step_' + step).value);
+            if (note >= 0) queueParam(PARAM.SEQ_NOTE + step, note);
+            queueParam(PARAM.SEQ_VELOCITY + step, note >= 0 ? 100 : 0);
+        }
+
+        // --- LFO / Mod Matrix UI ---
+        const NUM_LFOS = 4;
+        const MAX_MOD_SLOTS = 6;
+        const LFO_SHAPES = ["Sine", "Triangle", "Saw", "Square"];
+        const MOD_SOURCES = ["None", "LFO 1", "LFO 2", "LFO 3", "LFO 4", "Envelope", "Key", "Mod Wheel"];
+        const MOD_DESTS = ["None", "Pitch", "OSC1 Gain", "OSC2 Gain", "Pan"];
+
+        function optionList(names) {
+            let html = '';
+            names.forEach((name, i) => { html += '<option value="' + i + '">' + name + '</option>'; });
+            return html;
+        }
+
+        function populateModulation() {
+            let html = '';
+            // LFO rate slider is in hundredths of a Hz (0.05 - 20 Hz)
+            for (let i = 0; i < NUM_LFOS; i++) {
+                html += '<div class="mod-row">';
+                html += '<label>LFO ' + (i + 1) + ': <span id="lfo_' + i + '_value">1.00 Hz</span></label>';
+                html += '<select id="lfo_' + i + '_shape" onchange="sendLFO(' + i + ')">' + optionList(LFO_SHAPES) + '</select>';
+                html += '<input type="range" id="lfo_' + i + '_rate" min="5" max="2000" value="100" oninput="updateLFOValue(' + i + '); sendLFO(' + i + ')">';
+                html += '</div>';
+            }
+            document.getElementById('lfo_rows').innerHTML = html;
+
+            html = '';
+            for (let i = 0; i < MAX_MOD_SLOTS; i++) {
+                html += '<div class="mod-row">';
+                html += '<select id="mod_' + i + '_src" onchange="sendMod(' + i + ')">' + optionList(MOD_SOURCES) + '</select>';
+                html += '<select id="mod_' + i + '_dst" onchange="sendMod(' + i + ')">' + optionList(MOD_DESTS) + '</select>';
+                html += '<input type="range" id="mod_' + i + '_depth" min="-100" max="100" value="0" oninput="sendMod(' + i + ')">';
+                html += '</div>';
+            }
+            document.getElementById('mod_rows').innerHTML = html;
+        }
+
+        function updateLFOValue(lfo) {
+            const rate = parseInt(document.getElementById('lfo_' + lfo + '_rate').value) / 100.0;
+            document.getElementById('lfo_' + lfo + '_value').textContent = rate.toFixed(2) + ' Hz';
+        }
+
+        function sendLFO(lfo) {
+            const rate = parseInt(document.getElementById('lfo_' + lfo + '_rate').value) / 100.0;
+            const shape = document.getElementById('lfo_' + lfo + '_shape').value;
+
+            queueParam(PARAM.LFO_RATE + lfo, rate);
+            queueParam(PARAM.LFO_SHAPE + lfo, parseInt(shape));
+        }
+
+        function sendMod(slot) {
+            const src = document.getElementById('mod_' + slot + '_src').value;
+            const dst = document.getElementById('mod_' + slot + '_dst').value;
+            const depth = document.getElementById('mod_' + slot + '_depth').value;
+
+            queueParam(PARAM.MOD_SOURCE + slot, parseInt(src));
+            queueParam(PARAM.MOD_DEST + slot, parseInt(dst));
+            queueParam(PARAM.MOD_DEPTH + slot, parseInt(depth) / 100.0);
+        }
+
         // --- Event Handlers & Sending Data ---
 
         // Handler for ADSR
@@ -215,10 +443,10 @@ const char INDEX_HTML[] = R"rawliteral(
             const s = parseInt(sustainSlider.value) / 100.0;
             const r = parseInt(releaseSlider.value) / 1000.0;
 
-            const xhr = new XMLHttpRequest();
-            const url = '/setadsr?a=' + a.toFixed(3) + '&d=' + d.toFixed(3) + '&s=' + s.toFixed(2) + '&r=' + r.toFixed(3);
-            xhr.open('GET', url, true);
-            xhr.send();
+            queueParam(PARAM.ATTACK, a);
+            queueParam(PARAM.DECAY, d);
+            queueParam(PARAM.SUSTAIN, s);
+            queueParam(PARAM.RELEASE, r);
         }
 
         // Handler for Scale Type change (show/hide custom map)
@@ -237,31 +465,20 @@ const char INDEX_HTML[] = R"rawliteral(
                 const root = rootNoteSelect.value;
                 const type = scaleTypeSelect.value;
                 
-                const xhr = new XMLHttpRequest();
-                xhr.open("GET", "/setscale?root=" + root + "&type=" + type, true);
-                xhr.send();
+                queueParam(PARAM.ROOT_NOTE, parseInt(root));
+                queueParam(PARAM.SCALE_TYPE, parseInt(type));
             }
         }
         
-        // Handler for Custom Map save (POST request with all key data)
+        // Handler for Custom Map save (all 16 keys go out in one frame)
         function sendCustomMap() {
             const selects = keyMapGrid.querySelectorAll('select');
-            let keyDataArray = [];
             
             selects.forEach(select => {
-                const keyIndex = select.getAttribute('data-key-index');
-                const midiNote = select.value;
-                keyDataArray.push(keyIndex + ':' + midiNote);
+                const keyIndex = parseInt(select.getAttribute('data-key-index'));
+                queueParam(PARAM.KEY_NOTE + keyIndex, parseInt(select.value));
             });
-            
-            const keyDataString = keyDataArray.join(',');
-            
-            const xhr = new XMLHttpRequest();
-            xhr.open("POST", "/setcustom", true);
-            // Set the content type header for POST data
-            xhr.setRequestHeader("Content-Type", "application/x-www-form-urlencoded"); 
-            // Send the data string
-            xhr.send("key_data=" + keyDataString); 
+            queueParam(PARAM.SCALE_TYPE, 4);
             
             alert("Custom Key Map saved! (Requires 'Custom/Free Map' to be selected)");
         }
@@ -270,9 +487,27 @@ const char INDEX_HTML[] = R"rawliteral(
         // Existing functions...
 
         function sendWaveform(oscNum, waveType) {
-            const xhr = new XMLHttpRequest();
-            xhr.open("GET", "/setosc?osc=" + oscNum + "&wave=" + waveType, true);
-            xhr.send();
+            queueParam(oscNum == 1 ? PARAM.OSC1_WAVE : PARAM.OSC2_WAVE, parseInt(waveType));
+            if (oscNum == 1) {
+                document.getElementById('sample_row').style.display = (waveType == 4) ? 'block' : 'none';
+            }
+        }
+
+        // --- Samples (bank in the synth's flash partition) ---
+        function loadSamples() {
+            fetch('/samples')
+                .then(response => response.json())
+                .then(data => {
+                    const select = document.getElementById('sample_index');
+                    select.innerHTML = data.samples.length ? '' : '<option value="0">(no sample bank)</option>';
+                    data.samples.forEach((name, index) => {
+                        const option = document.createElement('option');
+                        option.value = index;
+                        option.textContent = (index + 1) + ': ' + name;
+                        select.appendChild(option);
+                    });
+                })
+                .catch(error => console.error('Error fetching samples:', error));
         }
 
         function updateGainValue(oscNum, value) {
@@ -281,40 +516,301 @@ const char INDEX_HTML[] = R"rawliteral(
         }
 
         function sendGain(oscNum, value) {
-            const xhr = new XMLHttpRequest();
-            xhr.open("GET", "/setgain?osc=" + oscNum + "&gain=" + value, true);
-            xhr.send();
+            queueParam(oscNum == 1 ? PARAM.OSC1_GAIN : PARAM.OSC2_GAIN, parseInt(value) / 100.0);
+        }
+
+        // Handler for Unison
+        function updateUnisonValues() {
+            document.getElementById('unison_voices_value').textContent = document.getElementById('unison_voices').value;
+            document.getElementById('unison_detune_value').textContent = document.getElementById('unison_detune').value + ' cents';
+            document.getElementById('unison_spread_value').textContent = (parseInt(document.getElementById('unison_spread').value) / 100.0).toFixed(2);
+        }
+
+        function sendUnison() {
+            const voices = document.getElementById('unison_voices').value;
+            const detune = document.getElementById('unison_detune').value;
+            const spread = document.getElementById('unison_spread').value;
+
+            queueParam(PARAM.UNISON_VOICES, parseInt(voices));
+            queueParam(PARAM.UNISON_DETUNE, parseInt(detune));
+            queueParam(PARAM.STEREO_SPREAD, parseInt(spread) / 100.0);
+        }
+
+        // Handler for FM (ratio in quarter steps, index in tenths)
+        function updateFMValues() {
+            document.getElementById('fm_ratio_value').textContent = (parseInt(document.getElementById('fm_ratio').value) / 4.0).toFixed(2);
+            document.getElementById('fm_index_value').textContent = (parseInt(document.getElementById('fm_index').value) / 10.0).toFixed(1);
+        }
+
+        function sendFM() {
+            const mode = document.getElementById('fm_mode').value;
+            const ratio = parseInt(document.getElementById('fm_ratio').value) / 4.0;
+            const index = parseInt(document.getElementById('fm_index').value) / 10.0;
+
+            queueParam(PARAM.SYNTH_MODE, parseInt(mode));
+            queueParam(PARAM.FM_RATIO, ratio);
+            queueParam(PARAM.FM_INDEX, index);
         }
 
         function sendOsc2Toggle(checked) {
-            const xhr = new XMLHttpRequest();
-            const value = checked ? 1 : 0;
-            xhr.open("GET", "/setgain?osc=2&enabled=" + value, true);
-            xhr.send();
+            queueParam(PARAM.OSC2_ENABLED, checked ? 1 : 0);
         }
         
-        // Status update loop
+        // --- WebSocket channel (port 81) ---
+        // The synth pushes {"note": ...} whenever the note changes; parameter
+        // changes go out as binary frames. Plain HTTP is only used while the
+        // socket is down.
+        let ws = null;
+        let statusPollTimer = null;
+
+        function showStatus(data) {
+            if (data.note !== undefined) {
+                document.getElementById('note_status').textContent = "Current Note: " + data.note;
+            }
+        }
+
+        function connectWebSocket() {
+            ws = new WebSocket('ws://' + location.hostname + ':81/');
+            ws.onopen = () => {
+                clearInterval(statusPollTimer);
+                statusPollTimer = null;
+            };
+            ws.onmessage = (event) => showStatus(JSON.parse(event.data));
+            ws.onclose = () => {
+                // Fall back to slow polling and keep trying to reconnect
+                if (statusPollTimer === null) {
+                    statusPollTimer = setInterval(updateStatus, 1000);
+                }
+                setTimeout(connectWebSocket, 2000);
+            };
+        }
+
+        // --- Batched parameter frames (layout in ParamFrame.h) ---
+        // Controls only queue values; everything changed within PARAM_FLUSH_MS
+        // goes out as one frame that the synth applies in a single audio block.
+        const PARAM = {
+            OSC1_WAVE: 0, OSC2_WAVE: 1, OSC1_GAIN: 2, OSC2_GAIN: 3, OSC2_ENABLED: 4,
+            ATTACK: 5, DECAY: 6, SUSTAIN: 7, RELEASE: 8, ROOT_NOTE: 9, SCALE_TYPE: 10,
+            UNISON_VOICES: 11, UNISON_DETUNE: 12, STEREO_SPREAD: 13,
+            SYNTH_MODE: 14, FM_RATIO: 15, FM_INDEX: 16, PITCH_BEND_RANGE: 17,
+            LFO_RATE: 18, LFO_SHAPE: 22, MOD_SOURCE: 26, MOD_DEST: 32, MOD_DEPTH: 38, KEY_NOTE: 44,
+            SEQ_MODE: 60, ARP_MODE: 61, SEQ_TEMPO: 62, SEQ_GATE: 63, SEQ_LENGTH: 64, SEQ_NOTE: 65, SEQ_VELOCITY: 81,
+            SAMPLE: 97
+        };
+        const PARAM_FRAME_MAGIC = 0x50;
+        const PARAM_FLUSH_MS = 25;
+        const pendingParams = new Map();
+        let paramFlushTimer = null;
+
+        function queueParam(id, value) {
+            pendingParams.set(id, value);
+            if (paramFlushTimer === null) {
+                paramFlushTimer = setTimeout(flushParams, PARAM_FLUSH_MS);
+            }
+        }
+
+        function flushParams() {
+            clearTimeout(paramFlushTimer);
+            paramFlushTimer = null;
+            if (pendingParams.size === 0) return;
+
+            const buffer = new ArrayBuffer(2 + pendingParams.size * 5);
+            const view = new DataView(buffer);
+            view.setUint8(0, PARAM_FRAME_MAGIC);
+            view.setUint8(1, pendingParams.size);
+            let offset = 2;
+            pendingParams.forEach((value, id) => {
+                view.setUint8(offset, id);
+                view.setFloat32(offset + 1, value, true);
+                offset += 5;
+            });
+            pendingParams.clear();
+
+            if (ws !== null && ws.readyState === WebSocket.OPEN) {
+                ws.send(buffer);
+            } else {
+                // HTTP fallback takes the same frame hex-encoded
+                const hex = Array.from(new Uint8Array(buffer), b => b.toString(16).padStart(2, '0')).join('');
+                fetch('/params', { method: 'POST', headers: { 'Content-Type': 'text/plain' }, body: hex });
+            }
+        }
+
+        // Status fallback (only while the WebSocket is disconnected)
         function updateStatus() {
             fetch('/status')
                 .then(response => response.json())
-                .then(data => {
-                    document.getElementById('note_status').textContent = "Current Note: " + data.note;
-                })
+                .then(showStatus)
                 .catch(error => {
                     console.error('Error fetching status:', error);
                     document.getElementById('note_status').textContent = "Current Note: Error";
                 });
         }
+        
+        // --- Tuning (parsed and applied on the synth) ---
+        function showTuning(response) {
+            if (!response.ok) {
+                response.text().then(text => { document.getElementById('tuning_status').textContent = 'Error: ' + text; });
+                return;
+            }
+            response.json().then(data => {
+                document.getElementById('tuning_status').textContent = data.description + ' (' + data.degrees + ' degrees)';
+            });
+        }
+
+        function uploadTuning() {
+            const scl = document.getElementById('scl_file').files[0];
+            const kbm = document.getElementById('kbm_file').files[0];
+            if (!scl) return;
+
+            Promise.all([scl.text(), kbm ? kbm.text() : Promise.resolve('')])
+                .then(([sclText, kbmText]) => fetch('/tuning', {
+                    method: 'POST',
+                    body: new URLSearchParams({ scl: sclText, kbm: kbmText })
+                }))
+                .then(showTuning)
+                .catch(error => console.error('Error loading tuning:', error));
+        }
+
+        function resetTuning() {
+            fetch('/tuning/reset').then(showTuning);
+        }
 
-        setInterval(updateStatus, 100); // Poll status every 100ms
+        // --- Presets (stored in the synth's flash) ---
+        function loadPresets() {
+            fetch('/presets')
+                .then(response => response.json())
+                .then(data => {
+                    const select = document.getElementById('preset_slot');
+                    select.innerHTML = '';
+                    data.presets.forEach((name, slot) => {
+                        const option = document.createElement('option');
+                        option.value = slot;
+                        option.textContent = (slot + 1) + ': ' + (name !== '' ? name : '(empty)');
+                        select.appendChild(option);
+                    });
+                    if (data.active >= 0) select.value = data.active;
+                })
+                .catch(error => console.error('Error fetching presets:', error));
+        }
+
+        function presetRequest(action, extra) {
+            const slot = document.getElementById('preset_slot').value;
+            fetch('/preset/' + action + '?slot=' + slot + (extra || ''))
+                .then(loadPresets);
+        }
+
+        function storePreset() {
+            // Flush pending control changes first so the preset captures them
+            flushParams();
+            const name = document.getElementById('preset_name').value;
+            setTimeout(() => presetRequest('store', '&name=' + encodeURIComponent(name)), 50);
+        }
+
+        function recallPreset() { presetRequest('recall'); }
+        function erasePreset() { presetRequest('erase'); }
         
+        // --- Scope (decimated output captured on the audio core, see Scope.h) ---
+        const SCOPE_SAMPLE_RATE = 22050;  // 44100 / SCOPE_DECIMATION
+        const SCOPE_FRAME_MS = 66;        // ~15 frames per second
+        let scopeRunning = false;
+
+        function toggleScope() {
+            scopeRunning = !scopeRunning;
+            document.getElementById('scope_button').textContent = scopeRunning ? 'Stop' : 'Start';
+            if (scopeRunning) pollScope();
+        }
+
+        function pollScope() {
+            if (!scopeRunning) return;
+            const mode = document.getElementById('scope_mode').value;
+            fetch('/scope?mode=' + mode)
+                .then(response => response.status === 200 ? response.arrayBuffer() : null)
+                .then(buffer => { if (buffer) drawScope(mode, buffer); })
+                .catch(error => console.error('Error fetching scope:', error))
+                .finally(() => setTimeout(pollScope, SCOPE_FRAME_MS));
+        }
+
+        function drawScope(mode, buffer) {
+            const canvas = document.getElementById('scope_canvas');
+            const ctx = canvas.getContext('2d');
+            const w = canvas.width, h = canvas.height;
+            ctx.fillStyle = '#222';
+            ctx.fillRect(0, 0, w, h);
+            ctx.strokeStyle = '#0F0';
+            ctx.beginPath();
+
+            if (mode === 'fft') {
+                // One byte per bin: 0 = -96 dBFS, 255 = 0 dBFS, bins up to SCOPE_SAMPLE_RATE / 2
+                const bins = new Uint8Array(buffer);
+                for (let i = 0; i < bins.length; i++) {
+                    const x = i * w / bins.length;
+                    const y = h - bins[i] * h / 255;
+                    if (i === 0) ctx.moveTo(x, y); else ctx.lineTo(x, y);
+                }
+                ctx.stroke();
+                ctx.fillStyle = '#ccc';
+                ctx.fillText((SCOPE_SAMPLE_RATE / 2000).toFixed(1) + ' kHz', w - 50, 12);
+            } else {
+                const samples = new Int16Array(buffer);
+                for (let i = 0; i < samples.length; i++) {
+                    const x = i * w / samples.length;
+                    const y = h / 2 - samples[i] * h / 65536;
+                    if (i === 0) ctx.moveTo(x, y); else ctx.lineTo(x, y);
+                }
+                ctx.stroke();
+                ctx.fillStyle = '#ccc';
+                ctx.fillText((samples.length * 1000 / SCOPE_SAMPLE_RATE).toFixed(1) + ' ms', w - 50, 12);
+            }
+        }
+
+        // --- Event Log (recorded on the audio core, see EventLog.h) ---
+        function showEventLog(response) {
+            if (!response.ok) {
+                response.text().then(text => { document.getElementById('eventlog_status').textContent = 'Error: ' + text; });
+                return;
+            }
+            response.json().then(data => {
+                let text = data.state + ': ' + data.entries + ' events over ' + data.blocks + ' blocks' +
+                           (data.truncated ? ' (truncated)' : '');
+                if (data.state === 'idle' && data.replay_blocks > 0) {
+                    text += '; last replay ' + (data.replay_matched ? 'bit-identical' : 'differs') +
+                            ', block max ' + data.block_us_max + ' us (#' + data.worst_block + '), mean ' + data.block_us_mean + ' us';
+                }
+                document.getElementById('eventlog_status').textContent = text;
+            });
+        }
+
+        function eventLogRequest(action) {
+            fetch('/eventlog/' + action).then(showEventLog);
+        }
+
+        function uploadEventLog() {
+            const file = document.getElementById('eventlog_file').files[0];
+            if (!file) return;
+
+            const form = new FormData();
+            form.append('log', file, file.name);
+            fetch('/eventlog/upload', { method: 'POST', body: form })
+                .then(showEventLog)
+                .catch(error => console.error('Error uploading event log:', error));
+        }
+
         // Initialize gain display and ADSR display on load
         document.addEventListener('DOMContentLoaded', () => {
             populateRootNotes(); // NEW
             populateKeyMapGrid(); // NEW
+            populateModulation();
+            populateSequencer();
+            loadPresets();
+            loadSamples();
+            fetch('/tuning').then(showTuning);
+            fetch('/eventlog').then(showEventLog);
+            connectWebSocket();
             
             updateGainValue(1, 100); 
             updateGainValue(2, 0);   
+            updateUnisonValues();
+            updateFMValues();
             // Initialize ADSR display
             const initialA = parseInt(attackSlider.value);
             const initialD = parseInt(decaySlider.value);
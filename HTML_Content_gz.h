@@ -0,0 +1,576 @@
+// HTML_content_gz.h
+// GENERATED by tools/build_html.py from HTML_Content.h -- do not edit.
+
+#ifndef HTML_CONTENT_GZ_H
+#define HTML_CONTENT_GZ_H
+
+#include <Arduino.h>
+
+// 38711 bytes of HTML compressed to 8952 bytes
+const size_t INDEX_HTML_GZ_LEN = 8952;
+const char INDEX_HTML_ETAG[] = "\"0598e5f1b2048af7\"";
+
+const uint8_t INDEX_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe5, 0x3d, 0xfd, 0x73, 0xdb, 0xb6,
+    0x92, 0xbf, 0xe7, 0xaf, 0x40, 0xd5, 0x69, 0x45, 0xb5, 0xb2, 0x2c, 0xc9, 0x96, 0x9b, 0x4a, 0xb6,
+    0x33, 0x8a, 0x2d, 0x27, 0xbe, 0xf8, 0xeb, 0x2c, 0x25, 0x7d, 0x9d, 0x4e, 0x47, 0x43, 0x8b, 0x90,
+    0xc5, 0x17, 0x8a, 0x54, 0x49, 0x2a, 0xb6, 0xdb, 0x97, 0xfb, 0xdb, 0x6f, 0x77, 0x01, 0x92, 0x20,
+    0x09, 0x52, 0x94, 0x93, 0xde, 0xbb, 0x9b, 0xcb, 0x7b, 0x95, 0xf9, 0x01, 0x2c, 0x76, 0x17, 0xbb,
+    0x8b, 0xc5, 0x62, 0x01, 0xbe, 0x38, 0xfc, 0xe6, 0xf4, 0xfa, 0x64, 0xf2, 0xeb, 0xcd, 0x88, 0x2d,
+    0xc2, 0xa5, 0x73, 0xfc, 0xe2, 0x30, 0xfa, 0xc3, 0x4d, 0xeb, 0xf8, 0x05, 0x83, 0x7f, 0x87, 0xa1,
+    0x1d, 0x3a, 0xfc, 0x78, 0x78, 0x33, 0x3e, 0x9f, 0x4c, 0xc7, 0xbf, 0x5e, 0x4d, 0xde, 0xb2, 0x13,
+    0xcf, 0x0d, 0x7d, 0xcf, 0x39, 0xdc, 0x15, 0xaf, 0x44, 0xb1, 0x25, 0x0f, 0x4d, 0xe6, 0x9a, 0x4b,
+    0x7e, 0x54, 0xfb, 0x64, 0xf3, 0x87, 0x95, 0xe7, 0x87, 0x35, 0x36, 0x83, 0x92, 0xdc, 0x0d, 0x8f,
+    0x6a, 0x0f, 0xb6, 0x15, 0x2e, 0x8e, 0x2c, 0xfe, 0xc9, 0x9e, 0xf1, 0x1d, 0xba, 0x69, 0x32, 0xdb,
+    0xb5, 0x43, 0xdb, 0x74, 0x76, 0x82, 0x99, 0xe9, 0xf0, 0xa3, 0x4e, 0x4d, 0x02, 0x0a, 0xc2, 0xa7,
+    0x08, 0x28, 0xfe, 0xbb, 0xf3, 0xac, 0x27, 0xf6, 0x17, 0x9b, 0x03, 0xa4, 0x9d, 0xb9, 0xb9, 0xb4,
+    0x9d, 0xa7, 0x3e, 0x1b, 0xfa, 0x50, 0xaf, 0xc9, 0x02, 0xd3, 0x0d, 0x76, 0x02, 0xee, 0xdb, 0xf3,
+    0x01, 0x0b, 0xf9, 0x63, 0xb8, 0x63, 0x3a, 0xf6, 0xbd, 0xdb, 0x67, 0x33, 0x68, 0x92, 0xfb, 0x03,
+    0xb6, 0x34, 0xfd, 0x7b, 0x1b, 0xee, 0xdb, 0x03, 0x76, 0x67, 0xce, 0x3e, 0xde, 0xfb, 0xde, 0xda,
+    0xb5, 0x76, 0x66, 0x9e, 0xe3, 0xf9, 0x7d, 0xf6, 0x6d, 0xb7, 0xdb, 0x1d, 0xb0, 0xe8, 0x86, 0x73,
+    0x3e, 0x60, 0x9f, 0xe3, 0x46, 0x5b, 0x88, 0xb8, 0x69, 0xbb, 0xdc, 0x87, 0xa6, 0x97, 0xe6, 0xa3,
+    0x40, 0xb9, 0xcf, 0x7a, 0xed, 0xf6, 0xea, 0x31, 0x01, 0x6c, 0xae, 0x43, 0x6f, 0xc0, 0x56, 0xa6,
+    0x65, 0xd9, 0xee, 0x7d, 0x9f, 0x75, 0x7a, 0xf8, 0x52, 0xd3, 0xd4, 0xde, 0xde, 0x1e, 0x3c, 0xf7,
+    0x1e, 0x77, 0x82, 0x85, 0x69, 0x79, 0x0f, 0x80, 0x11, 0xdb, 0x5f, 0x3d, 0xb2, 0x97, 0xf0, 0x9f,
+    0x7f, 0x7f, 0x67, 0x1a, 0xed, 0x26, 0xfd, 0xaf, 0xd5, 0x6b, 0xa8, 0x48, 0x2c, 0x3a, 0xd0, 0x78,
+    0x04, 0xe2, 0xe5, 0xcb, 0x33, 0x04, 0xe1, 0x5b, 0xdc, 0xdf, 0xb9, 0xf3, 0xc2, 0xd0, 0x5b, 0xf6,
+    0x59, 0x17, 0xea, 0x07, 0x9e, 0x63, 0x5b, 0xec, 0xdb, 0x5e, 0xaf, 0x17, 0x23, 0x12, 0xbf, 0xef,
+    0x28, 0xc8, 0x26, 0x95, 0xe8, 0xa1, 0xd2, 0xca, 0x9e, 0xd2, 0xca, 0x7c, 0x3e, 0x8f, 0x2b, 0x84,
+    0xde, 0x0a, 0x4a, 0xf7, 0x34, 0x20, 0x3a, 0x19, 0x10, 0xc4, 0x2d, 0x10, 0x88, 0x1d, 0x24, 0x7b,
+    0x45, 0x1c, 0xd3, 0x34, 0x99, 0xb0, 0x89, 0x6e, 0x05, 0x2d, 0x70, 0x97, 0x10, 0xb1, 0xbf, 0xbf,
+    0x1f, 0xd3, 0xe8, 0x9b, 0x96, 0xbd, 0x0e, 0xfa, 0xc8, 0x23, 0x2d, 0x4b, 0xa9, 0xac, 0xda, 0xe9,
+    0x0e, 0x9f, 0x87, 0x2a, 0x52, 0x8e, 0x79, 0xc7, 0x1d, 0xc0, 0xc5, 0xb2, 0x83, 0x95, 0x63, 0x82,
+    0xd0, 0xdc, 0x39, 0xde, 0xec, 0x63, 0x8e, 0x16, 0xa2, 0x8f, 0x84, 0xeb, 0x81, 0xdb, 0xf7, 0x8b,
+    0x10, 0xca, 0x79, 0x8e, 0x95, 0x08, 0xc6, 0x6c, 0x36, 0x53, 0xa1, 0x06, 0xdc, 0xe1, 0xb3, 0x10,
+    0x65, 0x77, 0xb5, 0x0e, 0x7f, 0x0b, 0x9f, 0x56, 0x20, 0xee, 0xbe, 0xe9, 0xde, 0xf3, 0xda, 0xef,
+    0xd0, 0x96, 0x94, 0x92, 0x4e, 0xbb, 0xfd, 0x9d, 0x42, 0xef, 0xcb, 0x42, 0x16, 0x6a, 0x78, 0x70,
+    0x70, 0x70, 0x90, 0xe3, 0xc1, 0xbe, 0x28, 0x0b, 0xe2, 0x63, 0xff, 0x49, 0x10, 0x63, 0x39, 0xd0,
+    0xf3, 0x86, 0x84, 0xa1, 0x40, 0xb2, 0x05, 0x01, 0x80, 0xeb, 0x42, 0x92, 0xbb, 0xd7, 0xcb, 0x74,
+    0x66, 0xf0, 0x60, 0x87, 0xb3, 0x05, 0x94, 0x58, 0x79, 0x01, 0x28, 0xa8, 0x07, 0xbc, 0xf5, 0xb9,
+    0x63, 0x86, 0xf6, 0x27, 0x00, 0x14, 0x73, 0xd3, 0x76, 0x1d, 0x50, 0x8f, 0x1d, 0xc9, 0x54, 0x49,
+    0xf8, 0x01, 0x51, 0x15, 0x43, 0xde, 0x57, 0x08, 0xc7, 0xee, 0x89, 0x24, 0xe1, 0x13, 0xf7, 0x43,
+    0x1b, 0x94, 0x3e, 0xea, 0xba, 0xa5, 0x6d, 0x59, 0x0e, 0xd7, 0x21, 0x41, 0x6c, 0x06, 0x54, 0xbc,
+    0x95, 0x39, 0xb3, 0xc3, 0x27, 0x52, 0x65, 0xd9, 0x56, 0x3b, 0x69, 0xa8, 0x9d, 0xae, 0x0a, 0x7c,
+    0x24, 0xbd, 0x4d, 0xf0, 0x37, 0xef, 0x80, 0xbb, 0xeb, 0x10, 0x9a, 0x98, 0xad, 0xfd, 0x00, 0xd9,
+    0xb2, 0xf2, 0x6c, 0x61, 0x23, 0x48, 0xca, 0x01, 0x80, 0xc0, 0x0f, 0x2e, 0xfc, 0x18, 0x66, 0xd4,
+    0x57, 0x7a, 0xf3, 0x41, 0x82, 0x11, 0x42, 0xdf, 0x47, 0x8d, 0xb4, 0xf6, 0x83, 0x5c, 0xcf, 0x09,
+    0x16, 0xe4, 0x90, 0xeb, 0xdf, 0xf1, 0xb9, 0xe7, 0xf3, 0x22, 0x1c, 0x85, 0xd1, 0xec, 0xb3, 0x5a,
+    0x2d, 0xa1, 0xb1, 0x7b, 0x80, 0x90, 0x24, 0xed, 0xe2, 0x46, 0xa0, 0x2c, 0x85, 0x43, 0xa0, 0xba,
+    0xaf, 0xd7, 0x96, 0x87, 0x85, 0x8d, 0x80, 0x37, 0x61, 0xdb, 0x43, 0xb1, 0x4d, 0x90, 0x25, 0xe6,
+    0xf7, 0x67, 0x0b, 0x3e, 0xfb, 0xc8, 0x2d, 0xf6, 0xa3, 0xc2, 0x59, 0x9d, 0x35, 0xed, 0xfc, 0x7c,
+    0x70, 0xb6, 0x57, 0xa1, 0x7a, 0x42, 0x3b, 0xa1, 0x03, 0xd7, 0x80, 0x37, 0x5d, 0x82, 0x8c, 0xf1,
+    0x7f, 0x18, 0x48, 0x5b, 0x43, 0xc3, 0xb3, 0x16, 0xb5, 0x87, 0x8d, 0x57, 0x62, 0xb1, 0x28, 0x9e,
+    0x34, 0x56, 0x4e, 0xea, 0xb7, 0xae, 0x17, 0xf2, 0x69, 0x10, 0x9a, 0xe1, 0x3a, 0x88, 0x06, 0x1b,
+    0x50, 0x36, 0x0e, 0xaa, 0xd9, 0xea, 0xf2, 0x65, 0xa9, 0x85, 0x68, 0x9f, 0xb5, 0xf3, 0xea, 0x9d,
+    0x51, 0xaa, 0xf8, 0x62, 0xf7, 0x07, 0x76, 0xc5, 0x1f, 0xd8, 0x18, 0xc7, 0xb8, 0x00, 0xa0, 0xfa,
+    0xec, 0x1d, 0x7f, 0x02, 0x4b, 0xc1, 0x7e, 0xd8, 0x4d, 0x90, 0x99, 0xad, 0x03, 0x80, 0x32, 0x5d,
+    0x9a, 0xab, 0x15, 0xa8, 0xfb, 0x34, 0xb2, 0xaa, 0xb1, 0xee, 0xb9, 0x9e, 0x9b, 0xd6, 0x96, 0x8f,
+    0xfc, 0x09, 0x6c, 0x2f, 0x98, 0x8f, 0xbf, 0xe2, 0x67, 0xf8, 0x2f, 0xae, 0x80, 0xef, 0x06, 0xa9,
+    0x57, 0xf8, 0x64, 0x27, 0xe4, 0xcb, 0x15, 0x32, 0x1d, 0x3b, 0x71, 0xbd, 0x74, 0x03, 0x54, 0xf4,
+    0x15, 0x37, 0x43, 0x63, 0xbf, 0xc9, 0x3a, 0x73, 0xbf, 0x91, 0xa9, 0x62, 0xae, 0x84, 0xb9, 0x4c,
+    0x3d, 0x55, 0x07, 0x0b, 0x32, 0x6a, 0xf1, 0xdb, 0x0c, 0x7e, 0x40, 0xcd, 0x0e, 0x48, 0xe1, 0x32,
+    0x83, 0x63, 0x81, 0xf9, 0x4a, 0x95, 0x89, 0x2d, 0x69, 0xae, 0xf5, 0x6c, 0xaf, 0x66, 0xdf, 0x6b,
+    0xbc, 0x82, 0x8d, 0xf8, 0x45, 0x03, 0x47, 0x76, 0x10, 0x8b, 0x07, 0x0a, 0x21, 0x18, 0xed, 0xd6,
+    0x4b, 0x14, 0x8c, 0x22, 0x28, 0xb1, 0x9d, 0x4d, 0x55, 0xf9, 0x09, 0xab, 0xc4, 0xe4, 0x74, 0x55,
+    0x6b, 0xa9, 0x1d, 0x69, 0xdb, 0x45, 0x42, 0xa4, 0x08, 0xd0, 0xc5, 0xd9, 0x35, 0xdb, 0x65, 0x97,
+    0x9e, 0xc5, 0x2e, 0xcd, 0xd0, 0xb7, 0xc1, 0xa5, 0xf0, 0x1e, 0x02, 0x55, 0x9e, 0x5a, 0x4b, 0xcf,
+    0xda, 0x81, 0x87, 0xaa, 0x08, 0x91, 0x44, 0x14, 0x49, 0x01, 0xf4, 0x7d, 0xf4, 0xdf, 0x20, 0xe9,
+    0x76, 0x46, 0x7c, 0x24, 0xea, 0x82, 0xac, 0x8f, 0x95, 0x1e, 0x4e, 0x3f, 0xe7, 0x9b, 0x8e, 0xc6,
+    0xcd, 0xf8, 0x81, 0x7e, 0x00, 0x2d, 0x23, 0xbf, 0xb5, 0xf2, 0x79, 0xc0, 0xc3, 0xe7, 0x50, 0xa2,
+    0x52, 0xa1, 0x07, 0xa8, 0xa2, 0x83, 0x42, 0x43, 0xd8, 0xa4, 0x47, 0xf0, 0xad, 0x06, 0xeb, 0xed,
+    0x06, 0x65, 0x15, 0x93, 0xbb, 0x35, 0xd0, 0xee, 0x36, 0xd9, 0xb7, 0x81, 0xf9, 0x89, 0x4f, 0x13,
+    0x53, 0xa0, 0xe2, 0x83, 0x8a, 0x26, 0xc7, 0x52, 0x4d, 0x4b, 0x8a, 0xab, 0x18, 0xd9, 0x0a, 0x8d,
+    0x9e, 0xb0, 0xf4, 0xd8, 0x90, 0x1b, 0x18, 0x15, 0xe3, 0x18, 0xcc, 0xbc, 0x15, 0xa0, 0x62, 0xba,
+    0x9f, 0xcc, 0x20, 0xeb, 0xe5, 0x44, 0xe2, 0xdb, 0xe9, 0x15, 0xa1, 0x43, 0x7e, 0xb6, 0x8e, 0x49,
+    0x1b, 0xbc, 0x4a, 0x0d, 0x03, 0x52, 0xc6, 0xa6, 0x97, 0x73, 0x2a, 0xff, 0x67, 0x58, 0x72, 0xb8,
+    0x2b, 0x67, 0x28, 0x87, 0xbb, 0x62, 0x96, 0x74, 0x88, 0x53, 0x14, 0x39, 0x79, 0xb1, 0xec, 0x4f,
+    0x6c, 0xe6, 0x98, 0x41, 0x70, 0x54, 0x8b, 0xa7, 0x10, 0xb5, 0x64, 0x32, 0x73, 0xb8, 0xe8, 0x1c,
+    0x8f, 0xc6, 0x37, 0x7b, 0x5d, 0x76, 0xe3, 0x39, 0x4f, 0xab, 0x85, 0xe7, 0xda, 0x33, 0x36, 0x7e,
+    0x72, 0xc3, 0x05, 0x47, 0x13, 0xe1, 0x03, 0xc8, 0x8e, 0x52, 0x1a, 0xa1, 0xd9, 0xd6, 0x51, 0x4d,
+    0x19, 0x9d, 0x6a, 0xc7, 0x27, 0x6b, 0xdf, 0x07, 0xe5, 0x63, 0x57, 0xf0, 0xb0, 0x0f, 0xbf, 0x2e,
+    0x3f, 0xdc, 0x85, 0x82, 0xc7, 0x2f, 0xd2, 0xf5, 0x14, 0x2c, 0x62, 0xd7, 0x5c, 0xc1, 0x44, 0x60,
+    0xb3, 0x77, 0x7c, 0x43, 0x92, 0x17, 0x40, 0xc3, 0x7b, 0x99, 0x97, 0xd2, 0x82, 0x61, 0xfb, 0x42,
+    0x3c, 0xa7, 0x81, 0xe3, 0x85, 0xb5, 0x63, 0xa0, 0x9f, 0xde, 0x64, 0x8a, 0x2b, 0x6d, 0x26, 0xd2,
+    0x9c, 0x69, 0x90, 0x0a, 0x0a, 0x9f, 0x4e, 0x51, 0x35, 0xb5, 0x09, 0x9c, 0x40, 0xd6, 0x70, 0xc6,
+    0xe5, 0x70, 0xf7, 0x1e, 0x66, 0x8c, 0xb5, 0x4e, 0xaf, 0xc6, 0x40, 0xa9, 0x67, 0x7c, 0x01, 0x83,
+    0x2e, 0xf7, 0x8f, 0x6a, 0x57, 0x58, 0x42, 0x03, 0x56, 0xe8, 0x0d, 0xf3, 0xdc, 0x99, 0x63, 0xcf,
+    0x3e, 0x1e, 0xd5, 0x40, 0x6c, 0x7c, 0x2e, 0xa8, 0x33, 0x1a, 0xb5, 0xe3, 0x31, 0xde, 0x1e, 0xee,
+    0x8a, 0x52, 0x15, 0xaa, 0xfb, 0x1c, 0x1c, 0x54, 0x27, 0xa9, 0x7f, 0x4b, 0xf7, 0x5b, 0x00, 0xe0,
+    0xbe, 0x19, 0x28, 0xed, 0x8f, 0xf0, 0x56, 0x5f, 0x5d, 0x76, 0x5f, 0xe6, 0xf6, 0x59, 0xbd, 0x39,
+    0x3c, 0x1d, 0xdf, 0xb2, 0x91, 0xfb, 0x89, 0x3b, 0xa0, 0xb1, 0xcc, 0x18, 0xee, 0x9e, 0xee, 0xde,
+    0x82, 0x6d, 0x03, 0xf3, 0x0b, 0x35, 0xad, 0xa0, 0xc9, 0xc6, 0xcc, 0x0e, 0x58, 0x7b, 0xa7, 0xd3,
+    0xd0, 0x74, 0x38, 0x0d, 0x7c, 0xc7, 0xc3, 0x30, 0x04, 0xfd, 0x61, 0x13, 0x7b, 0x89, 0x00, 0x1a,
+    0x7d, 0x10, 0x84, 0x95, 0xe9, 0x52, 0x1f, 0x99, 0x56, 0xe0, 0x4f, 0xcd, 0xe9, 0x27, 0xd3, 0x59,
+    0x43, 0x17, 0xb4, 0x5b, 0xed, 0x5e, 0x1b, 0x04, 0x07, 0x5f, 0x83, 0x50, 0x88, 0xda, 0x2f, 0x0a,
+    0xbb, 0x5a, 0x18, 0x79, 0x05, 0x0e, 0x74, 0xb3, 0xed, 0x1e, 0xd5, 0xda, 0xd4, 0xdd, 0x47, 0xb5,
+    0xbd, 0x36, 0x5c, 0x11, 0xe8, 0xa3, 0x5a, 0x0f, 0x2e, 0x41, 0x35, 0xb0, 0xf6, 0x51, 0x6d, 0xbd,
+    0xb2, 0xc0, 0xa6, 0x23, 0x65, 0x1f, 0xf0, 0xad, 0x51, 0x37, 0xeb, 0x4d, 0x16, 0x2e, 0xec, 0xa0,
+    0x45, 0xa5, 0xc1, 0x57, 0x0c, 0xb8, 0x6b, 0xe1, 0x7b, 0xe4, 0x73, 0x0a, 0x01, 0x1d, 0x7d, 0xa7,
+    0xd0, 0x91, 0x4f, 0x92, 0xbc, 0xd3, 0x3c, 0x79, 0x56, 0x42, 0x1e, 0x18, 0xb8, 0xe7, 0x93, 0x67,
+    0x95, 0x90, 0xd7, 0x69, 0x97, 0xd2, 0x67, 0x7d, 0x11, 0x7d, 0x63, 0x30, 0x98, 0x60, 0x76, 0xd8,
+    0x05, 0x07, 0x29, 0x60, 0xc6, 0x38, 0x4f, 0x62, 0x90, 0x90, 0xd8, 0x6b, 0x3f, 0x9b, 0xc0, 0x20,
+    0x43, 0x60, 0xa7, 0x72, 0xff, 0x05, 0x5f, 0x44, 0xdf, 0x2d, 0x18, 0x1f, 0x50, 0x25, 0xd9, 0x83,
+    0xb7, 0x79, 0xf2, 0x7c, 0x95, 0xbc, 0x2f, 0xe8, 0x41, 0x3f, 0x43, 0x60, 0x2f, 0x45, 0x60, 0x29,
+    0x85, 0x7e, 0x25, 0x0a, 0x33, 0x7a, 0xff, 0x2c, 0x85, 0xbf, 0x0e, 0x66, 0xb6, 0x03, 0x3e, 0x0f,
+    0xf8, 0x81, 0x9d, 0x22, 0x95, 0x46, 0x2f, 0xf1, 0xa8, 0xe6, 0x05, 0xb3, 0xce, 0xf4, 0x01, 0x86,
+    0xd4, 0xda, 0xf1, 0x2f, 0xf0, 0x4b, 0xf3, 0x2e, 0x3d, 0x53, 0x14, 0xc3, 0x9f, 0x54, 0x42, 0xc3,
+    0xb6, 0x40, 0x0e, 0x81, 0x65, 0x05, 0x62, 0x22, 0x10, 0x46, 0x27, 0x45, 0xa9, 0xce, 0x30, 0x7b,
+    0x2b, 0x9c, 0x71, 0x46, 0x9c, 0x03, 0xbe, 0x09, 0xf8, 0xdc, 0x3a, 0x1e, 0xdb, 0x38, 0x76, 0x89,
+    0xf7, 0x1b, 0x2b, 0x76, 0xc0, 0x86, 0xff, 0xb1, 0x36, 0xfd, 0xea, 0x35, 0xba, 0x50, 0xc3, 0x7c,
+    0x08, 0x3d, 0x2f, 0x5c, 0x54, 0xae, 0xb3, 0x57, 0x3b, 0x9e, 0xf8, 0x36, 0xd0, 0xe9, 0x54, 0x6f,
+    0x67, 0x1f, 0xdb, 0x01, 0xcf, 0xb3, 0xa0, 0x46, 0xc9, 0x78, 0x89, 0x2c, 0x0e, 0xa8, 0xea, 0x14,
+    0x07, 0x4b, 0x46, 0x8e, 0xc5, 0x51, 0x2d, 0x3d, 0xd1, 0xd3, 0xf1, 0x54, 0xe9, 0x57, 0x59, 0xdf,
+    0x76, 0x2d, 0xfe, 0x18, 0x21, 0xa2, 0xef, 0xd8, 0x6c, 0xe7, 0xa6, 0x6a, 0x2a, 0xfd, 0xfb, 0xc7,
+    0x9a, 0xaf, 0xf9, 0x8d, 0xe9, 0x9b, 0x4b, 0xe3, 0x66, 0x78, 0x3b, 0xbc, 0x6c, 0x8d, 0x87, 0x97,
+    0x37, 0x17, 0xa3, 0x26, 0x38, 0x5b, 0x7e, 0xc0, 0xcf, 0xdd, 0xd0, 0x50, 0x7a, 0xbc, 0x51, 0xe8,
+    0x10, 0xa4, 0xa5, 0x5b, 0xd1, 0xe0, 0x37, 0x26, 0xc6, 0x4e, 0x13, 0xad, 0xbd, 0x87, 0x7b, 0xa1,
+    0xb3, 0x53, 0xe8, 0xe4, 0x4e, 0xab, 0xfd, 0x2c, 0xa3, 0x44, 0xa2, 0x8a, 0xa0, 0x4a, 0xec, 0x92,
+    0xce, 0xf0, 0x22, 0x36, 0x42, 0x6d, 0x3b, 0x1a, 0xa5, 0xc5, 0xb7, 0xc5, 0x32, 0xfe, 0x25, 0x43,
+    0xf5, 0x7b, 0xd7, 0x0e, 0x40, 0x86, 0x0c, 0x55, 0x83, 0x8b, 0x47, 0xe5, 0x0f, 0x9e, 0x3d, 0xe3,
+    0x81, 0xca, 0xb5, 0x35, 0xd5, 0x9f, 0x7e, 0xa2, 0x17, 0x91, 0xc9, 0xeb, 0x3c, 0x87, 0x73, 0x29,
+    0x48, 0x92, 0x7b, 0x1d, 0xc9, 0xbd, 0x97, 0x09, 0xef, 0x72, 0x9c, 0x13, 0x14, 0x10, 0xef, 0x02,
+    0x43, 0xf2, 0x4b, 0x3c, 0xab, 0x38, 0x10, 0x87, 0x6b, 0x97, 0x6b, 0x48, 0xb2, 0xe8, 0x45, 0x44,
+    0x52, 0xb7, 0x4d, 0x73, 0xcd, 0xe0, 0x0b, 0x28, 0x13, 0x00, 0x4b, 0xe4, 0xa2, 0xdb, 0xfe, 0xda,
+    0xc4, 0x8d, 0x61, 0xc2, 0xc0, 0x3d, 0x36, 0x06, 0xb7, 0xd6, 0xb4, 0x34, 0x34, 0x06, 0xf4, 0xe2,
+    0x4b, 0x07, 0xe2, 0x14, 0xb0, 0xed, 0xc6, 0xe3, 0x8a, 0xf4, 0x7d, 0x89, 0x84, 0x2b, 0x92, 0xdd,
+    0xdd, 0x38, 0x36, 0x75, 0x9f, 0x33, 0x36, 0x75, 0xcb, 0xc7, 0xa6, 0xee, 0xff, 0xb3, 0xb1, 0xa9,
+    0xc0, 0x10, 0x6f, 0xb4, 0xba, 0x5d, 0x72, 0xe6, 0x9f, 0x6b, 0x75, 0xbb, 0x9b, 0xac, 0x6e, 0x99,
+    0xcd, 0xed, 0x16, 0xd9, 0xdc, 0xd2, 0xbe, 0xd3, 0xd1, 0x77, 0x3d, 0x3e, 0x61, 0x5d, 0x98, 0xfb,
+    0x98, 0x77, 0x30, 0xfe, 0xb1, 0xa2, 0x21, 0x53, 0x8a, 0xae, 0x58, 0x5e, 0xd0, 0x48, 0x44, 0x8e,
+    0x56, 0x8a, 0x5f, 0xdf, 0x79, 0x8f, 0x0a, 0xb9, 0x9c, 0xda, 0xc8, 0x4a, 0x1d, 0x48, 0x7b, 0x77,
+    0xe2, 0xdd, 0x43, 0xe7, 0x88, 0xe1, 0x51, 0x06, 0xbe, 0x1b, 0x45, 0x8d, 0x50, 0x47, 0x44, 0xe8,
+    0x50, 0xc8, 0x9a, 0x46, 0x52, 0xec, 0x81, 0x3c, 0xf2, 0xda, 0x2e, 0xc9, 0x3e, 0xfc, 0x1a, 0xfe,
+    0xe4, 0xd9, 0x65, 0x6a, 0x44, 0xea, 0xb2, 0xa5, 0x67, 0xad, 0x31, 0xa6, 0x16, 0xb0, 0x4a, 0x03,
+    0x95, 0xd0, 0xe7, 0xf9, 0x72, 0x0a, 0xf5, 0x40, 0x9b, 0x2f, 0xe1, 0x77, 0xb3, 0x26, 0x47, 0xc5,
+    0x33, 0x1c, 0x3d, 0xbb, 0x34, 0xb6, 0x54, 0xda, 0x4b, 0xfb, 0x11, 0xd0, 0x1f, 0x9f, 0x74, 0xd8,
+    0x8f, 0x0c, 0xfe, 0x74, 0x1b, 0xdb, 0x68, 0x30, 0x90, 0xbe, 0xcb, 0x6e, 0x16, 0x38, 0xb7, 0xb8,
+    0x14, 0x44, 0xc3, 0xfb, 0x67, 0x28, 0xda, 0x2d, 0x56, 0x54, 0x35, 0x0d, 0xc8, 0xf3, 0xf1, 0x59,
+    0x3c, 0x48, 0x3f, 0x53, 0xd7, 0x22, 0x38, 0x99, 0x21, 0x7a, 0xaf, 0x5b, 0x4b, 0x3c, 0xd1, 0xac,
+    0xa6, 0x9d, 0x5d, 0xa6, 0x4d, 0xbc, 0x86, 0xa7, 0x3a, 0x1a, 0xce, 0xd1, 0x27, 0xcc, 0xd0, 0x40,
+    0x7e, 0x62, 0x3c, 0x2a, 0xb7, 0x9e, 0x4b, 0x82, 0x74, 0x37, 0xb7, 0x19, 0x8b, 0x37, 0x10, 0xf1,
+    0x35, 0xe4, 0xfe, 0xe2, 0xec, 0x5a, 0x17, 0x03, 0x8b, 0x9c, 0x74, 0x67, 0xee, 0xa1, 0x87, 0x1e,
+    0xa0, 0x8a, 0xea, 0x82, 0x35, 0x5f, 0xd4, 0x76, 0x22, 0x6d, 0x51, 0x04, 0xdf, 0x18, 0x7b, 0x6b,
+    0x7f, 0xc6, 0x41, 0x1e, 0x4f, 0x79, 0x10, 0xda, 0xae, 0x78, 0x89, 0x77, 0xab, 0x70, 0xd1, 0x28,
+    0xc1, 0x13, 0xd4, 0xe8, 0xef, 0xc3, 0x73, 0xe8, 0xaf, 0xf8, 0xfd, 0xbd, 0x4d, 0x16, 0x60, 0x97,
+    0x81, 0x87, 0xb3, 0x62, 0x63, 0x0e, 0x93, 0x05, 0x77, 0x46, 0x81, 0xcb, 0xbd, 0xe2, 0x80, 0xa0,
+    0x0c, 0xfa, 0xd7, 0x36, 0xcc, 0x47, 0xf8, 0x1f, 0x5a, 0x3b, 0x10, 0x37, 0x62, 0x14, 0x1a, 0xd3,
+    0x62, 0x93, 0x70, 0x3d, 0x9f, 0x17, 0x1b, 0x01, 0xbd, 0x21, 0x50, 0xe8, 0xdc, 0xaa, 0x2a, 0x8e,
+    0xe9, 0x19, 0xa6, 0x14, 0x5a, 0x1f, 0xad, 0x01, 0xc9, 0x32, 0xc4, 0xf4, 0x57, 0x5f, 0x9f, 0x21,
+    0xef, 0x57, 0xdb, 0xf2, 0xe3, 0xd4, 0x7b, 0x70, 0xb7, 0x65, 0xc4, 0xad, 0xe9, 0x5a, 0xde, 0x72,
+    0xab, 0x5a, 0xe0, 0xde, 0x9c, 0x2c, 0x3c, 0xdf, 0xfa, 0x52, 0xae, 0xa1, 0x18, 0x89, 0xe8, 0x71,
+    0x29, 0xdf, 0xb6, 0x9c, 0xb5, 0xca, 0xc9, 0x36, 0xc0, 0xc6, 0x55, 0x26, 0x0f, 0x5c, 0x31, 0xfc,
+    0xa3, 0x9a, 0xc8, 0xf8, 0x5d, 0x6c, 0xe7, 0xbb, 0x91, 0x8d, 0x64, 0xaf, 0x6f, 0x2e, 0xb7, 0xb2,
+    0x93, 0x49, 0x3b, 0xc2, 0x50, 0x76, 0xb5, 0x61, 0x44, 0x8d, 0xa9, 0x8c, 0x49, 0x4c, 0x5b, 0xcc,
+    0x62, 0x89, 0xc9, 0x52, 0x77, 0x0f, 0x40, 0x6a, 0xe0, 0x2c, 0x86, 0x3c, 0x4b, 0x1b, 0xbe, 0x89,
+    0x48, 0x8b, 0xa7, 0x2b, 0xdf, 0x6d, 0x4d, 0x16, 0x35, 0x20, 0xa8, 0xea, 0x55, 0x9b, 0xaa, 0x6c,
+    0x4f, 0x93, 0x62, 0x7a, 0xa2, 0xa5, 0xf1, 0x04, 0x81, 0x00, 0x74, 0xb4, 0xd0, 0x40, 0x3e, 0xcb,
+    0x30, 0x8e, 0x31, 0x81, 0x0d, 0x6c, 0x37, 0x2d, 0xd7, 0xe7, 0x2d, 0x61, 0x21, 0xbf, 0x7d, 0x70,
+    0xff, 0xa7, 0xb8, 0xb6, 0x03, 0xfa, 0x02, 0x97, 0xb4, 0xa2, 0xc3, 0x8c, 0x93, 0x7d, 0x76, 0xf7,
+    0xc4, 0x2c, 0x3e, 0x37, 0xd7, 0x4e, 0xd8, 0xd8, 0xec, 0x3d, 0x25, 0x50, 0xb2, 0xe2, 0x8e, 0x68,
+    0xbd, 0x27, 0x16, 0xea, 0x1d, 0x29, 0xad, 0x06, 0x14, 0x4b, 0x07, 0x82, 0x9b, 0x62, 0x9f, 0xd6,
+    0x24, 0xc5, 0x13, 0xb8, 0xde, 0x8c, 0x9f, 0x52, 0x4f, 0x41, 0x10, 0xfe, 0x58, 0x0e, 0x27, 0x38,
+    0x08, 0xe6, 0x84, 0x1e, 0x6f, 0xed, 0xef, 0x99, 0xff, 0x84, 0xb1, 0xc8, 0x38, 0x95, 0xbc, 0xda,
+    0xc6, 0xdb, 0xbb, 0xb4, 0xdd, 0x32, 0xf3, 0x9e, 0xb7, 0x68, 0x37, 0xdc, 0x0d, 0x61, 0x48, 0xc0,
+    0x05, 0x3b, 0x6a, 0x76, 0x9b, 0x69, 0x9b, 0x5a, 0x77, 0xab, 0x76, 0xf7, 0x71, 0xb9, 0x0f, 0x17,
+    0x40, 0x77, 0xcf, 0x7c, 0x4e, 0x22, 0x56, 0xb9, 0x6a, 0x0f, 0xcd, 0xa9, 0xef, 0x2d, 0xc1, 0x77,
+    0x98, 0x31, 0xc3, 0x73, 0x39, 0x0b, 0xd7, 0xa0, 0x57, 0xf7, 0x0c, 0xe5, 0x9f, 0xad, 0xb8, 0xcf,
+    0x40, 0x35, 0x1a, 0x55, 0xfd, 0xdb, 0x2f, 0x51, 0x8f, 0x89, 0x68, 0xd7, 0xc0, 0xce, 0x36, 0x59,
+    0x2b, 0x98, 0x39, 0xe0, 0x3e, 0xb4, 0x3e, 0xde, 0x2d, 0xcb, 0x3c, 0x19, 0x81, 0x6c, 0xbc, 0xe8,
+    0xd9, 0xe9, 0xee, 0x4c, 0x46, 0x93, 0x4d, 0xd6, 0x79, 0xe6, 0x4c, 0xe7, 0xb6, 0x13, 0xcb, 0xa7,
+    0x81, 0x6d, 0x15, 0x69, 0x90, 0x6a, 0xa2, 0xa8, 0x92, 0x14, 0x56, 0x09, 0x82, 0x99, 0xb3, 0x19,
+    0x78, 0x5b, 0x47, 0x35, 0x84, 0x51, 0x62, 0x33, 0x81, 0x0c, 0xd9, 0xe6, 0x3b, 0xfe, 0x74, 0xe7,
+    0x99, 0xbe, 0x15, 0x19, 0x02, 0x68, 0x1e, 0x5e, 0x36, 0x99, 0x60, 0xb0, 0xb9, 0x25, 0x22, 0x31,
+    0xdc, 0x04, 0x11, 0x78, 0x54, 0x7b, 0xee, 0xa2, 0x6b, 0x76, 0x75, 0x72, 0xbd, 0x72, 0x3c, 0xd3,
+    0x12, 0x3d, 0x83, 0x5a, 0x77, 0x01, 0x77, 0x4c, 0xdc, 0x6e, 0xb5, 0x48, 0x0a, 0x4d, 0x26, 0x40,
+    0x6e, 0xf1, 0x96, 0x85, 0x1e, 0x8b, 0x7a, 0xeb, 0x6f, 0x5e, 0xed, 0x1c, 0x63, 0x5e, 0x82, 0x46,
+    0x86, 0x64, 0xa6, 0x82, 0xe8, 0xcf, 0x24, 0x75, 0xa1, 0x26, 0x32, 0x17, 0x40, 0xab, 0x0e, 0xc0,
+    0x88, 0x88, 0xc4, 0x05, 0x5c, 0x60, 0x6e, 0xe3, 0x60, 0x20, 0x8a, 0x3c, 0x97, 0xbd, 0x29, 0x73,
+    0x87, 0x2d, 0x8a, 0xe9, 0x6f, 0x15, 0xb7, 0x47, 0x44, 0xb0, 0x62, 0x93, 0x16, 0x05, 0xaf, 0xb6,
+    0x72, 0x9d, 0xe6, 0xf3, 0x10, 0x64, 0x7e, 0x05, 0x10, 0xfc, 0xf5, 0xf2, 0x59, 0xfe, 0x93, 0xec,
+    0xd9, 0x84, 0x00, 0xf1, 0xa0, 0x96, 0xf4, 0x75, 0x48, 0xb1, 0x0d, 0x62, 0xb9, 0x58, 0x4f, 0x37,
+    0xfd, 0xf0, 0x6f, 0xef, 0xe1, 0xd1, 0x27, 0xcc, 0x74, 0xb8, 0xf0, 0x40, 0x99, 0x6e, 0xf9, 0x0c,
+    0x9c, 0x43, 0xb0, 0x1c, 0xb7, 0x1c, 0x17, 0x47, 0xca, 0x6c, 0x07, 0xc7, 0x5a, 0x8e, 0x97, 0x58,
+    0x8f, 0x73, 0xcb, 0xe1, 0x3a, 0xdb, 0xf1, 0x6c, 0xf5, 0xa1, 0x16, 0x00, 0xad, 0x5b, 0xf4, 0x41,
+    0x82, 0xd0, 0xa8, 0xfb, 0x84, 0x5d, 0x5d, 0x24, 0x0a, 0x90, 0x13, 0x5b, 0x3d, 0x51, 0x20, 0x0b,
+    0x0b, 0xec, 0xfd, 0xaa, 0x2e, 0x52, 0x16, 0x56, 0x5f, 0x02, 0xc7, 0x27, 0x46, 0x09, 0x9c, 0xf0,
+    0x6a, 0x0b, 0x58, 0x0f, 0x30, 0x4b, 0xf7, 0x1e, 0x5a, 0x8e, 0x37, 0x13, 0x53, 0xcf, 0x23, 0x56,
+    0xdf, 0x8d, 0xb8, 0xba, 0x0b, 0x6f, 0x5c, 0xb4, 0x1e, 0x75, 0x31, 0x35, 0xc0, 0xcb, 0x4a, 0x82,
+    0x90, 0x35, 0x9d, 0x71, 0x37, 0x09, 0xfb, 0x89, 0xbd, 0x7c, 0x66, 0x93, 0xd9, 0xbe, 0xb3, 0xdd,
+    0xed, 0xac, 0x65, 0x1a, 0x54, 0x62, 0x32, 0x01, 0x50, 0x56, 0xaa, 0xf4, 0x96, 0x70, 0x24, 0x99,
+    0x87, 0xa2, 0xfd, 0x7e, 0xa5, 0x27, 0xa9, 0xba, 0x20, 0x13, 0x4e, 0xba, 0x2c, 0x4e, 0x8d, 0x88,
+    0x8b, 0xf1, 0x1d, 0xd3, 0x40, 0xd9, 0x30, 0x08, 0xec, 0x7b, 0x77, 0x89, 0xab, 0x1d, 0xcc, 0xd8,
+    0x7f, 0xdc, 0x97, 0xe1, 0x80, 0x46, 0xf9, 0xe4, 0x3a, 0xed, 0xe1, 0xc2, 0x1d, 0x36, 0x39, 0xa5,
+    0x27, 0x3a, 0x13, 0x90, 0xef, 0x12, 0x55, 0xf7, 0xd3, 0x29, 0x57, 0x8a, 0xfa, 0xa3, 0x43, 0x29,
+    0x50, 0x85, 0xe1, 0x8d, 0x0c, 0x00, 0x14, 0x65, 0x12, 0x79, 0xf2, 0x4b, 0x0a, 0xd8, 0x95, 0xe5,
+    0xdc, 0x61, 0x30, 0xf3, 0xed, 0x95, 0x62, 0x83, 0x80, 0x75, 0x41, 0xc8, 0xd0, 0x8b, 0x45, 0xff,
+    0x77, 0x2c, 0x2c, 0xe9, 0x11, 0xb3, 0xbc, 0xd9, 0x1a, 0x59, 0xd1, 0xba, 0xe7, 0xe1, 0xc8, 0xe1,
+    0x78, 0xf9, 0xfa, 0xe9, 0xdc, 0x02, 0xb1, 0x8e, 0xfc, 0xdd, 0xba, 0x92, 0xa0, 0x2a, 0x80, 0x04,
+    0x91, 0x3b, 0xb9, 0x19, 0x4a, 0xe2, 0x95, 0xe6, 0xc1, 0xcc, 0x22, 0x3a, 0xb1, 0xe3, 0xde, 0x50,
+    0xf6, 0x6d, 0x09, 0x24, 0x5d, 0x3f, 0xe7, 0x61, 0x42, 0xbf, 0x00, 0xc0, 0x37, 0x98, 0xa4, 0x5b,
+    0x02, 0x4b, 0xed, 0x3d, 0x15, 0x46, 0x92, 0xfa, 0xb9, 0xcb, 0x76, 0x76, 0x76, 0xc4, 0x4c, 0xe1,
+    0xd4, 0x0c, 0x4d, 0xbc, 0xcb, 0xb4, 0x74, 0x79, 0x7e, 0x7a, 0x3e, 0xbd, 0xba, 0x9e, 0x8c, 0xa6,
+    0x57, 0xc3, 0xcb, 0xd1, 0x18, 0x9a, 0xfb, 0x2d, 0xd5, 0xdf, 0xb5, 0x93, 0x5a, 0x13, 0x7e, 0xbe,
+    0xc5, 0xdf, 0x53, 0xfa, 0xa1, 0xcb, 0x11, 0xfe, 0x9c, 0xd1, 0x0f, 0xdd, 0xbf, 0xa1, 0x1f, 0xba,
+    0x1c, 0xd2, 0x0f, 0x5d, 0xbe, 0xae, 0xc5, 0xb0, 0x7e, 0xd7, 0xa0, 0x37, 0x5f, 0xbb, 0x33, 0x32,
+    0x18, 0x40, 0x18, 0xe2, 0x88, 0xc9, 0x5a, 0xc6, 0xd2, 0xb6, 0xec, 0x46, 0x26, 0xed, 0x57, 0xa0,
+    0x8a, 0xd9, 0x5e, 0x80, 0x5f, 0x06, 0xe3, 0xdf, 0xb0, 0x02, 0xfb, 0x0e, 0xbc, 0x88, 0xdf, 0x07,
+    0x9a, 0x4a, 0xde, 0x2c, 0x44, 0xd1, 0x3b, 0x42, 0xed, 0x58, 0xb4, 0xe6, 0x8e, 0xe7, 0xf9, 0xd4,
+    0x04, 0x0c, 0x0d, 0x9d, 0x6e, 0x83, 0xed, 0xb0, 0x4e, 0xba, 0x96, 0xcf, 0xc3, 0xb5, 0xef, 0x8a,
+    0xb6, 0x7e, 0x94, 0xb5, 0xd5, 0x2c, 0xe0, 0x2c, 0x6f, 0xdf, 0x9f, 0xb3, 0x73, 0xb1, 0x33, 0xc9,
+    0xfe, 0x53, 0x58, 0xbf, 0x33, 0x49, 0x55, 0x90, 0xe2, 0x76, 0x9e, 0xe8, 0x95, 0xb7, 0xa2, 0x58,
+    0xf9, 0xad, 0x94, 0x65, 0x98, 0xaa, 0x66, 0xc8, 0x86, 0x26, 0x6e, 0x64, 0x21, 0x92, 0x78, 0x86,
+    0x72, 0x1c, 0xb0, 0xb9, 0x8f, 0x4a, 0x04, 0x5c, 0x60, 0xfb, 0x2f, 0x61, 0x02, 0xb8, 0xd7, 0x40,
+    0x27, 0xea, 0xe5, 0x3e, 0x5c, 0x1e, 0x34, 0x52, 0xf5, 0x31, 0xdf, 0xd7, 0x70, 0xc0, 0xc9, 0x22,
+    0x82, 0x8f, 0xa0, 0xf8, 0x40, 0x5c, 0x1e, 0x1e, 0x41, 0x79, 0x71, 0xfd, 0xe3, 0x8f, 0xd9, 0x56,
+    0x15, 0xde, 0xad, 0xa4, 0x39, 0x8f, 0x25, 0x70, 0xe6, 0x73, 0x40, 0x46, 0x0a, 0xa1, 0x51, 0x17,
+    0x05, 0xea, 0x99, 0xd4, 0x6f, 0xfc, 0x27, 0xde, 0x88, 0xf5, 0x18, 0x00, 0x80, 0x2d, 0x15, 0x16,
+    0xc2, 0xb4, 0xbe, 0x13, 0xb1, 0x8b, 0x01, 0x8a, 0xe6, 0x64, 0x21, 0x5f, 0xcf, 0x9e, 0x33, 0xd1,
+    0x87, 0x47, 0x47, 0x47, 0xec, 0xa0, 0x0d, 0x04, 0x20, 0xab, 0x60, 0x26, 0x6c, 0x07, 0x82, 0x2f,
+    0x07, 0xed, 0x26, 0x5b, 0x9a, 0x1f, 0x39, 0xb3, 0xc1, 0xf8, 0x2f, 0x78, 0x34, 0x3d, 0x8e, 0xfd,
+    0x26, 0xad, 0x97, 0x24, 0xb1, 0x89, 0xca, 0x00, 0x2a, 0xe0, 0x1f, 0xf1, 0x7c, 0xeb, 0x9f, 0x73,
+    0x4f, 0xd2, 0xd6, 0xa8, 0x05, 0xaa, 0x8d, 0xe6, 0x6f, 0x61, 0x3b, 0x96, 0x21, 0x80, 0x66, 0x68,
+    0xf8, 0xac, 0xc9, 0x2a, 0x2f, 0x96, 0x8f, 0x77, 0xb1, 0x2d, 0xc8, 0x09, 0x08, 0xf6, 0x2d, 0x6e,
+    0xc1, 0xc3, 0x11, 0xb7, 0x3e, 0xc8, 0xca, 0xce, 0x1b, 0xee, 0x72, 0x1f, 0x65, 0xa7, 0x73, 0x80,
+    0x06, 0x85, 0x61, 0x56, 0x2c, 0xe5, 0x63, 0xeb, 0x85, 0x04, 0x25, 0xa4, 0x3d, 0x80, 0x3f, 0x87,
+    0x50, 0x01, 0xfe, 0xea, 0x25, 0x83, 0x9a, 0xfb, 0x11, 0xda, 0xcb, 0x0e, 0x2a, 0x51, 0x2e, 0x7b,
+    0xed, 0xb8, 0x3e, 0x28, 0xa9, 0x25, 0x46, 0xe9, 0x77, 0x75, 0x50, 0x2e, 0xc3, 0x86, 0x9f, 0x4e,
+    0x03, 0x7e, 0xea, 0xd1, 0xe8, 0x5d, 0x5a, 0x55, 0x71, 0x9b, 0xd1, 0xf2, 0x21, 0x08, 0x84, 0x50,
+    0x97, 0xe1, 0x0c, 0x0b, 0x0c, 0xdc, 0x0e, 0x62, 0x42, 0x6b, 0x06, 0x47, 0xb5, 0xf8, 0xbd, 0x16,
+    0xa3, 0xdc, 0x03, 0x55, 0xd9, 0x2c, 0xdf, 0x5b, 0xa1, 0xdf, 0x02, 0x53, 0x80, 0x70, 0x91, 0xd3,
+    0xba, 0xbd, 0x03, 0x50, 0xb5, 0x2e, 0x69, 0xdd, 0xcf, 0x78, 0xf9, 0x53, 0x23, 0x07, 0x2c, 0xab,
+    0x79, 0x7b, 0x07, 0x89, 0xe6, 0xfd, 0x7c, 0x50, 0xa6, 0x79, 0x8a, 0xb9, 0x93, 0x5a, 0x50, 0x4d,
+    0x27, 0xd2, 0xac, 0x4a, 0x3b, 0xfc, 0xc8, 0x09, 0x6a, 0x1d, 0x99, 0x51, 0xd7, 0xd7, 0xd5, 0x3e,
+    0x04, 0x9e, 0x8c, 0x81, 0x88, 0x48, 0x7d, 0x04, 0x23, 0x0c, 0xde, 0xba, 0x6f, 0x35, 0x59, 0x12,
+    0x2e, 0x00, 0xc5, 0xa3, 0xf1, 0xb1, 0x51, 0x04, 0xe3, 0x5d, 0xe7, 0xe8, 0x64, 0xdf, 0x00, 0x45,
+    0x6d, 0xb2, 0x77, 0xdd, 0xa3, 0x93, 0x6f, 0xe1, 0xba, 0x03, 0xd7, 0xad, 0x56, 0x4b, 0x5b, 0x23,
+    0xa5, 0xde, 0x50, 0x0d, 0xfb, 0xb1, 0x51, 0xc4, 0xab, 0x14, 0xdd, 0xb1, 0x82, 0x17, 0x10, 0xf9,
+    0xb9, 0x3a, 0xe9, 0x31, 0xcc, 0x63, 0xe4, 0x5e, 0xdc, 0x17, 0x24, 0xab, 0x72, 0xc6, 0x54, 0xaf,
+    0x62, 0x1b, 0x92, 0x3e, 0x89, 0xa6, 0x53, 0xa5, 0x32, 0x4e, 0xae, 0x4f, 0xbd, 0xc8, 0x5c, 0xe0,
+    0xbf, 0xc4, 0x35, 0x68, 0xd9, 0x2e, 0x28, 0xf8, 0xdb, 0xc9, 0xe5, 0x05, 0x88, 0x08, 0x82, 0x28,
+    0x1b, 0xa7, 0xca, 0x96, 0x63, 0x70, 0x10, 0x53, 0xc7, 0xaa, 0x5d, 0x5c, 0x3b, 0x12, 0x5d, 0xbe,
+    0x32, 0xc3, 0x90, 0xc3, 0x78, 0x08, 0x3d, 0x3d, 0x5b, 0x40, 0xe7, 0xc7, 0x75, 0xfa, 0x7d, 0x25,
+    0xa2, 0x0a, 0x8e, 0x1f, 0xd9, 0xd9, 0x00, 0x73, 0xd3, 0x33, 0x0e, 0xc6, 0x78, 0xf4, 0x9f, 0xd3,
+    0xd3, 0xd1, 0xd9, 0xf0, 0xfd, 0xc5, 0x84, 0x46, 0x6d, 0x72, 0x31, 0xd0, 0x40, 0x1f, 0xec, 0xc3,
+    0x7f, 0x3f, 0x35, 0xd9, 0x4f, 0x38, 0x70, 0x17, 0x9b, 0x3f, 0xb5, 0x99, 0xbc, 0xf5, 0x13, 0xa1,
+    0xfb, 0x40, 0x63, 0x00, 0x63, 0x15, 0xc4, 0x01, 0xac, 0x33, 0x80, 0x3f, 0xa0, 0x7b, 0x68, 0xd8,
+    0x5c, 0xbd, 0xe2, 0x45, 0x90, 0x0a, 0xf4, 0xc7, 0x15, 0xca, 0x83, 0x66, 0xcb, 0x25, 0xc1, 0x04,
+    0xa3, 0xfa, 0x4a, 0x95, 0x38, 0xd6, 0x07, 0x14, 0xc8, 0x98, 0x1d, 0xc7, 0xe5, 0x29, 0x7a, 0x16,
+    0x14, 0x09, 0x4c, 0xba, 0x5f, 0x8b, 0x7d, 0xcf, 0x78, 0x85, 0xa2, 0xde, 0x48, 0x75, 0xb9, 0xc4,
+    0x58, 0x61, 0xde, 0x86, 0x31, 0x61, 0x4b, 0x53, 0x2f, 0xfa, 0x4f, 0x2a, 0x3f, 0xf9, 0x90, 0x47,
+    0x68, 0xb3, 0xbf, 0x63, 0x5d, 0x62, 0x00, 0x8c, 0xbb, 0xaf, 0xf2, 0xbd, 0xfb, 0x9b, 0x81, 0xae,
+    0x15, 0x58, 0xc7, 0xef, 0xd8, 0xfe, 0xef, 0xc0, 0x93, 0x9d, 0xce, 0xe0, 0x6f, 0x1a, 0x43, 0xc6,
+    0x5f, 0x38, 0x86, 0x60, 0xdf, 0x24, 0x83, 0x48, 0x2e, 0x1c, 0x0e, 0x6f, 0x8d, 0xf8, 0x6d, 0x63,
+    0x03, 0x46, 0x69, 0x79, 0xd9, 0xe9, 0x08, 0x41, 0x51, 0x59, 0x77, 0xc8, 0xda, 0x85, 0xf2, 0x72,
+    0x0b, 0x13, 0xf0, 0x32, 0xab, 0xf2, 0x65, 0xa3, 0x49, 0xb5, 0x51, 0x01, 0xf1, 0x8d, 0x8d, 0xae,
+    0x8a, 0x78, 0x99, 0x90, 0xe7, 0xfd, 0xf6, 0xaf, 0x60, 0x1f, 0x2b, 0xd8, 0xc0, 0x52, 0x5d, 0x21,
+    0x9d, 0xcb, 0xa8, 0x4a, 0xa1, 0x75, 0x8c, 0xcd, 0x4d, 0xc1, 0xe2, 0x51, 0x76, 0x8f, 0x64, 0x59,
+    0xc3, 0xca, 0x72, 0x1e, 0x34, 0x9f, 0xf6, 0x6a, 0x37, 0x57, 0x84, 0x2a, 0x54, 0x75, 0x50, 0xbd,
+    0xc1, 0x64, 0x8d, 0x6d, 0xbb, 0xf6, 0xb0, 0x5e, 0xbe, 0x39, 0x1d, 0x57, 0x32, 0x2b, 0x67, 0x19,
+    0x6e, 0xe4, 0x53, 0x7f, 0xc1, 0x1a, 0x4c, 0x46, 0x97, 0x37, 0xd7, 0x4a, 0xf6, 0x6f, 0x75, 0xca,
+    0x1b, 0x19, 0xb7, 0x46, 0x0b, 0xfe, 0xcd, 0x70, 0x32, 0xaa, 0x0a, 0x5d, 0xa5, 0xb3, 0x12, 0xf0,
+    0x8b, 0xd1, 0xd5, 0x9b, 0xc9, 0xdb, 0xaa, 0xe0, 0x63, 0xa3, 0x5c, 0xad, 0x81, 0xe1, 0xed, 0xcd,
+    0xf4, 0xf2, 0xfa, 0xb4, 0x12, 0xf6, 0xd1, 0x5a, 0xfe, 0x56, 0xd8, 0x57, 0x05, 0x1e, 0x65, 0x4e,
+    0xe8, 0x80, 0xa7, 0x1d, 0x87, 0x21, 0x4c, 0x87, 0x29, 0x1a, 0x01, 0x1a, 0x45, 0x03, 0x3c, 0xfa,
+    0x41, 0xcc, 0x74, 0x2d, 0x12, 0x8c, 0x80, 0xe1, 0xce, 0x21, 0xdc, 0x69, 0xcf, 0xda, 0x05, 0xa2,
+    0x83, 0x46, 0x14, 0xf5, 0xb1, 0x60, 0x42, 0x2f, 0xc6, 0x94, 0x0a, 0x18, 0x47, 0xa6, 0x9a, 0x60,
+    0x45, 0xe9, 0x7f, 0x2f, 0xb2, 0x4e, 0x23, 0xc1, 0x3b, 0xa6, 0x91, 0x49, 0xcb, 0x20, 0x1c, 0xa0,
+    0x24, 0x90, 0x26, 0x35, 0x5e, 0x85, 0xab, 0x1f, 0x46, 0x17, 0xd7, 0x27, 0xe7, 0x93, 0x5f, 0x53,
+    0x15, 0xa9, 0x15, 0x30, 0x8d, 0x9d, 0x76, 0x1b, 0x4c, 0x62, 0xbb, 0x51, 0xe6, 0x79, 0xe5, 0x76,
+    0xdc, 0x66, 0xbc, 0x2d, 0xc1, 0x8b, 0xab, 0xf7, 0x97, 0x53, 0x28, 0x89, 0xde, 0xd1, 0x7e, 0x36,
+    0x1a, 0x74, 0x39, 0xfc, 0x07, 0x76, 0xee, 0x74, 0x7c, 0x71, 0x3d, 0xc1, 0x02, 0x07, 0xd9, 0x02,
+    0x50, 0x71, 0x3a, 0x7e, 0x3b, 0xbc, 0x11, 0xce, 0x55, 0x0d, 0xb3, 0x51, 0x31, 0xfc, 0x12, 0xe5,
+    0x7f, 0xe2, 0xf5, 0xd8, 0x7c, 0xa0, 0x3f, 0x94, 0x78, 0x5a, 0xfb, 0x3d, 0xd7, 0x04, 0x82, 0xbf,
+    0x7e, 0x7f, 0x7b, 0x22, 0x41, 0xe0, 0x46, 0x41, 0x2c, 0x8f, 0xc8, 0x77, 0xa2, 0x8b, 0x6e, 0x74,
+    0xb1, 0x17, 0x5d, 0xec, 0x53, 0x2c, 0x48, 0xee, 0x20, 0xc3, 0x6b, 0x98, 0xac, 0xe2, 0x1f, 0xa4,
+    0xf6, 0x97, 0x05, 0xe7, 0x8e, 0xbe, 0xa5, 0xd3, 0xd1, 0x78, 0x92, 0x6e, 0xe7, 0x86, 0x32, 0x2c,
+    0xe1, 0x82, 0xf2, 0xf1, 0x30, 0xa7, 0x53, 0xde, 0x74, 0xe3, 0x9b, 0x1b, 0xd3, 0xad, 0x69, 0x3d,
+    0x45, 0x31, 0xdc, 0x5c, 0xd8, 0x41, 0x68, 0x60, 0xd8, 0x26, 0xd8, 0x62, 0x96, 0x4c, 0xe5, 0x5b,
+    0x30, 0xbe, 0x8e, 0xcc, 0xd9, 0xc2, 0xa0, 0xea, 0x4d, 0x98, 0x6c, 0xb0, 0xa3, 0x63, 0x3c, 0xf3,
+    0xa2, 0x64, 0xe0, 0x8c, 0x26, 0x96, 0xe8, 0xe9, 0xe5, 0xe7, 0x05, 0xec, 0x73, 0x43, 0x1b, 0x55,
+    0xda, 0x3c, 0x0c, 0x45, 0x5e, 0x6f, 0x92, 0xe5, 0xb5, 0xe5, 0xa4, 0x1f, 0x7b, 0x85, 0x26, 0xfd,
+    0xf2, 0xf8, 0x05, 0x3b, 0xc0, 0x1d, 0x7d, 0x8b, 0xb5, 0x6b, 0xf9, 0xdc, 0x42, 0xff, 0xd6, 0x9b,
+    0x33, 0x93, 0xbd, 0xfd, 0x93, 0x19, 0xb8, 0x23, 0x8f, 0xed, 0xb0, 0x6e, 0x1b, 0xee, 0x1a, 0x1b,
+    0xfd, 0xc4, 0x48, 0x3e, 0xb7, 0x0b, 0x0c, 0xc4, 0xa9, 0x5c, 0x15, 0xfc, 0x39, 0xc4, 0x3c, 0xe3,
+    0xd2, 0xa9, 0x49, 0x25, 0x98, 0x54, 0x97, 0x4c, 0xf9, 0x95, 0xe4, 0x48, 0x40, 0x3f, 0x93, 0x5c,
+    0x58, 0xd5, 0x03, 0x4c, 0x83, 0x0c, 0x16, 0xe6, 0x2a, 0x97, 0x15, 0x01, 0x48, 0xa5, 0xbd, 0x40,
+    0x0c, 0x0a, 0x26, 0xf2, 0x96, 0x28, 0x9e, 0x74, 0x7d, 0xaa, 0xcc, 0xf1, 0x0a, 0xd2, 0x5d, 0xd2,
+    0xd8, 0xf8, 0xf9, 0xc4, 0x97, 0x6e, 0x7b, 0xc3, 0xe6, 0x14, 0xc0, 0x46, 0x6e, 0x29, 0x8b, 0x31,
+    0x16, 0xc9, 0x2f, 0x39, 0x2a, 0xbe, 0x6c, 0x0a, 0x5a, 0x68, 0xa7, 0xa3, 0xc4, 0x47, 0xad, 0xf7,
+    0xf5, 0x22, 0xd7, 0x5c, 0xb5, 0x19, 0x4a, 0xca, 0xfa, 0xfd, 0x1d, 0xe2, 0xa7, 0x48, 0x04, 0x66,
+    0x44, 0x2a, 0x12, 0xe1, 0xcf, 0xb2, 0xf2, 0x00, 0x7a, 0x59, 0x26, 0x0f, 0x8a, 0x19, 0xdd, 0x42,
+    0x20, 0x0a, 0x11, 0xb0, 0x82, 0xf0, 0x19, 0x08, 0x90, 0x75, 0xfd, 0x72, 0x79, 0xcc, 0xa0, 0x82,
+    0xc9, 0xa4, 0x52, 0x20, 0x77, 0x48, 0xf8, 0x4a, 0x33, 0xf7, 0xb5, 0xa8, 0xfe, 0x4d, 0x52, 0x17,
+    0xa5, 0xb1, 0x3e, 0xd3, 0xe7, 0x8f, 0xb5, 0x06, 0xa4, 0x57, 0xef, 0xa7, 0x90, 0x3d, 0xad, 0xe2,
+    0xa7, 0x44, 0x2a, 0x0c, 0x7f, 0x63, 0x25, 0x8e, 0xbd, 0x2c, 0x5c, 0x71, 0x68, 0x83, 0xd1, 0x1d,
+    0x54, 0xd7, 0x25, 0x15, 0x96, 0xde, 0xcf, 0xc7, 0x16, 0x5a, 0xa1, 0x77, 0x66, 0x3f, 0x72, 0xcb,
+    0xe8, 0x52, 0xa7, 0x83, 0x3d, 0xac, 0x6f, 0xf6, 0xea, 0xd1, 0x24, 0xfc, 0x5b, 0x08, 0x96, 0x6b,
+    0x6f, 0x68, 0x6c, 0xcb, 0xe6, 0x29, 0x59, 0xc8, 0x54, 0x21, 0x99, 0xb4, 0x94, 0xfb, 0x6d, 0x68,
+    0x96, 0x6f, 0x87, 0xe4, 0xec, 0x41, 0xfd, 0x26, 0xd1, 0xb3, 0xc9, 0xd7, 0x8b, 0x4d, 0x79, 0x54,
+    0x29, 0xa6, 0x9e, 0x9a, 0x2e, 0x70, 0x92, 0x53, 0x3c, 0x45, 0x81, 0xc7, 0x53, 0x0f, 0xf4, 0x4c,
+    0x05, 0x6b, 0x52, 0x46, 0x70, 0xa4, 0x6e, 0x08, 0x20, 0xb2, 0x3e, 0xfa, 0x39, 0xa1, 0x8c, 0xcb,
+    0x04, 0xe1, 0x56, 0xe0, 0xa0, 0x7c, 0x29, 0x38, 0xd4, 0xef, 0xed, 0x00, 0x62, 0x8d, 0xaa, 0x3d,
+    0x92, 0x18, 0x46, 0x09, 0x42, 0xe5, 0xaf, 0x3f, 0xdb, 0x38, 0xbf, 0x89, 0xec, 0x5a, 0xbe, 0x36,
+    0xd0, 0x55, 0xb1, 0xf6, 0xcd, 0xe4, 0xad, 0xa6, 0x3a, 0x25, 0xc9, 0x47, 0xa2, 0x5a, 0xea, 0xc8,
+    0x8b, 0xf4, 0x92, 0xb7, 0x94, 0x8a, 0xe8, 0x07, 0xec, 0x7b, 0x36, 0x86, 0x3e, 0xc7, 0xd4, 0xad,
+    0x78, 0x69, 0x55, 0xad, 0x21, 0xcb, 0xd1, 0x90, 0x86, 0x9b, 0xb9, 0x33, 0x6e, 0xb0, 0x49, 0x07,
+    0x27, 0x8c, 0x85, 0x93, 0x56, 0xc2, 0x76, 0x71, 0xfa, 0x41, 0x7e, 0x85, 0xd8, 0xc2, 0x83, 0x09,
+    0x2a, 0x56, 0xb7, 0x34, 0x6b, 0xdf, 0x62, 0xdf, 0x7f, 0x45, 0x00, 0x41, 0x1e, 0x80, 0x2f, 0x36,
+    0xd6, 0x57, 0x04, 0xe0, 0x17, 0x62, 0xf0, 0x41, 0xae, 0x10, 0x6e, 0x40, 0x20, 0x32, 0x7f, 0x65,
+    0xab, 0xc8, 0xd9, 0x8d, 0xf5, 0x2b, 0x94, 0x80, 0x26, 0x93, 0xc6, 0x28, 0xef, 0x44, 0xc3, 0x0b,
+    0xd5, 0xc8, 0xe9, 0x66, 0x95, 0x58, 0x4c, 0xee, 0xaf, 0x96, 0x48, 0xe5, 0xdf, 0x9b, 0xb3, 0x70,
+    0x6d, 0x3a, 0x1f, 0x34, 0x5a, 0x80, 0x73, 0x52, 0x42, 0x82, 0x82, 0x6a, 0x75, 0xe0, 0xa2, 0xc6,
+    0x71, 0x51, 0xaa, 0x03, 0x36, 0x88, 0x93, 0xd6, 0x6c, 0x2a, 0x27, 0x74, 0x49, 0x4c, 0xa0, 0xb4,
+    0xca, 0xc3, 0x4d, 0xc5, 0x33, 0x03, 0x87, 0xd2, 0xac, 0x32, 0x7e, 0x64, 0xc6, 0x5f, 0xc6, 0x9d,
+    0x80, 0x57, 0xc7, 0xb9, 0x1a, 0xd2, 0xe5, 0x3d, 0x8d, 0x26, 0x46, 0xf0, 0x4c, 0x19, 0xf4, 0xbe,
+    0x02, 0x6d, 0x7b, 0x34, 0x36, 0x06, 0xf5, 0xe7, 0xac, 0xc4, 0x26, 0xe7, 0x31, 0x68, 0x0d, 0xbb,
+    0xa9, 0x4a, 0x91, 0xaa, 0xd7, 0xa9, 0x71, 0xb0, 0x60, 0x20, 0xb4, 0x52, 0xe3, 0x6c, 0xa2, 0xd4,
+    0x55, 0xea, 0x06, 0x6a, 0xdd, 0x94, 0x46, 0x57, 0x18, 0x81, 0x7d, 0xb5, 0x72, 0x4a, 0x9b, 0xf3,
+    0x4d, 0x6f, 0x08, 0x6c, 0x4d, 0x26, 0xc3, 0x93, 0x77, 0x4d, 0x66, 0x6e, 0x32, 0xc3, 0xa7, 0xa3,
+    0x93, 0xe1, 0xaf, 0x4d, 0x66, 0x6d, 0x0c, 0xbb, 0xbc, 0x1f, 0x4f, 0x86, 0xe7, 0x57, 0x4d, 0x16,
+    0x6c, 0x2a, 0x79, 0x3b, 0xba, 0x18, 0x0d, 0xc7, 0x23, 0x18, 0xe1, 0x0b, 0x2d, 0xb7, 0x6a, 0x87,
+    0x93, 0x44, 0x74, 0x26, 0x7c, 0x6a, 0x06, 0x83, 0xbb, 0xf7, 0xb0, 0xbb, 0x00, 0xb2, 0x65, 0x1e,
+    0x0f, 0xae, 0x92, 0x37, 0xf2, 0x22, 0x50, 0x90, 0x80, 0x9e, 0x91, 0x07, 0x54, 0xf8, 0x4c, 0x56,
+    0x51, 0x94, 0x02, 0x81, 0x06, 0x60, 0x5f, 0x6b, 0x00, 0xf2, 0xf9, 0x43, 0x2d, 0x3a, 0xd9, 0xa1,
+    0x25, 0x65, 0x1c, 0xa7, 0x49, 0x74, 0x70, 0x66, 0xbd, 0xa2, 0x76, 0x56, 0x01, 0x88, 0x67, 0x45,
+    0x68, 0xfc, 0xf1, 0xdc, 0x46, 0x80, 0x81, 0x58, 0x03, 0x76, 0x2d, 0x69, 0x5d, 0xd9, 0xc3, 0x82,
+    0x83, 0x42, 0xd0, 0x86, 0x58, 0x1c, 0xfa, 0xcc, 0x07, 0x80, 0x47, 0x4b, 0xe3, 0x11, 0xfb, 0x3c,
+    0x8b, 0x17, 0xaa, 0x58, 0x51, 0xbf, 0x24, 0xfb, 0x19, 0x76, 0xd5, 0x3e, 0x12, 0x4d, 0x16, 0x84,
+    0x16, 0x55, 0x2c, 0x2b, 0x77, 0xc3, 0x37, 0x25, 0xdd, 0x10, 0x27, 0x96, 0xa1, 0x5b, 0x9d, 0xce,
+    0xe8, 0xf8, 0xa4, 0x37, 0xb0, 0xa2, 0x0a, 0x4e, 0x9c, 0xd0, 0x16, 0xeb, 0x1a, 0xac, 0x90, 0x77,
+    0x90, 0x97, 0xe9, 0xeb, 0x6b, 0xb1, 0x96, 0xa6, 0x78, 0x29, 0x88, 0x4f, 0x43, 0x63, 0x06, 0xf3,
+    0xaa, 0x73, 0x32, 0xbc, 0x18, 0x4d, 0xf1, 0x88, 0x66, 0xf5, 0x00, 0x8e, 0xa7, 0x55, 0x2e, 0x82,
+    0x5c, 0x6a, 0xf9, 0x32, 0xdd, 0x93, 0xe4, 0xed, 0x31, 0x4c, 0xf9, 0x63, 0x86, 0xe9, 0x38, 0x32,
+    0xa9, 0x24, 0x60, 0xf7, 0x1e, 0xf3, 0x60, 0xfa, 0x68, 0x63, 0x92, 0x24, 0x07, 0x51, 0x30, 0x97,
+    0xbc, 0xa1, 0xef, 0x32, 0x25, 0x21, 0x50, 0xef, 0x20, 0x13, 0xe3, 0xd0, 0xa8, 0x29, 0x6b, 0xdc,
+    0x40, 0xa1, 0xff, 0x24, 0x58, 0xea, 0xf9, 0x43, 0xc7, 0xc1, 0xf0, 0x35, 0xde, 0x64, 0x07, 0x85,
+    0x17, 0x69, 0x31, 0x26, 0x48, 0x71, 0x60, 0x4f, 0x4e, 0xb0, 0x31, 0xaa, 0x57, 0xd0, 0x89, 0xd0,
+    0x22, 0xed, 0x62, 0x4d, 0x59, 0x54, 0xd1, 0x91, 0x30, 0x4c, 0x0d, 0xc3, 0xd0, 0xb7, 0xef, 0xd6,
+    0x21, 0x1e, 0xb7, 0x94, 0xca, 0x32, 0xa9, 0x57, 0xea, 0x94, 0x77, 0xa3, 0x5f, 0xa3, 0xd8, 0x73,
+    0xd4, 0x4e, 0x33, 0xd7, 0x8c, 0x36, 0xce, 0xff, 0x79, 0xa3, 0xa9, 0x54, 0xfa, 0x7b, 0xbf, 0x8c,
+    0x25, 0x20, 0x9c, 0x7e, 0x68, 0xd4, 0x94, 0xfc, 0xd1, 0xa8, 0x3b, 0xad, 0x6f, 0x30, 0x5d, 0xfa,
+    0x8f, 0xb5, 0xed, 0xf3, 0x80, 0xd5, 0x33, 0x1b, 0x48, 0xea, 0x98, 0xe5, 0x72, 0xc7, 0xe3, 0x15,
+    0xc0, 0x46, 0xad, 0xa1, 0x3b, 0x13, 0x33, 0xa5, 0xd9, 0xa3, 0x47, 0x1b, 0xb7, 0xa1, 0xde, 0xc7,
+    0xbd, 0x1f, 0x60, 0xa6, 0x87, 0x5e, 0x26, 0xe2, 0xd3, 0x17, 0xbc, 0x60, 0x76, 0xb5, 0x06, 0x6f,
+    0x0d, 0x13, 0xdc, 0x51, 0x8b, 0x4a, 0xd6, 0x9a, 0x44, 0x51, 0x86, 0x6b, 0xf0, 0xec, 0x15, 0x13,
+    0x7c, 0xc0, 0xb0, 0xf1, 0xf4, 0x97, 0xe1, 0x87, 0x11, 0xeb, 0x27, 0x4f, 0xba, 0xf4, 0x44, 0x61,
+    0x75, 0x0c, 0x5c, 0xb3, 0x78, 0xa0, 0x40, 0xd5, 0x99, 0x87, 0xe2, 0xb5, 0x89, 0xf8, 0x44, 0x1e,
+    0x98, 0x0b, 0x65, 0xed, 0x6c, 0xdc, 0x22, 0xc2, 0xdd, 0xc7, 0x05, 0x73, 0x69, 0xca, 0x71, 0x21,
+    0x55, 0x63, 0x83, 0x3f, 0x97, 0x4c, 0x3f, 0xc4, 0x61, 0x3d, 0x01, 0x33, 0xee, 0x4c, 0xf7, 0x23,
+    0xea, 0x5b, 0x9c, 0x71, 0x51, 0x0f, 0xd8, 0xdc, 0x31, 0x83, 0x05, 0x12, 0x1a, 0xd2, 0x89, 0xbd,
+    0x8d, 0xd4, 0x0a, 0x43, 0xcc, 0x71, 0xcc, 0x54, 0x96, 0x60, 0x72, 0x3a, 0x38, 0xe7, 0x60, 0xd2,
+    0x8d, 0xfa, 0xae, 0xa0, 0x07, 0x7c, 0xd5, 0x1c, 0x0b, 0x5a, 0xd0, 0xa0, 0x0b, 0xae, 0x42, 0xb0,
+    0x82, 0x2e, 0xe5, 0xa8, 0x4d, 0xd1, 0x75, 0xeb, 0x9f, 0x74, 0x12, 0x48, 0x51, 0x15, 0xd4, 0x19,
+    0xbd, 0xf2, 0x65, 0x95, 0xbf, 0x74, 0xe5, 0x52, 0x39, 0x80, 0xa8, 0x5e, 0x90, 0x01, 0x25, 0x75,
+    0x49, 0x0d, 0x03, 0x61, 0xe3, 0x2d, 0x49, 0x54, 0x4b, 0x2c, 0xd9, 0x61, 0x37, 0x50, 0x0f, 0xe4,
+    0x36, 0x8b, 0x1d, 0x1b, 0xae, 0xc7, 0x44, 0x61, 0x86, 0x6c, 0x6e, 0x94, 0x2d, 0x66, 0x93, 0x58,
+    0xa8, 0xd0, 0xb3, 0xeb, 0x08, 0x88, 0x69, 0xa3, 0x98, 0xf0, 0xaf, 0x92, 0x68, 0x59, 0x90, 0x70,
+    0x49, 0x6d, 0x6f, 0x2c, 0x9d, 0x76, 0x9b, 0x0d, 0xaa, 0xa4, 0x04, 0xdf, 0xa3, 0xd5, 0x8d, 0x62,
+    0x38, 0x41, 0xc5, 0x8c, 0xc7, 0x22, 0x7b, 0x26, 0x9e, 0xe5, 0xc5, 0x66, 0x86, 0xe9, 0x46, 0x06,
+    0xf7, 0x7d, 0x18, 0x7d, 0x80, 0x7f, 0xc8, 0x25, 0x0f, 0x14, 0x8b, 0x1e, 0x18, 0xf5, 0x11, 0x3d,
+    0x27, 0x81, 0xa5, 0x2d, 0x6a, 0x82, 0xfd, 0xfd, 0x7a, 0x93, 0x51, 0x81, 0x4d, 0xa1, 0x9a, 0xec,
+    0xa9, 0x22, 0x91, 0xe9, 0x29, 0x9c, 0x28, 0xe2, 0x89, 0x25, 0xf9, 0x99, 0xe2, 0x76, 0xf1, 0x3c,
+    0xf5, 0x04, 0x95, 0x1a, 0xc6, 0x6c, 0xa9, 0xd1, 0x6c, 0x38, 0x0f, 0x0b, 0x69, 0xa7, 0x63, 0x45,
+    0x21, 0x27, 0x3a, 0xfd, 0xa4, 0x94, 0x80, 0x2a, 0x86, 0xf3, 0x0d, 0x78, 0xdb, 0x69, 0xc3, 0xf9,
+    0x86, 0xfc, 0xef, 0x02, 0x8a, 0x2b, 0xf9, 0xda, 0xe2, 0x78, 0xa0, 0x22, 0xee, 0xa7, 0x0f, 0x14,
+    0xaa, 0x9a, 0x65, 0xa1, 0x39, 0xc5, 0xaa, 0x7a, 0xe6, 0x43, 0xaa, 0xf2, 0x96, 0xd9, 0x16, 0x9a,
+    0xb3, 0xa6, 0xb6, 0x6e, 0x58, 0x54, 0x8e, 0x1a, 0xa6, 0x48, 0x2d, 0x1d, 0x55, 0x55, 0xdf, 0x0e,
+    0x07, 0xf5, 0x2c, 0xa8, 0x1c, 0x0e, 0xc6, 0xe6, 0x90, 0x6d, 0x0a, 0x4c, 0x2e, 0x56, 0xdb, 0xd8,
+    0x4a, 0xfa, 0xa2, 0x23, 0xa0, 0xb4, 0xee, 0x9c, 0x60, 0xf4, 0x17, 0xf6, 0x48, 0x14, 0xec, 0x42,
+    0xd6, 0x6d, 0xcd, 0x63, 0xed, 0x9c, 0x99, 0xe8, 0xae, 0x00, 0x2a, 0xcd, 0xa0, 0x4d, 0x73, 0xe0,
+    0xf7, 0x57, 0xe7, 0xe3, 0xeb, 0xab, 0xe9, 0x87, 0xeb, 0xf3, 0x93, 0xd1, 0x58, 0x55, 0x1c, 0xa2,
+    0x6d, 0x63, 0x80, 0x52, 0x56, 0x3f, 0x1d, 0x4d, 0xde, 0x5f, 0xa5, 0x72, 0x38, 0x88, 0x9e, 0xcd,
+    0xd9, 0x1f, 0x93, 0xd1, 0xed, 0xe8, 0x7a, 0x3a, 0xbe, 0xb9, 0x1d, 0x0d, 0x4f, 0x55, 0xd7, 0x92,
+    0x68, 0xd8, 0x4e, 0x6f, 0xf1, 0x4c, 0x1f, 0x3a, 0x38, 0x06, 0x5d, 0x0c, 0xcc, 0x16, 0x08, 0xe1,
+    0x05, 0xe5, 0x54, 0xc9, 0x11, 0x8d, 0x5c, 0x0f, 0xe0, 0xd6, 0x22, 0x68, 0x14, 0x69, 0x77, 0x72,
+    0x04, 0x4b, 0x55, 0xcd, 0x4e, 0x9f, 0x7a, 0xf3, 0x1c, 0xb9, 0x8e, 0x20, 0xa8, 0x22, 0xbd, 0x5f,
+    0x24, 0xd0, 0x9b, 0x70, 0x51, 0x4e, 0xaf, 0x79, 0x26, 0x2e, 0xd2, 0x4d, 0x51, 0xd5, 0x4b, 0x45,
+    0xa6, 0x53, 0x41, 0xbb, 0xf0, 0xe0, 0x1a, 0xad, 0x66, 0xe1, 0x1c, 0xbb, 0x4c, 0x82, 0xe5, 0x09,
+    0x49, 0x65, 0x6a, 0x20, 0x7a, 0xb8, 0xca, 0x12, 0x4f, 0x01, 0x5f, 0x75, 0x40, 0xed, 0xec, 0x0c,
+    0x6a, 0x6b, 0x06, 0x6d, 0x52, 0x33, 0xfa, 0xa2, 0x50, 0x36, 0xd1, 0x09, 0x69, 0xdd, 0xa8, 0x22,
+    0x67, 0x97, 0xb8, 0x22, 0x74, 0x7e, 0xdd, 0x14, 0xa4, 0x57, 0x28, 0x7e, 0x7e, 0x75, 0x3a, 0xfa,
+    0x47, 0xe4, 0xc5, 0x6d, 0xee, 0x2d, 0xe5, 0x44, 0xaf, 0xe8, 0x30, 0xaf, 0x4d, 0xe9, 0x72, 0x34,
+    0xd2, 0x8e, 0xae, 0x86, 0xaf, 0x2f, 0x46, 0xa0, 0xb5, 0xd1, 0xb7, 0x2f, 0x5e, 0xc1, 0xe8, 0x9c,
+    0xcd, 0x29, 0x2a, 0xda, 0xd9, 0xf5, 0x0b, 0xbf, 0x1b, 0xc3, 0x74, 0x02, 0x7c, 0x14, 0x8c, 0x67,
+    0xb9, 0x78, 0x84, 0x2f, 0x7e, 0x4a, 0x89, 0xbd, 0xec, 0x34, 0xb2, 0x19, 0xdd, 0x93, 0x68, 0xb6,
+    0xc0, 0x56, 0xeb, 0x00, 0x53, 0xb9, 0xff, 0xa2, 0x83, 0xc2, 0x6b, 0x7d, 0xcc, 0xc3, 0xff, 0x4c,
+    0x71, 0x1d, 0xfe, 0x09, 0x54, 0x3d, 0x4e, 0xf3, 0x12, 0x11, 0xb2, 0x60, 0x20, 0xc2, 0xb1, 0x1c,
+    0xcc, 0x80, 0x0a, 0x4e, 0xbe, 0x8d, 0xa6, 0xff, 0x66, 0xc0, 0xee, 0x6c, 0xd7, 0xf4, 0x9f, 0x44,
+    0x04, 0x20, 0x68, 0xb1, 0x1b, 0x07, 0xbd, 0xa6, 0xb7, 0x93, 0xc9, 0x0d, 0xe6, 0xa0, 0x78, 0xae,
+    0xf3, 0xc4, 0xd6, 0x01, 0x90, 0xf7, 0xb0, 0xc0, 0x5d, 0x9b, 0xd0, 0x8a, 0x0a, 0x2d, 0x10, 0x44,
+    0x40, 0x41, 0xdc, 0x76, 0x91, 0x6c, 0x0b, 0x40, 0xef, 0xeb, 0x01, 0xc7, 0x10, 0x77, 0xed, 0x28,
+    0x8b, 0xb9, 0xf8, 0x58, 0xec, 0xd6, 0xbd, 0xf1, 0x1c, 0x07, 0xcf, 0xf6, 0xf5, 0xe3, 0x32, 0x9a,
+    0xde, 0x59, 0x78, 0x0f, 0x63, 0x2a, 0x4d, 0x33, 0x11, 0x5d, 0xb4, 0x88, 0xdc, 0x78, 0xa2, 0x1a,
+    0x23, 0x44, 0x6b, 0xe8, 0xf2, 0xb9, 0xed, 0xe6, 0x7b, 0xb0, 0xd4, 0x6c, 0x28, 0xc7, 0xae, 0xe7,
+    0x6c, 0x46, 0x2d, 0x7d, 0x0c, 0x3b, 0x3a, 0x80, 0x71, 0x93, 0x15, 0x66, 0x80, 0x31, 0x29, 0xa0,
+    0x67, 0x2e, 0x38, 0xdc, 0x71, 0xb7, 0xe7, 0x0c, 0x84, 0x60, 0x16, 0x7f, 0x48, 0x24, 0xc3, 0xa8,
+    0x3f, 0x04, 0xfd, 0xdd, 0x5d, 0x5a, 0x4b, 0x95, 0x1b, 0x74, 0x5b, 0x0b, 0x2f, 0x08, 0xa3, 0xb4,
+    0xa5, 0xfe, 0xcb, 0xce, 0x6e, 0x76, 0x62, 0xf1, 0x10, 0xb4, 0x3c, 0xd7, 0x03, 0x9f, 0x1e, 0xcd,
+    0x5d, 0xc1, 0x0c, 0x66, 0xe6, 0x70, 0xd3, 0x3f, 0xc7, 0xa3, 0xee, 0x41, 0x83, 0x8d, 0x4c, 0x6f,
+    0x68, 0xdc, 0xfc, 0xa2, 0xfe, 0x4a, 0x11, 0xaf, 0x41, 0x03, 0x84, 0x29, 0x30, 0xef, 0x29, 0xf7,
+    0x9c, 0xf6, 0xed, 0x12, 0x3a, 0x4a, 0x97, 0xfe, 0x07, 0x0c, 0x9c, 0x2d, 0xb2, 0x05, 0xe2, 0x7d,
+    0x8b, 0xfa, 0x58, 0x47, 0xd0, 0xcc, 0xf1, 0x02, 0x5e, 0x42, 0x11, 0xc8, 0xe1, 0x19, 0x46, 0xb6,
+    0xf0, 0x8b, 0x00, 0x18, 0xf6, 0x08, 0x1c, 0xef, 0x81, 0xad, 0x00, 0x61, 0x0a, 0x74, 0xba, 0x16,
+    0xe5, 0x41, 0xb2, 0xd0, 0x7f, 0xc2, 0x7b, 0x78, 0x8f, 0xbb, 0xb8, 0xa9, 0x3b, 0xb4, 0x1b, 0xd4,
+    0x72, 0xf4, 0x1e, 0x09, 0x8a, 0x8b, 0xd2, 0xb4, 0xf3, 0xfc, 0x09, 0x78, 0x18, 0xf3, 0x57, 0xa6,
+    0x27, 0x53, 0x99, 0x26, 0xc5, 0xe5, 0x1b, 0x55, 0xb2, 0xab, 0xf1, 0xc0, 0x05, 0x80, 0x06, 0x1a,
+    0x6a, 0x64, 0x45, 0xa7, 0xc9, 0xba, 0x79, 0x28, 0x9f, 0xcb, 0xd6, 0x3f, 0x5f, 0xd3, 0x1e, 0x10,
+    0x2b, 0xb1, 0x07, 0x52, 0xd7, 0x99, 0xe1, 0x98, 0x4f, 0x32, 0x06, 0x48, 0xe6, 0xed, 0x0c, 0x1f,
+    0xb7, 0x16, 0x39, 0x13, 0x24, 0xbf, 0x04, 0x27, 0xad, 0x01, 0x99, 0x43, 0x31, 0x67, 0x01, 0x23,
+    0x83, 0xb6, 0xe7, 0x29, 0xa4, 0xf9, 0x9c, 0x30, 0x2d, 0x16, 0x6d, 0xbe, 0x42, 0x90, 0x68, 0x2b,
+    0xa7, 0x67, 0x17, 0xef, 0xc7, 0x60, 0xf9, 0xc7, 0x2a, 0xbc, 0x7b, 0x0f, 0x1a, 0x97, 0xd6, 0x27,
+    0x0e, 0x3e, 0x82, 0x69, 0x31, 0xc3, 0x24, 0x36, 0xc2, 0x60, 0x6e, 0xea, 0xd8, 0x9c, 0xb2, 0xe0,
+    0x4c, 0x16, 0xd8, 0x98, 0x0f, 0xc9, 0xcc, 0xb5, 0x05, 0xa3, 0x1f, 0x45, 0x62, 0x5a, 0x99, 0x65,
+    0x49, 0x6a, 0x0d, 0x98, 0x9f, 0xee, 0xa4, 0x38, 0xbc, 0x04, 0x86, 0xb9, 0xc9, 0xe2, 0xd0, 0x52,
+    0x9f, 0x75, 0x9a, 0x2c, 0x9e, 0x41, 0xf5, 0x59, 0x57, 0xbe, 0x13, 0x77, 0x7b, 0xf2, 0x4e, 0x5a,
+    0xf8, 0x3e, 0xdb, 0x6f, 0xa6, 0x80, 0x8a, 0x75, 0x93, 0x3e, 0xeb, 0x35, 0x19, 0xad, 0x8c, 0xf4,
+    0xd9, 0x41, 0x93, 0xc9, 0xb5, 0x8f, 0x3e, 0xfb, 0xa9, 0xc9, 0xe4, 0xea, 0x46, 0x9f, 0xbd, 0x84,
+    0xeb, 0x28, 0x2a, 0xdc, 0x67, 0x3f, 0x43, 0xa9, 0x38, 0xec, 0x87, 0xdf, 0xb2, 0x48, 0x83, 0x4d,
+    0xb9, 0xa2, 0xf0, 0x1a, 0x50, 0x4c, 0xb9, 0x97, 0xf0, 0x08, 0xf0, 0x4c, 0xb9, 0x8c, 0xf0, 0x68,
+    0x2f, 0x0d, 0x24, 0x19, 0x68, 0xe1, 0xdd, 0x7e, 0x93, 0x45, 0xc3, 0x27, 0x7e, 0x49, 0x83, 0xee,
+    0x68, 0x74, 0x84, 0x3b, 0x40, 0xf9, 0xe6, 0x7c, 0x72, 0xf2, 0x76, 0xfa, 0x7a, 0x74, 0x75, 0x0a,
+    0x65, 0xae, 0xde, 0x60, 0x8d, 0x9f, 0xd2, 0xd0, 0xa2, 0x7c, 0x0c, 0x78, 0x03, 0xa4, 0xc4, 0x99,
+    0x16, 0xc0, 0x30, 0xc0, 0x24, 0x49, 0x0d, 0xc0, 0x4f, 0x55, 0x35, 0xe3, 0x04, 0x51, 0x60, 0x60,
+    0x37, 0xba, 0xbb, 0x99, 0xbc, 0x85, 0x5b, 0xa8, 0x1b, 0x85, 0x52, 0x81, 0x99, 0x19, 0x6e, 0x46,
+    0x19, 0xd0, 0x7d, 0xda, 0xfd, 0x19, 0x25, 0x5b, 0xc3, 0x1d, 0xd0, 0x1f, 0xe7, 0xa5, 0xc3, 0x6d,
+    0x57, 0xdc, 0xbe, 0x21, 0x74, 0x0e, 0xf6, 0xc4, 0x9d, 0x48, 0xfc, 0xee, 0xd3, 0x9e, 0xa4, 0x28,
+    0x53, 0x18, 0xee, 0x7a, 0xe2, 0x2e, 0x4a, 0x01, 0x86, 0x8e, 0xe8, 0x64, 0x1a, 0xa5, 0xb3, 0xae,
+    0xa1, 0x4b, 0x7e, 0x7a, 0xa1, 0x51, 0x21, 0x45, 0xa2, 0xa6, 0x67, 0xf0, 0x33, 0x9a, 0x5e, 0x0e,
+    0xdf, 0x9c, 0x9f, 0x60, 0x6a, 0xdb, 0x63, 0xaf, 0x5d, 0x50, 0x4e, 0xca, 0x39, 0x14, 0xea, 0xf6,
+    0xb2, 0x45, 0x56, 0x22, 0xe1, 0x80, 0x94, 0x2c, 0x32, 0xf4, 0x14, 0x4f, 0x4f, 0x0f, 0x8d, 0xa4,
+    0xa0, 0x67, 0x0e, 0x0c, 0xf3, 0x9b, 0x86, 0x46, 0xc5, 0x25, 0xb1, 0xad, 0x82, 0x00, 0x42, 0xaa,
+    0xd1, 0x16, 0x7e, 0xa0, 0x22, 0x29, 0x3a, 0xd0, 0xaf, 0x77, 0xab, 0x6d, 0x97, 0x98, 0xbd, 0x3c,
+    0x9e, 0x8a, 0xbd, 0x9a, 0xe3, 0x73, 0xd1, 0x68, 0x33, 0xc3, 0x9b, 0xc6, 0x36, 0x43, 0xa6, 0x02,
+    0x27, 0xef, 0x4e, 0xe3, 0x18, 0x16, 0x35, 0x98, 0xc1, 0xa6, 0x91, 0xfd, 0xaa, 0x94, 0x9e, 0xa7,
+    0x39, 0xfa, 0xd3, 0xdc, 0xb2, 0xff, 0xe4, 0xd1, 0x66, 0x29, 0x91, 0x03, 0x9c, 0xf1, 0x70, 0x45,
+    0xbf, 0xde, 0xad, 0xe7, 0x73, 0x01, 0x13, 0x3a, 0x74, 0xe8, 0xfb, 0xe6, 0xd3, 0x6b, 0x7a, 0x62,
+    0x74, 0x71, 0x35, 0x3c, 0x0f, 0xf1, 0x07, 0xd6, 0x6b, 0xe8, 0x1c, 0x70, 0xfc, 0x94, 0xa6, 0x84,
+    0x82, 0x39, 0x29, 0x1f, 0xe0, 0xd6, 0x10, 0xb0, 0x33, 0xc5, 0xb1, 0x20, 0x76, 0xe5, 0x7b, 0xdb,
+    0x0d, 0x5f, 0x1a, 0xed, 0x66, 0x5e, 0x48, 0x4b, 0x2b, 0x80, 0x4a, 0xe5, 0xb1, 0xd2, 0xa4, 0x4e,
+    0x78, 0xf3, 0x39, 0x9e, 0xf1, 0x03, 0xa2, 0x3c, 0x28, 0x11, 0xa9, 0x38, 0x6c, 0x4a, 0x32, 0x05,
+    0x1e, 0xb7, 0x55, 0x30, 0x40, 0xa7, 0x91, 0x10, 0xc0, 0xa9, 0xf8, 0xa0, 0xb0, 0xe8, 0x99, 0xe3,
+    0x99, 0xe1, 0x5e, 0x57, 0x16, 0xc6, 0xd8, 0xa6, 0x14, 0xdd, 0x26, 0xed, 0xee, 0xd6, 0xed, 0x5c,
+    0x97, 0x25, 0x8f, 0x58, 0xaf, 0x7c, 0x2d, 0x26, 0x4d, 0x04, 0x89, 0x12, 0x2a, 0x62, 0x4e, 0x22,
+    0xc0, 0x25, 0xfb, 0x46, 0x2a, 0x01, 0xfb, 0xfe, 0x7b, 0x74, 0x45, 0x70, 0x52, 0xfe, 0x84, 0x63,
+    0xb9, 0x90, 0x8d, 0x78, 0x48, 0x6e, 0x5d, 0xdf, 0x8c, 0xae, 0x74, 0x8a, 0xf2, 0x80, 0x7a, 0xe7,
+    0x5a, 0xfa, 0xbe, 0x2c, 0x5c, 0x07, 0xc6, 0x89, 0x3d, 0xba, 0xdf, 0x73, 0x70, 0x6a, 0x84, 0x4f,
+    0x63, 0x7e, 0xe4, 0x62, 0x1f, 0x47, 0x80, 0x03, 0xa5, 0x18, 0x2e, 0x17, 0xfc, 0x71, 0x87, 0xbb,
+    0x33, 0x98, 0x43, 0x59, 0x05, 0x6b, 0x63, 0x0b, 0x9a, 0xd4, 0x91, 0x58, 0xb6, 0x70, 0xa9, 0xd7,
+    0x40, 0xf9, 0xa2, 0x3e, 0xa0, 0x67, 0x11, 0x56, 0x4d, 0x76, 0x87, 0xdd, 0x76, 0x07, 0x73, 0xdc,
+    0x71, 0xe8, 0xe3, 0x21, 0x4f, 0x9d, 0x83, 0x06, 0x78, 0x66, 0x16, 0x1d, 0xfe, 0x83, 0x47, 0x34,
+    0xd7, 0xdb, 0xf5, 0x46, 0xa3, 0xf5, 0x4f, 0xcf, 0x76, 0x8d, 0xba, 0x2e, 0x96, 0x1d, 0x2d, 0x41,
+    0x90, 0xae, 0xe1, 0x77, 0x3f, 0xfe, 0x62, 0xe0, 0x67, 0x2c, 0x3c, 0xab, 0xcf, 0xea, 0x37, 0xd7,
+    0xe3, 0x09, 0x3c, 0xc1, 0x6f, 0x28, 0x71, 0x3f, 0xe8, 0xc3, 0xab, 0xba, 0x74, 0xaf, 0x77, 0x70,
+    0x7d, 0x05, 0xa3, 0xd5, 0xe8, 0x72, 0xef, 0xae, 0x70, 0xda, 0x51, 0x67, 0x9f, 0x9b, 0xf4, 0x29,
+    0xd8, 0x3e, 0x21, 0xff, 0xb9, 0x51, 0x6d, 0x95, 0x45, 0xb8, 0x57, 0x09, 0xbf, 0x0c, 0xf2, 0x53,
+    0xe2, 0x09, 0x8b, 0x32, 0xdb, 0xc2, 0x89, 0x8a, 0x1d, 0x48, 0x97, 0x0a, 0xe6, 0x09, 0x85, 0xfb,
+    0xc9, 0x84, 0x8f, 0x5a, 0xb8, 0xd6, 0x22, 0x67, 0x0b, 0x5f, 0x6f, 0xa9, 0x25, 0x71, 0x8c, 0x37,
+    0x47, 0xd5, 0x8b, 0x97, 0x63, 0x4a, 0x62, 0xed, 0x04, 0x3b, 0x09, 0xb5, 0x17, 0xac, 0x8a, 0x7c,
+    0x85, 0x39, 0x12, 0x35, 0x5c, 0xd3, 0x2d, 0x17, 0x54, 0x99, 0x18, 0x47, 0xa7, 0xc8, 0xd1, 0xc4,
+    0xc0, 0x22, 0xef, 0x5d, 0x38, 0x82, 0x56, 0x6a, 0xaf, 0x72, 0xc1, 0x3a, 0x19, 0x72, 0x51, 0x1e,
+    0x54, 0x16, 0xf1, 0x5d, 0x37, 0x6b, 0xfc, 0x26, 0xee, 0x14, 0xef, 0xa3, 0x4e, 0x6d, 0xe3, 0xd7,
+    0x48, 0xa8, 0xd1, 0x10, 0x3d, 0x84, 0xd7, 0x62, 0x7f, 0x49, 0x21, 0x97, 0x52, 0xa7, 0xd9, 0xe5,
+    0xf8, 0x24, 0xba, 0x44, 0xac, 0xce, 0xe0, 0x9b, 0x81, 0x76, 0x55, 0x25, 0x1a, 0x6d, 0x8a, 0xe7,
+    0x07, 0x19, 0x89, 0xda, 0xb4, 0x54, 0xf7, 0x4c, 0x6c, 0x69, 0x9a, 0x6b, 0x71, 0x71, 0x8c, 0x0f,
+    0xf2, 0x16, 0xe3, 0xde, 0x94, 0x16, 0x2e, 0xdf, 0xdc, 0xfb, 0x1c, 0x8c, 0x12, 0x3e, 0x95, 0xd7,
+    0x8d, 0x7a, 0xb1, 0xdd, 0xd5, 0x2f, 0xe7, 0xa8, 0x87, 0xd3, 0xe9, 0x33, 0x0b, 0x66, 0x4e, 0xf9,
+    0xe9, 0x3e, 0xe2, 0x18, 0x3f, 0x40, 0x1e, 0xff, 0x04, 0xbf, 0xb5, 0xb5, 0x47, 0xc9, 0x7c, 0xbc,
+    0x5b, 0x96, 0x9e, 0xc6, 0x23, 0xcf, 0xe0, 0x2b, 0x84, 0x42, 0x22, 0x83, 0x67, 0x0c, 0xea, 0x5d,
+    0x81, 0x1b, 0x30, 0xad, 0x36, 0x74, 0x07, 0x58, 0x1f, 0xe3, 0x37, 0x28, 0x26, 0xa5, 0xa6, 0x49,
+    0xed, 0xbe, 0xc2, 0x5f, 0xf9, 0x04, 0x57, 0x6a, 0x64, 0x59, 0xe8, 0x43, 0xcf, 0xf9, 0xc4, 0xd1,
+    0x9c, 0xfe, 0x5e, 0x64, 0x12, 0x08, 0xd8, 0x04, 0x6a, 0x12, 0x24, 0xbc, 0xf8, 0x9d, 0xc6, 0xd7,
+    0xc8, 0x08, 0x89, 0xfe, 0x43, 0x6b, 0xab, 0xd5, 0xe5, 0x8c, 0x05, 0xd6, 0x96, 0x11, 0xa6, 0x96,
+    0x86, 0x85, 0xdb, 0x8b, 0x31, 0x0c, 0x84, 0xb3, 0xc8, 0xe3, 0xfa, 0x0b, 0x79, 0xdf, 0x67, 0x2a,
+    0x06, 0xfd, 0x08, 0x0d, 0xdd, 0xca, 0xdf, 0xe7, 0x52, 0xcb, 0x26, 0x3a, 0xf9, 0x99, 0xeb, 0x85,
+    0x28, 0x25, 0x34, 0x73, 0x27, 0x20, 0x95, 0x57, 0x0b, 0x53, 0xa7, 0x16, 0x16, 0xd8, 0x71, 0x01,
+    0x72, 0x97, 0x8a, 0xd6, 0x1b, 0x39, 0x7c, 0xcb, 0x26, 0xd5, 0xf2, 0x8b, 0x7a, 0x18, 0x2f, 0xf0,
+    0x7c, 0xb0, 0x4e, 0xba, 0x75, 0xfd, 0x92, 0xd5, 0x7c, 0x59, 0xbd, 0x10, 0x33, 0x71, 0x50, 0xdd,
+    0xff, 0xc2, 0xd5, 0x7c, 0xe5, 0x23, 0x81, 0x5b, 0x2c, 0xe6, 0xd7, 0xcb, 0x96, 0xe1, 0x25, 0xad,
+    0xd9, 0x65, 0x78, 0x91, 0x91, 0xff, 0x6f, 0x59, 0x85, 0xc7, 0xa6, 0xb7, 0x5d, 0x84, 0x97, 0xf9,
+    0xf5, 0xea, 0x1a, 0x3c, 0x11, 0x22, 0x72, 0xd7, 0xea, 0x60, 0x09, 0xe8, 0x0e, 0xde, 0x18, 0x7c,
+    0xb9, 0x0a, 0x9f, 0x1a, 0x65, 0xf8, 0x7c, 0x8d, 0xf5, 0xf9, 0x54, 0x8c, 0xd4, 0x9c, 0xe1, 0x97,
+    0xbd, 0xe5, 0x26, 0xdb, 0x20, 0x95, 0xe1, 0xc8, 0x94, 0x02, 0x7f, 0xc3, 0x2a, 0xbf, 0xec, 0xdd,
+    0xca, 0x7a, 0x2b, 0xca, 0x47, 0xc7, 0x1b, 0x9a, 0xf4, 0x10, 0xaa, 0x3e, 0x86, 0xbe, 0x59, 0x30,
+    0x48, 0x38, 0x5e, 0x75, 0x89, 0xd5, 0xad, 0xac, 0xa4, 0x75, 0x8e, 0x22, 0xae, 0xa2, 0x59, 0xec,
+    0xc9, 0x57, 0x58, 0xef, 0x48, 0xd9, 0x40, 0x61, 0x10, 0x2a, 0xec, 0x5f, 0xff, 0xc2, 0x13, 0x15,
+    0x8a, 0x74, 0x4d, 0x51, 0xf1, 0x4d, 0x4b, 0x10, 0xea, 0x07, 0x2c, 0xf3, 0xe7, 0x88, 0xd1, 0xcc,
+    0x35, 0x9a, 0xb2, 0x30, 0x79, 0xfe, 0x60, 0x1c, 0xc4, 0x9f, 0xdb, 0x3e, 0x32, 0xc0, 0x23, 0xd3,
+    0x23, 0xd0, 0x67, 0x33, 0x73, 0x05, 0x83, 0x94, 0x98, 0x2f, 0x2c, 0xd3, 0x74, 0xaa, 0x33, 0xea,
+    0x41, 0xf1, 0x41, 0x6d, 0x9b, 0x38, 0x89, 0xc5, 0xf4, 0x9c, 0x54, 0xc2, 0x00, 0x22, 0x58, 0x9b,
+    0xee, 0xcc, 0x3a, 0x11, 0x0b, 0x82, 0x50, 0xff, 0x1e, 0x61, 0x10, 0x57, 0xc5, 0x14, 0xe6, 0xfd,
+    0xed, 0xf9, 0x89, 0xb7, 0x04, 0x2b, 0x86, 0xfa, 0x8a, 0xef, 0x1a, 0x30, 0x7e, 0xf6, 0xda, 0x1b,
+    0x4d, 0xbc, 0xfa, 0xf5, 0x4e, 0xfc, 0x74, 0x6e, 0xba, 0x39, 0xf1, 0xbe, 0x9e, 0xfa, 0xce, 0x78,
+    0x5c, 0x39, 0xf5, 0xe5, 0xce, 0x7c, 0x5d, 0x7a, 0x9d, 0xae, 0x9a, 0x4b, 0xec, 0x9a, 0xd1, 0xe7,
+    0x37, 0x2d, 0x3e, 0xb3, 0x97, 0x26, 0x9e, 0x3c, 0x06, 0x74, 0xe3, 0x8e, 0x3c, 0xd9, 0x03, 0xb1,
+    0xc7, 0x2a, 0xa2, 0x96, 0x33, 0x20, 0x1d, 0x8c, 0x1a, 0xe7, 0xa2, 0x5e, 0x36, 0xcc, 0x2a, 0x0f,
+    0xdd, 0x39, 0x81, 0xa9, 0xe4, 0x54, 0x44, 0xa7, 0xc4, 0x4e, 0x28, 0x98, 0x83, 0x77, 0xdb, 0xbd,
+    0xf6, 0x80, 0x5a, 0xdd, 0xdf, 0xc7, 0x8d, 0xeb, 0xbb, 0xb2, 0xd8, 0xe9, 0xe8, 0xe4, 0xfc, 0x12,
+    0x83, 0x7b, 0x57, 0x5a, 0x28, 0x32, 0x28, 0x40, 0x1b, 0xcf, 0x0f, 0x06, 0x0a, 0xee, 0xff, 0xd5,
+    0xe9, 0x45, 0x11, 0x60, 0x3c, 0x20, 0x5a, 0x7c, 0x35, 0x34, 0xbd, 0x46, 0x83, 0x18, 0xde, 0xae,
+    0x5d, 0xf2, 0xc5, 0x8f, 0x70, 0x62, 0x15, 0x70, 0x5d, 0x18, 0x2a, 0x75, 0x5a, 0x6c, 0x46, 0x78,
+    0x33, 0x30, 0xbe, 0x51, 0xef, 0xab, 0x9e, 0x95, 0xa1, 0x9c, 0x51, 0x9b, 0x73, 0x50, 0x53, 0xf0,
+    0x5f, 0xb1, 0x3a, 0x9e, 0xa3, 0x4a, 0xc9, 0x61, 0x34, 0x6d, 0xad, 0x0f, 0x34, 0x99, 0xc5, 0x49,
+    0x85, 0x06, 0xad, 0x0f, 0x48, 0xc4, 0x37, 0xed, 0xec, 0x8e, 0x0b, 0xea, 0xa6, 0x12, 0x69, 0xa8,
+    0x3a, 0xef, 0xbd, 0xda, 0xda, 0x6f, 0x72, 0xa0, 0x70, 0xb9, 0x91, 0xa2, 0x72, 0xaf, 0xb0, 0x1c,
+    0xa9, 0x0f, 0xad, 0xa1, 0x6e, 0xe3, 0x23, 0x08, 0x77, 0x9f, 0xe2, 0x17, 0xdd, 0x36, 0x1e, 0x85,
+    0x10, 0xbf, 0x31, 0x95, 0xf8, 0x15, 0xfa, 0xaa, 0x14, 0xfd, 0x2b, 0x00, 0x1d, 0x05, 0xbe, 0x70,
+    0x3a, 0x84, 0x6c, 0x90, 0xa1, 0x04, 0x66, 0xf9, 0xe6, 0x83, 0x60, 0x16, 0x22, 0xd6, 0x64, 0x51,
+    0xe0, 0xe3, 0x2b, 0x24, 0x8b, 0x21, 0x54, 0x65, 0x10, 0xc9, 0x83, 0x9b, 0xdb, 0x2e, 0x68, 0xfb,
+    0x93, 0xb4, 0x3c, 0x8a, 0x29, 0x8a, 0x7b, 0xb0, 0x99, 0xd1, 0x8c, 0x4d, 0x43, 0x51, 0x01, 0x35,
+    0xda, 0x51, 0x48, 0x9e, 0x46, 0xbd, 0xb1, 0x87, 0x45, 0xb9, 0xba, 0xd6, 0xfe, 0xce, 0x42, 0x0c,
+    0xd8, 0x88, 0x12, 0x58, 0x9d, 0x84, 0x1d, 0x66, 0x0e, 0xf5, 0xae, 0xa5, 0xaf, 0xf0, 0x90, 0x14,
+    0xa7, 0x43, 0xaf, 0x9b, 0x6c, 0x91, 0x3c, 0x11, 0x47, 0x5f, 0x67, 0xaa, 0x85, 0x8f, 0x38, 0xc9,
+    0x71, 0xe8, 0xc3, 0xf2, 0xe8, 0x97, 0xe1, 0x77, 0xbb, 0xeb, 0xfa, 0x32, 0xb7, 0xe0, 0x23, 0x60,
+    0x88, 0x11, 0xfe, 0xff, 0x00, 0x80, 0x1b, 0xf9, 0x52, 0x01, 0x0c, 0x46, 0x1f, 0x79, 0x02, 0xab,
+    0x7d, 0xd6, 0xd6, 0xc0, 0xba, 0xe3, 0xf7, 0xb6, 0x7b, 0x63, 0x86, 0x0b, 0x6d, 0x94, 0x4d, 0xe8,
+    0x05, 0xba, 0x48, 0xf3, 0x79, 0xa8, 0x4d, 0xf0, 0x07, 0x8b, 0x75, 0xed, 0x72, 0x76, 0xf7, 0x14,
+    0x72, 0xb2, 0x57, 0x77, 0xf8, 0x85, 0xb3, 0x36, 0x34, 0xb8, 0xf3, 0xf3, 0x01, 0xb3, 0x5e, 0x9f,
+    0x8d, 0x9b, 0xac, 0xdb, 0xeb, 0x61, 0x70, 0x5e, 0xde, 0x41, 0x81, 0x00, 0x66, 0x97, 0xb8, 0xd4,
+    0x97, 0xb7, 0xa7, 0xbb, 0xac, 0x5b, 0x10, 0x2e, 0xa3, 0x6a, 0x22, 0x08, 0x9b, 0x0f, 0x92, 0x95,
+    0x1c, 0xee, 0xa4, 0x6c, 0x79, 0x47, 0x10, 0x32, 0x57, 0xb5, 0x70, 0xc3, 0x7b, 0xd2, 0x20, 0x76,
+    0xb6, 0xcd, 0x7e, 0x80, 0x5e, 0xdc, 0x4d, 0xd5, 0x2c, 0xa9, 0x82, 0xb9, 0xc9, 0x0b, 0xb6, 0x43,
+    0xc5, 0x7f, 0xb3, 0x7f, 0x87, 0xca, 0x0b, 0xa4, 0xa8, 0xd7, 0x2b, 0x76, 0xff, 0xec, 0x28, 0x8e,
+    0x8d, 0x7d, 0xb1, 0xf4, 0x3e, 0xf1, 0x89, 0x67, 0x3c, 0x36, 0xd9, 0x13, 0x28, 0x25, 0xc5, 0x1f,
+    0xf1, 0xb1, 0x63, 0xbb, 0xc9, 0xe3, 0x0a, 0xcb, 0x93, 0x49, 0xe7, 0x1b, 0x9a, 0xf2, 0x79, 0x21,
+    0x9b, 0xcd, 0x66, 0xf5, 0xe2, 0x72, 0x38, 0xa7, 0x34, 0x0c, 0x6d, 0x57, 0xe1, 0x4a, 0xa7, 0x92,
+    0x7b, 0x43, 0xe1, 0x86, 0x8f, 0x6f, 0xff, 0x04, 0x33, 0xf0, 0x00, 0x5c, 0xe8, 0x81, 0x68, 0x76,
+    0x2a, 0x6f, 0x7e, 0x93, 0xde, 0xa2, 0xcc, 0xc6, 0x16, 0x1d, 0x7d, 0xee, 0x86, 0x9d, 0x83, 0x67,
+    0x74, 0x74, 0x3a, 0x2f, 0x79, 0xcb, 0xbe, 0xce, 0x54, 0xde, 0xd8, 0xdd, 0xc0, 0x07, 0x20, 0x56,
+    0xd6, 0x4a, 0x7a, 0xfd, 0xa0, 0xd7, 0xdb, 0x3b, 0xf8, 0xbf, 0xdf, 0xef, 0x99, 0x14, 0xef, 0x1f,
+    0x68, 0x91, 0x3c, 0xf6, 0x71, 0x14, 0x79, 0xc8, 0x09, 0x02, 0x85, 0x9a, 0x8b, 0xe5, 0x60, 0xe3,
+    0x8e, 0x60, 0x3a, 0x70, 0x5e, 0x1c, 0xe9, 0x5e, 0xec, 0xac, 0x45, 0x47, 0x86, 0xb7, 0xca, 0x62,
+    0x8e, 0xf1, 0xb9, 0xe2, 0xff, 0x8e, 0xa8, 0x63, 0xe6, 0x1c, 0xfc, 0xff, 0x2d, 0x71, 0x47, 0xd4,
+    0x18, 0x81, 0xbd, 0x4c, 0xb6, 0xa7, 0x75, 0x93, 0x78, 0x6e, 0x4c, 0xcf, 0x00, 0x41, 0xdf, 0x96,
+    0x51, 0x44, 0x22, 0x23, 0x60, 0x1e, 0xe6, 0x32, 0xc5, 0x05, 0x68, 0xa9, 0x5f, 0xbc, 0x17, 0x97,
+    0xf0, 0xa6, 0x70, 0xd2, 0x0c, 0xff, 0xc4, 0x64, 0x37, 0xf4, 0xa1, 0x73, 0xc8, 0x23, 0xc7, 0x43,
+    0xf0, 0x8c, 0xf8, 0xb6, 0x21, 0xcf, 0xc1, 0xd3, 0x9f, 0x4c, 0xac, 0x60, 0x49, 0xe3, 0x91, 0x6d,
+    0x39, 0xbc, 0x8e, 0x2b, 0x3f, 0xf4, 0x42, 0x1c, 0xb3, 0x3f, 0x95, 0x08, 0x1d, 0xa3, 0x62, 0xe9,
+    0xf5, 0x9d, 0x68, 0xc6, 0xa3, 0x31, 0x06, 0xcc, 0x31, 0x69, 0xc3, 0x35, 0xed, 0x29, 0x11, 0x07,
+    0x0b, 0x2a, 0x90, 0x96, 0x32, 0x2b, 0x03, 0xb7, 0x96, 0xd8, 0xe1, 0x8e, 0x6d, 0x01, 0xf9, 0x36,
+    0xcc, 0x57, 0x08, 0x47, 0xcb, 0x46, 0x63, 0x84, 0x1b, 0x8f, 0x4b, 0xc9, 0x65, 0xa0, 0x00, 0x84,
+    0x11, 0x1e, 0xea, 0x91, 0xe1, 0xda, 0x74, 0x1d, 0x4c, 0xf1, 0x29, 0xf2, 0x0e, 0x1c, 0x3e, 0xe3,
+    0xdb, 0xf8, 0xf5, 0x83, 0x07, 0xb3, 0x46, 0x41, 0x09, 0x9d, 0xf0, 0xd1, 0x64, 0x4b, 0x6e, 0xba,
+    0xba, 0xea, 0xf8, 0x58, 0xd4, 0xaf, 0x74, 0x26, 0xe0, 0xb3, 0x45, 0x94, 0xc4, 0x72, 0xab, 0xe0,
+    0x71, 0xf6, 0x33, 0x08, 0x62, 0xc2, 0x5e, 0x14, 0x4d, 0x8b, 0x3f, 0x6a, 0x90, 0xcc, 0xed, 0x95,
+    0x68, 0x5f, 0xa4, 0xbd, 0x95, 0xe2, 0xd5, 0xc9, 0x27, 0x04, 0xb4, 0x6e, 0x20, 0x46, 0x90, 0xcb,
+    0x9c, 0xc0, 0xd4, 0x27, 0x0c, 0xca, 0x23, 0xce, 0xf8, 0xaa, 0x74, 0xf5, 0x19, 0xf7, 0x5f, 0xc9,
+    0x71, 0xec, 0x0c, 0x2e, 0x71, 0xe5, 0x38, 0x6b, 0x96, 0xb1, 0x88, 0x8c, 0x22, 0x19, 0x75, 0x68,
+    0x16, 0xe4, 0x05, 0xc1, 0x8a, 0xdf, 0x16, 0x4d, 0xb4, 0x07, 0xe5, 0x1c, 0x13, 0x54, 0x6b, 0xd7,
+    0xf4, 0x44, 0xf4, 0x98, 0xb0, 0xf8, 0x5c, 0x16, 0xfd, 0x8d, 0xf9, 0xfb, 0xbc, 0x29, 0x80, 0xc0,
+    0x00, 0xe7, 0x00, 0x84, 0x14, 0x03, 0xac, 0x36, 0x05, 0x93, 0xc0, 0xcc, 0xc7, 0x87, 0xbb, 0x73,
+    0xb1, 0x0d, 0x24, 0xda, 0xdb, 0x85, 0x2b, 0x4a, 0xb8, 0x27, 0x3c, 0x7e, 0x20, 0x03, 0xb2, 0x2f,
+    0x72, 0x42, 0x6c, 0x5a, 0xb2, 0xb3, 0xed, 0x20, 0xc4, 0x13, 0xb9, 0x8d, 0xfa, 0xe9, 0xf5, 0xa5,
+    0x94, 0x59, 0xfc, 0x90, 0x0e, 0x47, 0xae, 0xe8, 0x72, 0xd2, 0x34, 0x07, 0xc4, 0xd3, 0x76, 0xdc,
+    0xab, 0xd1, 0x2f, 0xda, 0x72, 0xea, 0x41, 0xe1, 0xa5, 0x05, 0xd5, 0xc3, 0xc5, 0x06, 0xda, 0x12,
+    0xca, 0x99, 0x8f, 0x99, 0x55, 0x7d, 0x35, 0xe6, 0x9c, 0x7f, 0x15, 0x6f, 0x2e, 0x1b, 0x94, 0xc4,
+    0xc9, 0x4b, 0x23, 0xe4, 0x3a, 0xe1, 0xa9, 0x97, 0x2b, 0x99, 0x94, 0xe4, 0x4c, 0x62, 0x64, 0xc9,
+    0x5e, 0x48, 0xcd, 0xa7, 0xdc, 0x3b, 0x98, 0x0a, 0x57, 0x5e, 0xaa, 0xdb, 0xc4, 0xa4, 0x5c, 0x3d,
+    0xac, 0xcc, 0xf7, 0xb1, 0x35, 0x25, 0x94, 0xaf, 0x92, 0x66, 0x63, 0x73, 0x8a, 0x88, 0xa9, 0x12,
+    0xa5, 0x4d, 0xb0, 0xa6, 0x92, 0xc3, 0x0d, 0x07, 0x0e, 0x0c, 0x8a, 0xab, 0x9e, 0x96, 0x1f, 0x37,
+    0x50, 0x52, 0x73, 0xbc, 0xe9, 0xb0, 0x81, 0x92, 0xba, 0xb7, 0x9b, 0xce, 0x1a, 0xd0, 0x71, 0x2c,
+    0x39, 0xc8, 0xa3, 0x6e, 0xd6, 0x9b, 0x31, 0xed, 0x9b, 0xca, 0x5a, 0x49, 0xd9, 0xd3, 0x4d, 0x65,
+    0x83, 0xa4, 0xec, 0x78, 0x53, 0x59, 0x3f, 0x29, 0x7b, 0xab, 0x5a, 0x8b, 0x68, 0x32, 0x7a, 0xb8,
+    0x1b, 0x7d, 0xaa, 0xe4, 0x70, 0x17, 0x2d, 0x1a, 0xfe, 0xc5, 0x23, 0xa8, 0x8e, 0x5f, 0xfc, 0x37,
+    0xf9, 0x44, 0xb8, 0x89, 0x37, 0x97, 0x00, 0x00,
+};
+
+#endif
@@ -0,0 +1,38 @@
+// midiinput.cpp
+
+#include "MidiInput.h"
+#include "Synth.h"
+
+void MidiInput::begin() {
+    MIDI_SERIAL.begin(MIDI_BAUD, SERIAL_8N1, MIDI_RX_PIN, MIDI_TX_PIN);
+    parser.reset();
+    Serial.printf("MIDI: Listening on RX GPIO %d at %d baud.\n", MIDI_RX_PIN, MIDI_BAUD);
+}
+
+void MidiInput::poll() {
+    MidiEvent event;
+
+    while (MIDI_SERIAL.available() > 0) {
+        uint8_t byte = (uint8_t)MIDI_SERIAL.read();
+        if (parser.parse(byte, micros(), event)) {
+            dispatch(event);
+        }
+    }
+}
+
+void MidiInput::dispatch(const MidiEvent& event) {
+    switch (event.type) {
+        case MIDI_NOTE_ON:
+            synth.noteOn(event.data1, event.data2, event.timestamp);
+            break;
+        case MIDI_NOTE_OFF:
+            synth.noteOff(event.data1, event.timestamp);
+            break;
+        case MIDI_CONTROL_CHANGE:
+            synth.controlChange(event.data1, event.data2, event.timestamp);
+            break;
+        case MIDI_PITCH_BEND:
+            synth.pitchBend(event.bend, event.timestamp);
+            break;
+    }
+}
@@ -0,0 +1,28 @@
+// midiinput.h
+
+#ifndef MIDI_INPUT_H
+#define MIDI_INPUT_H
+
+#include <Arduino.h>
+#include "MidiParser.h"
+
+// --- MIDI UART Configuration ---
+// DIN MIDI via an opto-isolator on GPIO 16 at 31250 baud. For a USB-serial
+// bridge (e.g. Hairless MIDI) point MIDI_SERIAL at Serial and raise MIDI_BAUD.
+#define MIDI_SERIAL Serial2
+#define MIDI_BAUD 31250
+#define MIDI_RX_PIN 16
+#define MIDI_TX_PIN 17
+
+class MidiInput {
+private:
+    MidiParser parser;
+
+    void dispatch(const MidiEvent& event);
+
+public:
+    void begin();
+    void poll(); // Drain all pending UART bytes into the engine
+};
+
+#endif
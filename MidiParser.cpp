@@ -0,0 +1,85 @@
+// midiparser.cpp
+
+#include "MidiParser.h"
+
+uint8_t MidiParser::dataLength(uint8_t status) {
+    switch (status & 0xF0) {
+        case 0xC0: // Program Change
+        case 0xD0: // Channel Pressure
+            return 1;
+        default:
+            return 2;
+    }
+}
+
+void MidiParser::reset() {
+    runningStatus = 0;
+    dataCount = 0;
+    dataExpected = 0;
+    inSysEx = false;
+}
+
+bool MidiParser::parse(uint8_t byte, uint32_t timestamp, MidiEvent& event) {
+    if (byte >= 0xF8) {
+        // Real-time messages may appear anywhere and never affect running status
+        return false;
+    }
+
+    if (byte & 0x80) {
+        if (byte == 0xF7) {
+            inSysEx = false;
+            return false;
+        }
+        if (byte >= 0xF0) {
+            // System common / SysEx start: cancels running status
+            inSysEx = (byte == 0xF0);
+            runningStatus = 0;
+            dataCount = 0;
+            return false;
+        }
+
+        // Channel status byte
+        inSysEx = false;
+        runningStatus = byte;
+        dataCount = 0;
+        dataExpected = dataLength(byte);
+        return false;
+    }
+
+    // Data byte: ignore if we have no status (or are inside SysEx)
+    if (inSysEx || runningStatus == 0) {
+        return false;
+    }
+
+    data[dataCount++] = byte;
+    if (dataCount < dataExpected) {
+        return false;
+    }
+    // Message complete; running status stays armed for the next data bytes
+    dataCount = 0;
+
+    event.timestamp = timestamp;
+    event.channel = runningStatus & 0x0F;
+    event.data1 = data[0];
+    event.data2 = (dataExpected > 1) ? data[1] : 0;
+    event.bend = 0;
+
+    switch (runningStatus & 0xF0) {
+        case 0x80:
+            event.type = MIDI_NOTE_OFF;
+            return true;
+        case 0x90:
+            event.type = (event.data2 == 0) ? MIDI_NOTE_OFF : MIDI_NOTE_ON;
+            return true;
+        case 0xB0:
+            event.type = MIDI_CONTROL_CHANGE;
+            return true;
+        case 0xE0:
+            event.type = MIDI_PITCH_BEND;
+            event.bend = (int16_t)(((int)data[1] << 7 | data[0]) - 8192);
+            return true;
+        default:
+            // Poly pressure, program change, channel pressure: not used by the engine
+            return false;
+    }
+}
@@ -0,0 +1,42 @@
+// midiparser.h
+
+#ifndef MIDI_PARSER_H
+#define MIDI_PARSER_H
+
+// Plain C++ (no Arduino dependencies) so the parser can be built and fed
+// byte streams on a host machine.
+#include <stdint.h>
+
+// Decoded Channel Voice Message Types
+enum MidiEventType { MIDI_NOTE_OFF, MIDI_NOTE_ON, MIDI_CONTROL_CHANGE, MIDI_PITCH_BEND };
+
+struct MidiEvent {
+    uint32_t timestamp;  // caller-supplied arrival time of the final byte (us)
+    uint8_t type;        // MidiEventType
+    uint8_t channel;     // 0-15
+    uint8_t data1;       // note or controller number
+    uint8_t data2;       // velocity or controller value
+    int16_t bend;        // pitch bend, -8192 to 8191
+};
+
+// --- Streaming MIDI Byte Parser ---
+// Feed bytes one at a time. Handles running status, note-on with velocity 0 as
+// note-off, interleaved real-time bytes and SysEx skipping. No allocation and
+// no buffering beyond the two pending data bytes.
+class MidiParser {
+private:
+    uint8_t runningStatus = 0;
+    uint8_t data[2];
+    uint8_t dataCount = 0;
+    uint8_t dataExpected = 0;
+    bool inSysEx = false;
+
+    static uint8_t dataLength(uint8_t status);
+
+public:
+    void reset();
+    // Returns true and fills 'event' when a supported message completes
+    bool parse(uint8_t byte, uint32_t timestamp, MidiEvent& event);
+};
+
+#endif
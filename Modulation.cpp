@@ -0,0 +1,171 @@
+// modulation.cpp
+
+#include "Modulation.h"
+#include "Synth.h"
+
+// LFOs and the matrix advance once per DMA block
+#define CONTROL_RATE ((double)I2S_SAMPLE_RATE / DMA_BUF_LEN)
+
+// EXP2_TABLE: 2^(i/32) in Q16 over two octaves, constant (see Tables.h)
+
+// -------------------------------------------------------------------
+// --- HELPER FUNCTION: PITCH OFFSET TO RATIO ---
+// -------------------------------------------------------------------
+uint32_t pitchRatioQ16(int32_t pitchQ15) {
+    // Shift the +/-1 octave range up by one octave so the index is positive,
+    // then halve the result to undo the shift.
+    int32_t x = constrain(pitchQ15, -32768, 32767) + 32768;
+    int32_t index = x >> 10;
+    int32_t frac = x & 1023;
+    int32_t a = (int32_t)EXP2_TABLE[index];
+    int32_t b = (int32_t)EXP2_TABLE[index + 1];
+    return (uint32_t)(a + (((b - a) * frac) >> 10)) >> 1;
+}
+
+
+// -------------------------------------------------------------------
+// --- LFO CLASS IMPLEMENTATION ---
+// -------------------------------------------------------------------
+
+uint32_t Lfo::incrementFor(double rateHz) {
+    return (uint32_t)(constrain(rateHz, 0.01, 50.0) * 4294967296.0 / CONTROL_RATE);
+}
+
+void Lfo::setup(double rateHz, LfoShape type) {
+    rate = constrain(rateHz, 0.01, 50.0);
+    shape = type;
+    phaseIncrement = incrementFor(rate);
+}
+
+void Lfo::restore(double rateHz, LfoShape type, uint32_t increment) {
+    rate = rateHz;
+    shape = type;
+    phaseIncrement = increment;
+}
+
+int32_t Lfo::tick() {
+    uint32_t p = phase;
+    phase += phaseIncrement;
+
+    switch (shape) {
+        case LFO_TRIANGLE: {
+            int32_t u = (int32_t)(p >> 16);
+            return (p & 0x80000000u) ? (98303 - 2 * u) : (2 * u - 32768);
+        }
+        case LFO_SAW: return (int32_t)(p >> 16) - 32767;
+        case LFO_SQUARE: return (p & 0x80000000u) ? -32767 : 32767;
+        case LFO_SINE:
+        default: return SINE_TABLE[p >> PHASE_INDEX_SHIFT];
+    }
+}
+
+
+// -------------------------------------------------------------------
+// --- MOD MATRIX CLASS IMPLEMENTATION ---
+// -------------------------------------------------------------------
+
+void ModMatrix::begin() {
+    for (int l = 0; l < NUM_LFOS; l++) {
+        lfos[l].setup(lfos[l].getRate(), lfos[l].getShape());
+    }
+    compile();
+}
+
+void ModMatrix::compile() {
+    // Build into the bank the audio core is NOT reading, then publish it
+    int bank = 1 - activeBank;
+    int count = 0;
+    bool lfoRouted = false;
+
+    for (int i = 0; i < MAX_MOD_SLOTS; i++) {
+        const ModSlot& slot = slots[i];
+        if (slot.source == MOD_SRC_NONE || slot.dest == MOD_DST_NONE || slot.depth == 0.0) {
+            continue;
+        }
+        routes[bank][count].source = (uint8_t)slot.source;
+        routes[bank][count].dest = (uint8_t)slot.dest;
+        routes[bank][count].depth = (int32_t)(slot.depth * 32767.0);
+        if (slot.source >= MOD_SRC_LFO1 && slot.source <= MOD_SRC_LFO4) {
+            lfoRouted = true;
+        }
+        count++;
+    }
+
+    routeCount[bank] = count;
+    usesLfos = lfoRouted;
+    activeBank = bank;
+}
+
+void ModMatrix::updateSlot(int slot, ModSource source, ModDest dest, double depth) {
+    if (slot < 0 || slot >= MAX_MOD_SLOTS) return;
+
+    slots[slot].source = source;
+    slots[slot].dest = dest;
+    slots[slot].depth = constrain(depth, -1.0, 1.0);
+    compile();
+}
+
+void ModMatrix::setSlot(int slot, ModSource source, ModDest dest, double depth) {
+    if (slot < 0 || slot >= MAX_MOD_SLOTS) return;
+
+    updateSlot(slot, source, dest, depth);
+    Serial.printf("Mod: Slot %d -> src %d, dst %d, depth %.2f (%d active)\n", slot, source, dest, slots[slot].depth, routeCount[activeBank]);
+}
+
+void ModMatrix::setLfo(int lfo, double rateHz, LfoShape shape) {
+    if (lfo < 0 || lfo >= NUM_LFOS) return;
+
+    lfos[lfo].setup(rateHz, shape);
+    Serial.printf("Mod: LFO%d set to %.2f Hz, shape %d\n", lfo + 1, lfos[lfo].getRate(), shape);
+}
+
+ModState ModMatrix::saveState() const {
+    ModState state;
+    for (int l = 0; l < NUM_LFOS; l++) {
+        state.lfoPhase[l] = lfos[l].getPhase();
+        state.lfoValues[l] = lfoValues[l];
+    }
+    state.modWheel = modWheel;
+    return state;
+}
+
+void ModMatrix::restoreState(const ModState& state) {
+    for (int l = 0; l < NUM_LFOS; l++) {
+        lfos[l].setPhase(state.lfoPhase[l]);
+        lfoValues[l] = constrain(state.lfoValues[l], -32767, 32767);
+    }
+    modWheel = constrain(state.modWheel, 0, 32767);
+}
+
+void ModMatrix::tick() {
+    if (isEmpty() || !usesLfos) return;
+
+    for (int l = 0; l < NUM_LFOS; l++) {
+        lfoValues[l] = lfos[l].tick();
+    }
+}
+
+void ModMatrix::evaluate(int32_t envQ15, int32_t keyQ15, int32_t out[NUM_MOD_DESTS]) const {
+    for (int d = 0; d < NUM_MOD_DESTS; d++) {
+        out[d] = 0;
+    }
+
+    const int bank = activeBank;
+    const int count = routeCount[bank];
+    const ModRoute* route = routes[bank];
+
+    for (int r = 0; r < count; r++) {
+        int32_t value;
+        switch (route[r].source) {
+            case MOD_SRC_ENV: value = envQ15; break;
+            case MOD_SRC_KEY: value = keyQ15; break;
+            case MOD_SRC_MODWHEEL: value = modWheel; break;
+            default: value = lfoValues[route[r].source - MOD_SRC_LFO1]; break;
+        }
+        out[route[r].dest] += (value * route[r].depth) >> 15;
+    }
+
+    for (int d = 0; d < NUM_MOD_DESTS; d++) {
+        out[d] = constrain(out[d], -32767, 32767);
+    }
+}
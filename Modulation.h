@@ -0,0 +1,107 @@
+// modulation.h
+
+#ifndef MODULATION_H
+#define MODULATION_H
+
+#include <Arduino.h>
+
+// --- Modulation Constants ---
+#define NUM_LFOS 4
+#define MAX_MOD_SLOTS 6
+
+// LFO Shapes
+enum LfoShape { LFO_SINE, LFO_TRIANGLE, LFO_SAW, LFO_SQUARE };
+
+// Modulation Sources (LFOs are bipolar, ENV and MODWHEEL are unipolar, KEY is centred on C4)
+enum ModSource { MOD_SRC_NONE, MOD_SRC_LFO1, MOD_SRC_LFO2, MOD_SRC_LFO3, MOD_SRC_LFO4, MOD_SRC_ENV, MOD_SRC_KEY, MOD_SRC_MODWHEEL, NUM_MOD_SOURCES };
+
+// Modulation Destinations (full-scale depth: PITCH = +/-12 semitones, gains and pan = +/-1.0)
+enum ModDest { MOD_DST_NONE, MOD_DST_PITCH, MOD_DST_OSC1_GAIN, MOD_DST_OSC2_GAIN, MOD_DST_PAN, NUM_MOD_DESTS };
+
+// Unity pitch ratio in Q16
+#define PITCH_RATIO_UNITY 65536
+
+// --- Low Frequency Oscillator (control rate) ---
+class Lfo {
+private:
+    uint32_t phase = 0;
+    uint32_t phaseIncrement = 0;
+    LfoShape shape = LFO_SINE;
+    double rate = 1.0;
+
+public:
+    void setup(double rateHz, LfoShape type);
+    // Preset recall: takes an increment precomputed by incrementFor()
+    void restore(double rateHz, LfoShape type, uint32_t increment);
+    static uint32_t incrementFor(double rateHz);
+    double getRate() const { return rate; }
+    LfoShape getShape() const { return shape; }
+    uint32_t getPhase() const { return phase; }
+    void setPhase(uint32_t value) { phase = value; }
+    int32_t tick(); // Advance one control block, returns Q15 (-32767..32767)
+};
+
+// LFO phases and controller values carried between blocks (event log
+// snapshots); rates, shapes and routing are parameters
+struct ModState {
+    uint32_t lfoPhase[NUM_LFOS];
+    int32_t lfoValues[NUM_LFOS];
+    int32_t modWheel;
+};
+
+// --- Editable Slot (written by the Web UI) ---
+struct ModSlot {
+    ModSource source = MOD_SRC_NONE;
+    ModDest dest = MOD_DST_NONE;
+    double depth = 0.0; // -1.0 to 1.0 of the destination's full scale
+};
+
+// --- Compiled Route (read by the audio core) ---
+struct ModRoute {
+    uint8_t source;
+    uint8_t dest;
+    int32_t depth; // Q15
+};
+
+// --- Modulation Matrix ---
+// The UI edits 'slots'; each edit recompiles only the active slots into the
+// inactive half of a double-buffered route array and flips 'activeBank'.
+// The audio core reads one bank per block, so an empty matrix costs a single
+// compare and nothing is ever allocated.
+class ModMatrix {
+private:
+    ModSlot slots[MAX_MOD_SLOTS];
+    ModRoute routes[2][MAX_MOD_SLOTS];
+    int routeCount[2] = {0, 0};
+    volatile int activeBank = 0;
+
+    int32_t lfoValues[NUM_LFOS] = {0};
+    int32_t modWheel = 0; // Q15, from MIDI CC1
+    bool usesLfos = false;
+
+    void compile();
+
+public:
+    Lfo lfos[NUM_LFOS];
+
+    void begin();
+    void setSlot(int slot, ModSource source, ModDest dest, double depth);
+    void updateSlot(int slot, ModSource source, ModDest dest, double depth); // same, without logging
+    const ModSlot& getSlot(int slot) const { return slots[slot]; }
+    void setLfo(int lfo, double rateHz, LfoShape shape);
+    void setModWheel(int32_t valueQ15) { modWheel = valueQ15; }
+    ModState saveState() const;
+    void restoreState(const ModState& state);
+
+    bool isEmpty() const { return routeCount[activeBank] == 0; }
+
+    // Audio core, once per DMA block
+    void tick();
+    // envQ15: 0..32767, keyQ15: bipolar key position; out[] receives Q15 sums per destination
+    void evaluate(int32_t envQ15, int32_t keyQ15, int32_t out[NUM_MOD_DESTS]) const;
+};
+
+// Q15 pitch offset (full scale = +/-1 octave) to Q16 frequency ratio
+uint32_t pitchRatioQ16(int32_t pitchQ15);
+
+#endif
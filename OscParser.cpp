@@ -0,0 +1,170 @@
+// oscparser.cpp
+
+#include "OscParser.h"
+#include <string.h>
+
+static const char EMPTY_TYPE_TAGS[] = "";
+
+static uint32_t readUint32(const uint8_t* p) {
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+static uint64_t readUint64(const uint8_t* p) {
+    return (uint64_t)readUint32(p) << 32 | readUint32(p + 4);
+}
+
+// Size of a NUL-terminated, 4-byte padded string at 'p', or 0 if it overruns 'end'
+static size_t paddedStringSize(const uint8_t* p, const uint8_t* end) {
+    const uint8_t* nul = (const uint8_t*)memchr(p, 0, end - p);
+    if (nul == NULL) return 0;
+
+    size_t size = (nul - p + 4) & ~(size_t)3;
+    return (size <= (size_t)(end - p)) ? size : 0;
+}
+
+// Bytes taken by one argument of 'type' at 'p', or -1 if malformed
+static long argSize(char type, const uint8_t* p, const uint8_t* end) {
+    size_t remaining = end - p;
+
+    switch (type) {
+        case 'i': case 'f': case 'c': case 'r': case 'm':
+            return (remaining >= 4) ? 4 : -1;
+        case 'h': case 'd': case 't':
+            return (remaining >= 8) ? 8 : -1;
+        case 's': case 'S': {
+            size_t size = (remaining > 0) ? paddedStringSize(p, end) : 0;
+            return (size > 0) ? (long)size : -1;
+        }
+        case 'b': {
+            if (remaining < 4) return -1;
+            // Compare before padding: a length near 2^32 would wrap the sum
+            uint32_t blobLength = readUint32(p);
+            if (blobLength > remaining - 4) return -1;
+            size_t size = 4 + (((size_t)blobLength + 3) & ~(size_t)3);
+            return (size <= remaining) ? (long)size : -1;
+        }
+        case 'T': case 'F': case 'N': case 'I': case '[': case ']':
+            return 0;
+        default:
+            return -1;
+    }
+}
+
+static bool parseMessage(const uint8_t* p, size_t length, uint64_t timeTag, OscMessage& message) {
+    const uint8_t* end = p + length;
+
+    size_t addressSize = paddedStringSize(p, end);
+    if (addressSize == 0 || p[0] != '/') return false;
+
+    message.address = (const char*)p;
+    message.timeTag = timeTag;
+    p += addressSize;
+
+    // Type tags are optional in OSC 1.0; a bare address carries no arguments
+    if (p == end) {
+        message.typeTags = EMPTY_TYPE_TAGS;
+        message.args = message.end = end;
+        return true;
+    }
+
+    size_t tagsSize = paddedStringSize(p, end);
+    if (tagsSize == 0 || p[0] != ',') return false;
+
+    message.typeTags = (const char*)p + 1;
+    p += tagsSize;
+    message.args = p;
+    message.end = end;
+
+    for (const char* tag = message.typeTags; *tag != '\0'; tag++) {
+        long size = argSize(*tag, p, end);
+        if (size < 0) return false;
+        p += size;
+    }
+    return p == end;
+}
+
+// handler == NULL: validation pass only
+static bool parseElement(const uint8_t* p, size_t length, uint64_t timeTag, int depth,
+                         OscMessageHandler handler, void* context) {
+    if (length == 0 || (length & 3) != 0) return false;
+
+    if (length >= 8 && memcmp(p, "#bundle", 8) == 0) {
+        if (length < 16 || depth >= OSC_MAX_BUNDLE_DEPTH) return false;
+
+        uint64_t bundleTag = readUint64(p + 8);
+        const uint8_t* element = p + 16;
+        const uint8_t* end = p + length;
+
+        while (element < end) {
+            if (end - element < 4) return false;
+            uint32_t size = readUint32(element);
+            element += 4;
+            if (size > (uint32_t)(end - element)) return false;
+
+            if (!parseElement(element, size, bundleTag, depth + 1, handler, context)) return false;
+            element += size;
+        }
+        return true;
+    }
+
+    OscMessage message;
+    if (!parseMessage(p, length, timeTag, message)) return false;
+
+    if (handler != NULL) {
+        handler(message, context);
+    }
+    return true;
+}
+
+bool oscParsePacket(const uint8_t* packet, size_t length, OscMessageHandler handler, void* context) {
+    // Two passes over the same bytes: a malformed tail never half-applies a packet
+    if (!parseElement(packet, length, OSC_TIMETAG_IMMEDIATE, 0, NULL, NULL)) return false;
+    return parseElement(packet, length, OSC_TIMETAG_IMMEDIATE, 0, handler, context);
+}
+
+int oscArgCount(const OscMessage& message) {
+    return (int)strlen(message.typeTags);
+}
+
+bool oscArgAsFloat(const OscMessage& message, int index, float& value) {
+    const uint8_t* p = message.args;
+
+    for (int i = 0; message.typeTags[i] != '\0'; i++) {
+        char type = message.typeTags[i];
+
+        if (i == index) {
+            switch (type) {
+                case 'i':
+                    value = (float)(int32_t)readUint32(p);
+                    return true;
+                case 'f': {
+                    uint32_t bits = readUint32(p);
+                    memcpy(&value, &bits, sizeof(value));
+                    return true;
+                }
+                case 'h':
+                    value = (float)(int64_t)readUint64(p);
+                    return true;
+                case 'd': {
+                    uint64_t bits = readUint64(p);
+                    double wide;
+                    memcpy(&wide, &bits, sizeof(wide));
+                    value = (float)wide;
+                    return true;
+                }
+                case 'T': value = 1.0f; return true;
+                case 'F': value = 0.0f; return true;
+                default: return false;
+            }
+        }
+        // Already validated by oscParsePacket
+        p += argSize(type, p, message.end);
+    }
+    return false;
+}
+
+uint32_t oscTimeTagToMicros(uint64_t timeTag) {
+    uint64_t seconds = timeTag >> 32;
+    uint64_t fraction = timeTag & 0xFFFFFFFFULL;
+    return (uint32_t)(seconds * 1000000ULL + ((fraction * 1000000ULL) >> 32));
+}
@@ -0,0 +1,42 @@
+// oscparser.h
+
+#ifndef OSC_PARSER_H
+#define OSC_PARSER_H
+
+// Plain C++ (no Arduino dependencies) so packets can be parsed on a host,
+// e.g. fed from a loopback UDP socket.
+#include <stdint.h>
+#include <stddef.h>
+
+// NTP-format timetag meaning "as soon as possible"
+#define OSC_TIMETAG_IMMEDIATE 1ULL
+#define OSC_MAX_BUNDLE_DEPTH 4
+
+// --- Zero-Copy Message View ---
+// Every pointer refers into the caller's packet buffer; nothing is copied.
+struct OscMessage {
+    const char* address;     // NUL-terminated, e.g. "/note/on"
+    const char* typeTags;    // NUL-terminated, without the leading ','
+    const uint8_t* args;     // first argument (big-endian, 4-byte aligned)
+    const uint8_t* end;      // one past the last argument byte
+    uint64_t timeTag;        // enclosing bundle's timetag, or OSC_TIMETAG_IMMEDIATE
+};
+
+typedef void (*OscMessageHandler)(const OscMessage& message, void* context);
+
+// Validates the whole packet (message or nested bundles) before the handler
+// sees anything: either every message is delivered in order and true is
+// returned, or nothing is delivered. Never allocates.
+bool oscParsePacket(const uint8_t* packet, size_t length, OscMessageHandler handler, void* context);
+
+// Number of arguments described by the type tags
+int oscArgCount(const OscMessage& message);
+
+// Reads argument 'index' as a number. Accepts i, f, h, d, T and F; returns
+// false for other types or a missing argument.
+bool oscArgAsFloat(const OscMessage& message, int index, float& value);
+
+// OSC timetag (NTP seconds.fraction) to microseconds, modulo 2^32
+uint32_t oscTimeTagToMicros(uint64_t timeTag);
+
+#endif
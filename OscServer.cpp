@@ -0,0 +1,136 @@
+// oscserver.cpp
+
+#include "OscServer.h"
+#include "Synth.h"
+#include <string.h>
+#include <math.h>
+
+void OscServer::begin() {
+    udp.begin(OSC_PORT);
+    Serial.printf("OSC: Listening on UDP port %d.\n", OSC_PORT);
+}
+
+void OscServer::poll() {
+    for (int i = 0; i < OSC_MAX_PACKETS_PER_POLL; i++) {
+        int size = udp.parsePacket();
+        if (size <= 0) return;
+
+        packetMicros = micros();
+        packetsReceived++;
+
+        if (size > OSC_MAX_PACKET_SIZE) {
+            udp.flush();
+            packetsRejected++;
+            continue;
+        }
+
+        int length = udp.read(packet, sizeof(packet));
+        batchCount = 0;
+
+        bool valid = (length == size) && oscParsePacket(packet, length, onMessage, this);
+        if (resyncClock) {
+            // Deferred so every message of one bundle shares the same mapping
+            clockSynced = false;
+            resyncClock = false;
+        }
+        if (!valid) {
+            packetsRejected++;
+            continue;
+        }
+
+        if (batchCount > 0 && !synth.applyParams(batch, batchCount)) {
+            packetsRejected++;
+        }
+    }
+}
+
+void OscServer::onMessage(const OscMessage& message, void* context) {
+    ((OscServer*)context)->handleMessage(message);
+}
+
+uint32_t OscServer::dueMicros(uint64_t timeTag) {
+    if (timeTag == OSC_TIMETAG_IMMEDIATE) return 0;
+
+    uint32_t tagMicros = oscTimeTagToMicros(timeTag);
+    int32_t offset = (int32_t)(packetMicros - tagMicros);
+
+    // Track the fastest delivery seen
+    if (!clockSynced || offset < clockOffsetUs) {
+        clockOffsetUs = offset;
+        clockSynced = true;
+    }
+
+    // Relative timing between bundles is kept; the fastest one plays after exactly the margin
+    int32_t aheadUs = OSC_SCHEDULE_MARGIN_US - (offset - clockOffsetUs);
+    if (aheadUs <= 0) {
+        // Later than the margin allows (jitter spike or clock drift): play now,
+        // and re-learn the offset from the next packet
+        lateMessages++;
+        resyncClock = true;
+        return 0;
+    }
+
+    uint32_t due = packetMicros + aheadUs;
+    return (due != 0) ? due : 1;
+}
+
+// Numeric argument as an int in [low, high]: network floats are clamped
+// before the conversion, which is undefined for NaN, inf and values past int
+static bool oscArgAsInt(const OscMessage& message, int index, int low, int high, int& out) {
+    float value;
+    if (!oscArgAsFloat(message, index, value) || !isfinite(value)) return false;
+    out = (int)constrain(value, (float)low, (float)high);
+    return true;
+}
+
+void OscServer::handleMessage(const OscMessage& message) {
+    const char* address = message.address;
+    uint32_t due = dueMicros(message.timeTag);
+    int a = 0, b = 0;
+
+    if (strncmp(address, "/param/", 7) == 0) {
+        handleParam(address + 7, message, due);
+    } else if (strcmp(address, "/note/on") == 0) {
+        // No velocity plays the default one; a non-finite one drops the message
+        float velocity;
+        if (!oscArgAsInt(message, 0, 0, 127, a)) return;
+        if (!oscArgAsFloat(message, 1, velocity)) {
+            b = OSC_DEFAULT_VELOCITY;
+        } else if (!oscArgAsInt(message, 1, 0, 127, b)) {
+            return;
+        }
+
+        if (b > 0) {
+            synth.noteOn(a, b, packetMicros, -1, due);
+        } else {
+            synth.noteOff(a, packetMicros, due);
+        }
+    } else if (strcmp(address, "/note/off") == 0) {
+        if (oscArgAsInt(message, 0, 0, 127, a)) {
+            synth.noteOff(a, packetMicros, due);
+        }
+    } else if (strcmp(address, "/bend") == 0) {
+        if (oscArgAsInt(message, 0, -8192, 8191, a)) {
+            synth.pitchBend(a, packetMicros, due);
+        }
+    } else if (strcmp(address, "/cc") == 0) {
+        if (oscArgAsInt(message, 0, 0, 127, a) && oscArgAsInt(message, 1, 0, 127, b)) {
+            synth.controlChange(a, b, packetMicros, due);
+        }
+    }
+}
+
+void OscServer::handleParam(const char* name, const OscMessage& message, uint32_t dueMicros) {
+    float value;
+    int id = findParam(name);
+
+    if (id < 0 || !oscArgAsFloat(message, 0, value) || !paramInRange(id, value)) return;
+
+    if (dueMicros != 0) {
+        synth.scheduleParam((uint8_t)id, value, packetMicros, dueMicros);
+    } else if (batchCount < MAX_PARAMS_PER_FRAME) {
+        batch[batchCount].id = (uint8_t)id;
+        batch[batchCount].value = value;
+        batchCount++;
+    }
+}
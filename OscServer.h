@@ -0,0 +1,60 @@
+// oscserver.h
+
+#ifndef OSC_SERVER_H
+#define OSC_SERVER_H
+
+#include <Arduino.h>
+#include <WiFiUdp.h>
+#include "OscParser.h"
+#include "ParamFrame.h"
+
+// --- OSC (UDP) Configuration ---
+// Address space:
+//   /note/on  note [velocity]     velocity 0 = note off, default 100
+//   /note/off note
+//   /bend     value               -8192 to 8191
+//   /cc       controller value
+//   /param/<name> value           any PARAM_INFO name, e.g. /param/attack 0.2
+// Bundles with a timetag are played on the audio sample clock. The sender's
+// clock offset is learned from the earliest-arriving bundle and every bundle is
+// delayed by OSC_SCHEDULE_MARGIN_US, so network jitter below the margin does
+// not reach the audio.
+#define OSC_PORT 8000
+#define OSC_MAX_PACKET_SIZE 1024
+#define OSC_MAX_PACKETS_PER_POLL 8
+#define OSC_SCHEDULE_MARGIN_US 20000
+#define OSC_DEFAULT_VELOCITY 100
+
+class OscServer {
+private:
+    WiFiUDP udp;
+    uint8_t packet[OSC_MAX_PACKET_SIZE];
+    uint32_t packetMicros = 0;   // arrival time of the packet being handled
+
+    // Untimed /param writes from one packet, applied as a single batch
+    ParamUpdate batch[MAX_PARAMS_PER_FRAME];
+    int batchCount = 0;
+
+    // Sender timetag -> local micros() mapping
+    bool clockSynced = false;
+    int32_t clockOffsetUs = 0;
+    bool resyncClock = false;
+
+    static void onMessage(const OscMessage& message, void* context);
+    void handleMessage(const OscMessage& message);
+    void handleParam(const char* name, const OscMessage& message, uint32_t dueMicros);
+    uint32_t dueMicros(uint64_t timeTag);
+
+public:
+    // Counters since boot
+    uint32_t packetsReceived = 0;
+    uint32_t packetsRejected = 0;
+    uint32_t lateMessages = 0;    // timed messages that arrived too late to schedule
+
+    void begin();
+    void poll(); // Drain pending datagrams into the engine (call after Wi-Fi is up)
+};
+
+extern OscServer oscServer;
+
+#endif
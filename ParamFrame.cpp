@@ -0,0 +1,163 @@
+// paramframe.cpp
+
+#include "ParamFrame.h"
+#include <string.h>
+
+// Indexed by ParamId. Ranges are in engine units (seconds, 0-1 gains, cents...).
+const ParamInfo PARAM_INFO[NUM_PARAMS] = {
+    { "osc1_wave", 0.0f, 4.0f },
+    { "osc2_wave", 0.0f, 3.0f },
+    { "osc1_gain", 0.0f, 1.0f },
+    { "osc2_gain", 0.0f, 1.0f },
+    { "osc2_enabled", 0.0f, 1.0f },
+    { "attack", 0.0f, 10.0f },
+    { "decay", 0.0f, 10.0f },
+    { "sustain", 0.0f, 1.0f },
+    { "release", 0.0f, 10.0f },
+    { "root_note", 0.0f, 127.0f },
+    { "scale_type", 0.0f, 5.0f },
+    { "unison_voices", 1.0f, 8.0f },
+    { "unison_detune", 0.0f, 100.0f },
+    { "stereo_spread", 0.0f, 1.0f },
+    { "synth_mode", 0.0f, 1.0f },
+    { "fm_ratio", 0.25f, 16.0f },
+    { "fm_index", 0.0f, 10.0f },
+    { "pitch_bend_range", 0.0f, 12.0f },  // pitchRatioQ16 spans +/-1 octave
+    { "lfo1_rate", 0.01f, 50.0f },
+    { "lfo2_rate", 0.01f, 50.0f },
+    { "lfo3_rate", 0.01f, 50.0f },
+    { "lfo4_rate", 0.01f, 50.0f },
+    { "lfo1_shape", 0.0f, 3.0f },
+    { "lfo2_shape", 0.0f, 3.0f },
+    { "lfo3_shape", 0.0f, 3.0f },
+    { "lfo4_shape", 0.0f, 3.0f },
+    { "mod1_source", 0.0f, 7.0f },
+    { "mod2_source", 0.0f, 7.0f },
+    { "mod3_source", 0.0f, 7.0f },
+    { "mod4_source", 0.0f, 7.0f },
+    { "mod5_source", 0.0f, 7.0f },
+    { "mod6_source", 0.0f, 7.0f },
+    { "mod1_dest", 0.0f, 4.0f },
+    { "mod2_dest", 0.0f, 4.0f },
+    { "mod3_dest", 0.0f, 4.0f },
+    { "mod4_dest", 0.0f, 4.0f },
+    { "mod5_dest", 0.0f, 4.0f },
+    { "mod6_dest", 0.0f, 4.0f },
+    { "mod1_depth", -1.0f, 1.0f },
+    { "mod2_depth", -1.0f, 1.0f },
+    { "mod3_depth", -1.0f, 1.0f },
+    { "mod4_depth", -1.0f, 1.0f },
+    { "mod5_depth", -1.0f, 1.0f },
+    { "mod6_depth", -1.0f, 1.0f },
+    { "key1_note", 0.0f, 127.0f },
+    { "key2_note", 0.0f, 127.0f },
+    { "key3_note", 0.0f, 127.0f },
+    { "key4_note", 0.0f, 127.0f },
+    { "key5_note", 0.0f, 127.0f },
+    { "key6_note", 0.0f, 127.0f },
+    { "key7_note", 0.0f, 127.0f },
+    { "key8_note", 0.0f, 127.0f },
+    { "key9_note", 0.0f, 127.0f },
+    { "key10_note", 0.0f, 127.0f },
+    { "key11_note", 0.0f, 127.0f },
+    { "key12_note", 0.0f, 127.0f },
+    { "key13_note", 0.0f, 127.0f },
+    { "key14_note", 0.0f, 127.0f },
+    { "key15_note", 0.0f, 127.0f },
+    { "key16_note", 0.0f, 127.0f },
+    { "seq_mode", 0.0f, 2.0f },
+    { "arp_mode", 0.0f, 3.0f },
+    { "seq_tempo", 20.0f, 300.0f },
+    { "seq_gate", 5.0f, 100.0f },
+    { "seq_length", 1.0f, 16.0f },
+    { "step1_note", 0.0f, 127.0f },
+    { "step2_note", 0.0f, 127.0f },
+    { "step3_note", 0.0f, 127.0f },
+    { "step4_note", 0.0f, 127.0f },
+    { "step5_note", 0.0f, 127.0f },
+    { "step6_note", 0.0f, 127.0f },
+    { "step7_note", 0.0f, 127.0f },
+    { "step8_note", 0.0f, 127.0f },
+    { "step9_note", 0.0f, 127.0f },
+    { "step10_note", 0.0f, 127.0f },
+    { "step11_note", 0.0f, 127.0f },
+    { "step12_note", 0.0f, 127.0f },
+    { "step13_note", 0.0f, 127.0f },
+    { "step14_note", 0.0f, 127.0f },
+    { "step15_note", 0.0f, 127.0f },
+    { "step16_note", 0.0f, 127.0f },
+    { "step1_velocity", 0.0f, 127.0f },
+    { "step2_velocity", 0.0f, 127.0f },
+    { "step3_velocity", 0.0f, 127.0f },
+    { "step4_velocity", 0.0f, 127.0f },
+    { "step5_velocity", 0.0f, 127.0f },
+    { "step6_velocity", 0.0f, 127.0f },
+    { "step7_velocity", 0.0f, 127.0f },
+    { "step8_velocity", 0.0f, 127.0f },
+    { "step9_velocity", 0.0f, 127.0f },
+    { "step10_velocity", 0.0f, 127.0f },
+    { "step11_velocity", 0.0f, 127.0f },
+    { "step12_velocity", 0.0f, 127.0f },
+    { "step13_velocity", 0.0f, 127.0f },
+    { "step14_velocity", 0.0f, 127.0f },
+    { "step15_velocity", 0.0f, 127.0f },
+    { "step16_velocity", 0.0f, 127.0f },
+    { "sample", 0.0f, 31.0f },
+};
+
+int findParam(const char* name) {
+    for (int id = 0; id < NUM_PARAMS; id++) {
+        if (strcmp(PARAM_INFO[id].name, name) == 0) return id;
+    }
+    return -1;
+}
+
+bool paramInRange(int id, float value) {
+    if (id < 0 || id >= NUM_PARAMS) return false;
+    // NaN fails both comparisons
+    return value >= PARAM_INFO[id].minValue && value <= PARAM_INFO[id].maxValue;
+}
+
+int parseParamFrame(const uint8_t* frame, size_t length, ParamUpdate* updates, int maxUpdates) {
+    if (length < PARAM_FRAME_HEADER_SIZE || frame[0] != PARAM_FRAME_MAGIC) return -1;
+
+    int count = frame[1];
+    if (count > maxUpdates || length != PARAM_FRAME_HEADER_SIZE + (size_t)count * PARAM_FRAME_ENTRY_SIZE) return -1;
+
+    const uint8_t* entry = frame + PARAM_FRAME_HEADER_SIZE;
+    for (int i = 0; i < count; i++, entry += PARAM_FRAME_ENTRY_SIZE) {
+        uint8_t id = entry[0];
+        float value;
+        // Both ends are little-endian (ESP32, browsers on x86/ARM)
+        memcpy(&value, entry + 1, sizeof(value));
+
+        if (!paramInRange(id, value)) return -1;
+
+        updates[i].id = id;
+        updates[i].value = value;
+    }
+
+    return count;
+}
+
+static int hexDigit(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+int decodeHexFrame(const char* hex, uint8_t* out, size_t maxLength) {
+    size_t length = 0;
+
+    while (hex[0] != '\0') {
+        int high = hexDigit(hex[0]);
+        int low = (high < 0) ? -1 : hexDigit(hex[1]);
+        if (low < 0 || length >= maxLength) return -1;
+
+        out[length++] = (uint8_t)(high << 4 | low);
+        hex += 2;
+    }
+
+    return (int)length;
+}
@@ -0,0 +1,68 @@
+// paramframe.h
+
+#ifndef PARAM_FRAME_H
+#define PARAM_FRAME_H
+
+// Plain C++ (no Arduino dependencies) so frames can be parsed on a host machine.
+#include <stdint.h>
+#include <stddef.h>
+
+// --- Parameter IDs (dense, indexes PARAM_INFO) ---
+enum ParamId {
+    PARAM_OSC1_WAVE, PARAM_OSC2_WAVE, PARAM_OSC1_GAIN, PARAM_OSC2_GAIN, PARAM_OSC2_ENABLED,
+    PARAM_ATTACK, PARAM_DECAY, PARAM_SUSTAIN, PARAM_RELEASE,
+    PARAM_ROOT_NOTE, PARAM_SCALE_TYPE,
+    PARAM_UNISON_VOICES, PARAM_UNISON_DETUNE, PARAM_STEREO_SPREAD,
+    PARAM_SYNTH_MODE, PARAM_FM_RATIO, PARAM_FM_INDEX,
+    PARAM_PITCH_BEND_RANGE,
+    PARAM_LFO_RATE,                  // + lfo (0-3)
+    PARAM_LFO_SHAPE = PARAM_LFO_RATE + 4,
+    PARAM_MOD_SOURCE = PARAM_LFO_SHAPE + 4, // + slot (0-5)
+    PARAM_MOD_DEST = PARAM_MOD_SOURCE + 6,
+    PARAM_MOD_DEPTH = PARAM_MOD_DEST + 6,
+    PARAM_KEY_NOTE = PARAM_MOD_DEPTH + 6,   // + key (0-15), custom map
+    PARAM_SEQ_MODE = PARAM_KEY_NOTE + 16,
+    PARAM_ARP_MODE, PARAM_SEQ_TEMPO, PARAM_SEQ_GATE, PARAM_SEQ_LENGTH,
+    PARAM_SEQ_NOTE,                         // + step (0-15)
+    PARAM_SEQ_VELOCITY = PARAM_SEQ_NOTE + 16,
+    PARAM_SAMPLE = PARAM_SEQ_VELOCITY + 16, // bank index played by the Sample waveform
+    NUM_PARAMS
+};
+
+struct ParamInfo {
+    const char* name;   // also used as the OSC/log name
+    float minValue;
+    float maxValue;
+};
+
+extern const ParamInfo PARAM_INFO[NUM_PARAMS];
+
+// ParamId for a PARAM_INFO name, or -1
+int findParam(const char* name);
+// True if 'id' exists and 'value' lies within its range (false for NaN)
+bool paramInRange(int id, float value);
+
+struct ParamUpdate {
+    uint8_t id;
+    float value;
+};
+
+// --- Binary Frame Layout ---
+//   [0]     PARAM_FRAME_MAGIC
+//   [1]     entry count N
+//   [2..]   N x { id (uint8), value (float32, little-endian) }
+#define PARAM_FRAME_MAGIC 0x50
+#define PARAM_FRAME_HEADER_SIZE 2
+#define PARAM_FRAME_ENTRY_SIZE 5
+#define MAX_PARAMS_PER_FRAME 64
+#define MAX_PARAM_FRAME_SIZE (PARAM_FRAME_HEADER_SIZE + MAX_PARAMS_PER_FRAME * PARAM_FRAME_ENTRY_SIZE)
+
+// Validates the whole frame before returning anything: either every entry is
+// in range and the entry count is returned, or -1 and 'updates' is unusable.
+// Never allocates.
+int parseParamFrame(const uint8_t* frame, size_t length, ParamUpdate* updates, int maxUpdates);
+
+// Decodes a hex-text frame (HTTP fallback) into 'out'; returns bytes or -1
+int decodeHexFrame(const char* hex, uint8_t* out, size_t maxLength);
+
+#endif
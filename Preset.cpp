@@ -0,0 +1,137 @@
+// preset.cpp
+
+#include "Preset.h"
+#include <stddef.h>
+#include <string.h>
+
+// -------------------------------------------------------------------
+// --- PRESET FORMAT ---
+// -------------------------------------------------------------------
+
+uint32_t presetCrc(const Preset& preset) {
+    const uint8_t* data = (const uint8_t*)&preset;
+    uint32_t crc = 0xFFFFFFFF;
+
+    for (size_t i = 0; i < offsetof(Preset, crc); i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+bool presetIsValid(const Preset& preset) {
+    if (preset.magic != PRESET_MAGIC || preset.version != PRESET_VERSION || preset.size != sizeof(Preset)) return false;
+    if (preset.crc != presetCrc(preset)) return false;
+
+    for (int id = 0; id < NUM_PARAMS; id++) {
+        if (!paramInRange(id, preset.params[id])) return false;
+    }
+    return preset.unison.count >= 1 && preset.unison.count <= MAX_UNISON;
+}
+
+void presetCapture(Preset& preset, const char* name) {
+    // Zeroed first so padding and the name tail are deterministic for the CRC
+    memset(&preset, 0, sizeof(Preset));
+    preset.magic = PRESET_MAGIC;
+    preset.version = PRESET_VERSION;
+    preset.size = sizeof(Preset);
+    strncpy(preset.name, name, PRESET_NAME_LENGTH - 1);
+
+    for (int id = 0; id < NUM_PARAMS; id++) {
+        preset.params[id] = constrain(synth.getParam(id), PARAM_INFO[id].minValue, PARAM_INFO[id].maxValue);
+    }
+
+    const float* p = preset.params;
+    preset.envelope = Envelope::computeCoefficients(p[PARAM_ATTACK], p[PARAM_DECAY], p[PARAM_SUSTAIN], p[PARAM_RELEASE]);
+    preset.unison = UnisonOscillator::computeCoefficients((int)p[PARAM_UNISON_VOICES], p[PARAM_UNISON_DETUNE], p[PARAM_STEREO_SPREAD]);
+    preset.fmDepth = fmDepthForIndex(p[PARAM_FM_INDEX]);
+    for (int l = 0; l < NUM_LFOS; l++) {
+        preset.lfoIncrement[l] = Lfo::incrementFor(p[PARAM_LFO_RATE + l]);
+    }
+
+    preset.crc = presetCrc(preset);
+}
+
+
+// -------------------------------------------------------------------
+// --- PRESET BANK IMPLEMENTATION ---
+// -------------------------------------------------------------------
+
+void PresetBank::slotKey(int slot, char* key) {
+    snprintf(key, 4, "p%d", slot);
+}
+
+void PresetBank::begin() {
+    prefs.begin(PRESET_NVS_NAMESPACE, false);
+
+    int loaded = 0;
+    for (int slot = 0; slot < NUM_PRESET_SLOTS; slot++) {
+        char key[4];
+        slotKey(slot, key);
+
+        size_t length = prefs.getBytes(key, &slots[slot], sizeof(Preset));
+        if (length == sizeof(Preset) && presetIsValid(slots[slot])) {
+            loaded++;
+        } else {
+            // Missing, truncated, corrupt or from an older layout
+            memset(&slots[slot], 0, sizeof(Preset));
+        }
+    }
+    Serial.printf("Presets: %d of %d slots loaded from NVS.\n", loaded, NUM_PRESET_SLOTS);
+
+    int last = prefs.getChar("active", -1);
+    if (isUsed(last)) {
+        recall(last);
+    }
+}
+
+bool PresetBank::store(int slot, const char* name) {
+    if (slot < 0 || slot >= NUM_PRESET_SLOTS) return false;
+
+    presetCapture(slots[slot], name);
+
+    char key[4];
+    slotKey(slot, key);
+    if (prefs.putBytes(key, &slots[slot], sizeof(Preset)) != sizeof(Preset)) {
+        Serial.printf("Presets: Writing slot %d to NVS failed.\n", slot + 1);
+        return false;
+    }
+
+    activeSlot = slot;
+    prefs.putChar("active", slot);
+    Serial.printf("Presets: Stored \"%s\" in slot %d (%u bytes).\n", slots[slot].name, slot + 1, (unsigned)sizeof(Preset));
+    return true;
+}
+
+bool PresetBank::recall(int slot) {
+    if (!isUsed(slot)) return false;
+
+    // The audio core still owns recallBuffer until it has taken the last recall
+    if (synth.isPresetPending()) return false;
+
+    memcpy(&recallBuffer, &slots[slot], sizeof(Preset));
+    synth.recallPreset(&recallBuffer);
+
+    activeSlot = slot;
+    prefs.putChar("active", slot);
+    Serial.printf("Presets: Recalled \"%s\" from slot %d.\n", slots[slot].name, slot + 1);
+    return true;
+}
+
+bool PresetBank::erase(int slot) {
+    if (!isUsed(slot)) return false;
+
+    char key[4];
+    slotKey(slot, key);
+    prefs.remove(key);
+    memset(&slots[slot], 0, sizeof(Preset));
+
+    if (activeSlot == slot) {
+        activeSlot = -1;
+        prefs.remove("active");
+    }
+    Serial.printf("Presets: Erased slot %d.\n", slot + 1);
+    return true;
+}
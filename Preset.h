@@ -0,0 +1,67 @@
+// preset.h
+
+#ifndef PRESET_H
+#define PRESET_H
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include "Synth.h"
+
+// --- Preset Format ---
+#define PRESET_MAGIC 0x54535250   // "PRST"
+#define PRESET_VERSION 3          // bump when the layout or a coefficient formula changes
+#define PRESET_NAME_LENGTH 16
+#define NUM_PRESET_SLOTS 8
+#define PRESET_NVS_NAMESPACE "presets"
+
+// Fixed layout, stored as one NVS blob per slot. Besides every parameter it
+// carries the engine coefficients derived from them, computed on core 0 when
+// the preset is stored, so recall on the audio core is copies only.
+struct Preset {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t size;                    // sizeof(Preset), rejects blobs from another layout
+    char name[PRESET_NAME_LENGTH];    // NUL-terminated
+    float params[NUM_PARAMS];         // indexed by ParamId; KEY_NOTE holds the resolved key map
+
+    // Precomputed engine coefficients
+    EnvelopeCoefficients envelope;
+    UnisonCoefficients unison;
+    int32_t fmDepth;
+    uint32_t lfoIncrement[NUM_LFOS];
+
+    uint32_t crc;                     // CRC-32 of every byte above
+};
+
+// Captures the synth's current sound into 'preset' and fills in the coefficients
+void presetCapture(Preset& preset, const char* name);
+// Magic, version, size, CRC and parameter ranges
+bool presetIsValid(const Preset& preset);
+uint32_t presetCrc(const Preset& preset);
+
+// --- Preset Bank ---
+// NUM_PRESET_SLOTS presets held in RAM and mirrored to NVS. Everything here runs
+// on core 0; only recallBuffer is handed to the audio core.
+class PresetBank {
+private:
+    Preset slots[NUM_PRESET_SLOTS];
+    Preset recallBuffer;
+    Preferences prefs;
+    int activeSlot = -1;
+
+    static void slotKey(int slot, char* key);
+
+public:
+    void begin(); // Load the bank from NVS and recall the last active preset
+    bool store(int slot, const char* name);
+    bool recall(int slot);
+    bool erase(int slot);
+
+    bool isUsed(int slot) const { return slot >= 0 && slot < NUM_PRESET_SLOTS && slots[slot].magic == PRESET_MAGIC; }
+    const char* getName(int slot) const { return slots[slot].name; }
+    int getActiveSlot() const { return activeSlot; }
+};
+
+extern PresetBank presetBank;
+
+#endif
@@ -0,0 +1,145 @@
+// samplebank.cpp
+
+#include "SampleBank.h"
+#include <math.h>
+#include <string.h>
+
+// -------------------------------------------------------------------
+// --- SAMPLE BANK ---
+// -------------------------------------------------------------------
+
+bool SampleBank::attach(const uint8_t* image, size_t imageSize) {
+    count = 0;
+    if (image == NULL || imageSize < sizeof(SampleBankHeader)) return false;
+
+    const SampleBankHeader* header = (const SampleBankHeader*)image;
+    if (header->magic != SAMPLE_BANK_MAGIC || header->version != SAMPLE_BANK_VERSION) return false;
+    if (header->count > SAMPLE_BANK_MAX_SAMPLES) return false;
+    if (sizeof(SampleBankHeader) + header->count * sizeof(SampleInfo) > imageSize) return false;
+
+    const SampleInfo* table = (const SampleInfo*)(image + sizeof(SampleBankHeader));
+    for (int i = 0; i < header->count; i++) {
+        const SampleInfo& info = table[i];
+        bool looped = info.loopEnd != 0;
+
+        if ((info.offset & 3) != 0 || info.offset > imageSize) return false;
+        if (info.length == 0 || info.length > (imageSize - info.offset) / sizeof(int16_t)) return false;
+        if (looped && (info.loopStart >= info.loopEnd || info.loopEnd > info.length)) return false;
+        if (info.sampleRate == 0 || info.rootNote > 127) return false;
+        if (memchr(info.name, 0, SAMPLE_NAME_LENGTH) == NULL) return false;
+
+        double rootFrequency = 440.0 * pow(2.0, (info.rootNote - 69) / 12.0);
+        rootIncrement[i] = (uint32_t)(rootFrequency * 4294967296.0 / info.sampleRate);
+    }
+
+    base = image;
+    infos = table;
+    count = header->count;
+    return true;
+}
+
+// A note at 'increment' plays the sample faster than its root by
+// increment / rootIncrement; as a Q16 step through the sample's frames
+uint32_t SampleBank::stepFor(int index, uint32_t increment) const {
+    uint64_t step = ((uint64_t)increment << 16) / rootIncrement[index];
+    return (step > SAMPLE_MAX_STEP) ? SAMPLE_MAX_STEP : (uint32_t)step;
+}
+
+
+// -------------------------------------------------------------------
+// --- SAMPLE PLAYER ---
+// -------------------------------------------------------------------
+
+void SamplePlayer::start(const SampleBank& bank, int entry) {
+    if (entry < 0 || entry >= bank.getCount()) {
+        active = false;
+        return;
+    }
+
+    const SampleInfo& info = bank.getInfo(entry);
+    data = bank.getData(entry);
+    index = entry;
+    length = info.length;
+    loopStart = info.loopStart;
+    loopEnd = info.loopEnd;
+    position = 0;
+    fraction = 0;
+    active = true;
+}
+
+SamplePlayerState SamplePlayer::saveState() const {
+    SamplePlayerState state = {};
+    state.index = index;
+    state.position = position;
+    state.fraction = fraction;
+    state.active = active;
+    return state;
+}
+
+void SamplePlayer::restoreState(const SampleBank& bank, const SamplePlayerState& state) {
+    start(bank, state.index);
+    if (!active) return;
+
+    // Clamped into the entry, so a snapshot from another bank cannot read past it
+    position = (state.position < length) ? state.position : 0;
+    fraction = state.fraction & 0xFFFF;
+    active = (state.active != 0);
+}
+
+// Copies 'frames' frames from 'position' on, jumping back to loopStart at
+// loopEnd; past the end of a one-shot the cache is padded with silence
+void SamplePlayer::fillCache(int frames) {
+    uint32_t pos = position;
+    int filled = 0;
+
+    while (filled < frames) {
+        uint32_t end = (loopEnd != 0) ? loopEnd : length;
+        if (pos >= end) {
+            if (loopEnd == 0) break;
+            pos = loopStart;
+        }
+
+        uint32_t chunk = end - pos;
+        if (chunk > (uint32_t)(frames - filled)) chunk = frames - filled;
+        memcpy(&cache[filled], &data[pos], chunk * sizeof(int16_t));
+        filled += chunk;
+        pos += chunk;
+    }
+
+    if (filled < frames) {
+        memset(&cache[filled], 0, (frames - filled) * sizeof(int16_t));
+    }
+}
+
+void SamplePlayer::render(int32_t* out, int numSamples, uint32_t step) {
+    if (!active) {
+        memset(out, 0, numSamples * sizeof(int32_t));
+        return;
+    }
+    if (step > SAMPLE_MAX_STEP) step = SAMPLE_MAX_STEP;
+
+    // Last frame this block reads is (fraction + step * (n - 1)) >> 16, plus its neighbour
+    uint32_t end = fraction + step * (uint32_t)(numSamples - 1);
+    fillCache((int)(end >> 16) + 2);
+
+    uint32_t local = fraction;
+    for (int i = 0; i < numSamples; i++) {
+        uint32_t index = local >> 16;
+        int32_t frac = (int32_t)((local & 0xFFFF) >> 1);
+        int32_t a = cache[index];
+        int32_t b = cache[index + 1];
+        out[i] = a + (((b - a) * frac) >> 15);
+        local += step;
+    }
+
+    // Advance the real position by the frames consumed, wrapping into the loop
+    fraction = local & 0xFFFF;
+    position += local >> 16;
+    if (loopEnd != 0) {
+        if (position >= loopEnd) {
+            position = loopStart + (position - loopStart) % (loopEnd - loopStart);
+        }
+    } else if (position >= length) {
+        active = false;
+    }
+}
@@ -0,0 +1,108 @@
+// samplebank.h
+
+#ifndef SAMPLE_BANK_H
+#define SAMPLE_BANK_H
+
+// Plain C++ (no Arduino dependencies). On the synth the bank is the "samples"
+// flash partition mapped into the address space; on a host, mmap() an image
+// written by tools/build_samples.py and pass it to attach() the same way.
+#include <stdint.h>
+#include <stddef.h>
+
+// --- Sample Bank Image Layout (little-endian) ---
+//   SampleBankHeader
+//   SampleInfo x count
+//   16-bit signed mono PCM, each sample 4-byte aligned at its 'offset'
+#define SAMPLE_BANK_MAGIC 0x4C504D53   // "SMPL"
+#define SAMPLE_BANK_VERSION 1
+#define SAMPLE_BANK_MAX_SAMPLES 32
+#define SAMPLE_NAME_LENGTH 16
+
+struct SampleBankHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+};
+
+struct SampleInfo {
+    char name[SAMPLE_NAME_LENGTH]; // NUL-terminated
+    uint32_t offset;               // bytes from the start of the image
+    uint32_t length;               // frames
+    uint32_t loopStart;            // frames; loopEnd == 0 plays the sample once
+    uint32_t loopEnd;
+    uint32_t sampleRate;
+    uint8_t rootNote;              // MIDI note the recording sounds at
+    uint8_t reserved[3];
+};
+
+// --- Playback Limits ---
+#define SAMPLE_BLOCK_MAX 64            // frames rendered per call (DMA block)
+#define SAMPLE_MAX_STEP (4 << 16)      // Q16: at most 2 octaves up
+// Frames one block can touch at SAMPLE_MAX_STEP, plus the interpolation neighbour
+#define SAMPLE_CACHE_FRAMES (SAMPLE_BLOCK_MAX * (SAMPLE_MAX_STEP >> 16) + 2)
+
+class SampleBank {
+private:
+    const uint8_t* base = NULL;
+    int count = 0;
+    const SampleInfo* infos = NULL;
+    // Phase increment (32-bit) of each sample's root note at the sample's own
+    // rate. A note's oscillator increment at the output rate divided by it is
+    // the playback step, so the output rate cancels and note-on only divides
+    uint32_t rootIncrement[SAMPLE_BANK_MAX_SAMPLES];
+
+public:
+    // Validates the whole image before using any of it. Nothing is copied:
+    // 'image' must stay mapped while the bank is in use.
+    bool attach(const uint8_t* image, size_t imageSize);
+    int getCount() const { return count; }
+    const SampleInfo& getInfo(int index) const { return infos[index]; }
+    const int16_t* getData(int index) const { return (const int16_t*)(base + infos[index].offset); }
+
+    // Q16 playback step for a note whose oscillator increment is 'increment'
+    uint32_t stepFor(int index, uint32_t increment) const;
+};
+
+// Playback position of a SamplePlayer without its pointer into the mapped
+// image, so an event log snapshot of it replays on any build of the same bank
+struct SamplePlayerState {
+    int32_t index;                  // bank entry, -1 if none was started
+    uint32_t position;
+    uint32_t fraction;
+    uint8_t active;
+    uint8_t reserved[3];
+};
+
+// --- Sample Player (one per voice) ---
+// Position is an integer frame plus a 16-bit fraction. Each block first copies
+// the frames it will touch from the mapped image into a small DRAM cache (one
+// sequential read, unrolled across the loop point), then interpolates from the
+// cache, so flash-cache misses cost one burst per block rather than stalls
+// scattered through the inner loop.
+class SamplePlayer {
+private:
+    const int16_t* data = NULL;
+    int index = -1;                 // bank entry 'data' points into
+    uint32_t length = 0;
+    uint32_t loopStart = 0;
+    uint32_t loopEnd = 0;           // 0 = one-shot
+    uint32_t position = 0;          // frames
+    uint32_t fraction = 0;          // Q16
+    bool active = false;
+    int16_t cache[SAMPLE_CACHE_FRAMES];
+
+    void fillCache(int frames);
+
+public:
+    void start(const SampleBank& bank, int entry);
+    void stop() { active = false; }
+    SamplePlayerState saveState() const;
+    // An entry missing from 'bank' restores as stopped
+    void restoreState(const SampleBank& bank, const SamplePlayerState& state);
+    bool isActive() const { return active; }
+    // Writes numSamples (<= SAMPLE_BLOCK_MAX) interpolated samples to 'out';
+    // a finished one-shot writes silence
+    void render(int32_t* out, int numSamples, uint32_t step);
+};
+
+#endif
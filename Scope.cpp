@@ -0,0 +1,132 @@
+// scope.cpp
+
+#include "Scope.h"
+#include <math.h>
+#include <string.h>
+
+// -------------------------------------------------------------------
+// --- CAPTURE TAP ---
+// -------------------------------------------------------------------
+
+void ScopeTap::capture(const int16_t* dacWords, int frames) {
+    uint32_t index = writeIndex;
+    int frame = (SCOPE_DECIMATION - phase) % SCOPE_DECIMATION;
+
+    for (; frame < frames; frame += SCOPE_DECIMATION) {
+        // Offset binary -> signed: exactly the levels the DAC is driven with
+        int32_t left = (int16_t)(dacWords[frame * 2] ^ 0x8000);
+        int32_t right = (int16_t)(dacWords[frame * 2 + 1] ^ 0x8000);
+        ring[index & (SCOPE_RING_SIZE - 1)] = (int16_t)((left + right) >> 1);
+        index++;
+    }
+    phase = (phase + frames) % SCOPE_DECIMATION;
+
+    // Samples must be visible before the index that covers them
+    __sync_synchronize();
+    writeIndex = index;
+}
+
+void ScopeTap::setEnabled(bool on) {
+    // The producer is idle while disabled, so the index is stable here
+    if (on && !enabled) enabledIndex = writeIndex;
+    enabled = on;
+}
+
+bool ScopeTap::read(int16_t* out, int count) {
+    for (int attempt = 0; attempt < 3; attempt++) {
+        uint32_t end = writeIndex;
+        if (end - enabledIndex < (uint32_t)count) return false;
+        __sync_synchronize();
+
+        uint32_t start = end - count;
+        for (int i = 0; i < count; i++) {
+            out[i] = ring[(start + i) & (SCOPE_RING_SIZE - 1)];
+        }
+
+        __sync_synchronize();
+        // Still intact if the producer has not wrapped onto 'start' meanwhile,
+        // counting the block it may be writing ahead of the published index
+        if (writeIndex - start <= SCOPE_RING_SIZE - SCOPE_WRITE_MARGIN) return true;
+    }
+    return false;
+}
+
+uint32_t ScopeTap::takeMaxCaptureCycles() {
+    uint32_t worst = maxCaptureCycles;
+    maxCaptureCycles = 0;
+    return worst;
+}
+
+
+// -------------------------------------------------------------------
+// --- SPECTRUM (UI CORE) ---
+// -------------------------------------------------------------------
+
+static float fftRe[SCOPE_FFT_SIZE];
+static float fftIm[SCOPE_FFT_SIZE];
+static float window[SCOPE_FFT_SIZE];
+static float twiddleCos[SCOPE_FFT_SIZE / 2];
+static float twiddleSin[SCOPE_FFT_SIZE / 2];
+static bool tablesReady = false;
+
+static void buildTables() {
+    for (int i = 0; i < SCOPE_FFT_SIZE; i++) {
+        window[i] = 0.5f - 0.5f * cosf(2.0f * (float)M_PI * i / (SCOPE_FFT_SIZE - 1));
+    }
+    for (int i = 0; i < SCOPE_FFT_SIZE / 2; i++) {
+        twiddleCos[i] = cosf(2.0f * (float)M_PI * i / SCOPE_FFT_SIZE);
+        twiddleSin[i] = -sinf(2.0f * (float)M_PI * i / SCOPE_FFT_SIZE);
+    }
+    tablesReady = true;
+}
+
+// In-place iterative radix-2 FFT
+static void fft(float* re, float* im) {
+    for (int i = 1, j = 0; i < SCOPE_FFT_SIZE; i++) {
+        int bit = SCOPE_FFT_SIZE >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) {
+            float t = re[i]; re[i] = re[j]; re[j] = t;
+            t = im[i]; im[i] = im[j]; im[j] = t;
+        }
+    }
+
+    for (int size = 2; size <= SCOPE_FFT_SIZE; size <<= 1) {
+        int half = size >> 1;
+        int stride = SCOPE_FFT_SIZE / size;
+        for (int start = 0; start < SCOPE_FFT_SIZE; start += size) {
+            for (int k = 0; k < half; k++) {
+                float wr = twiddleCos[k * stride];
+                float wi = twiddleSin[k * stride];
+                int a = start + k;
+                int b = a + half;
+                float tr = re[b] * wr - im[b] * wi;
+                float ti = re[b] * wi + im[b] * wr;
+                re[b] = re[a] - tr;
+                im[b] = im[a] - ti;
+                re[a] += tr;
+                im[a] += ti;
+            }
+        }
+    }
+}
+
+void scopeSpectrum(const int16_t* samples, uint8_t bins[SCOPE_FFT_BINS]) {
+    if (!tablesReady) buildTables();
+
+    for (int i = 0; i < SCOPE_FFT_SIZE; i++) {
+        fftRe[i] = samples[i] * window[i];
+        fftIm[i] = 0.0f;
+    }
+    fft(fftRe, fftIm);
+
+    // Full-scale sine through a Hann window peaks at 32767 * N / 4
+    const float fullScale = 32767.0f * SCOPE_FFT_SIZE / 4.0f;
+    for (int k = 0; k < SCOPE_FFT_BINS; k++) {
+        float magnitude = sqrtf(fftRe[k] * fftRe[k] + fftIm[k] * fftIm[k]) / fullScale;
+        float db = (magnitude > 0.0f) ? 20.0f * log10f(magnitude) : SCOPE_DB_FLOOR;
+        float scaled = (db - SCOPE_DB_FLOOR) * 255.0f / -SCOPE_DB_FLOOR;
+        bins[k] = (uint8_t)(scaled < 0.0f ? 0.0f : (scaled > 255.0f ? 255.0f : scaled));
+    }
+}
@@ -0,0 +1,63 @@
+// scope.h
+
+#ifndef SCOPE_H
+#define SCOPE_H
+
+// Plain C++ (no Arduino dependencies): the tap and the FFT can be exercised
+// on a host with synthetic DAC blocks.
+#include <stdint.h>
+#include <stddef.h>
+
+// --- Scope Configuration ---
+#define SCOPE_RING_SIZE 2048          // samples, power of two
+#define SCOPE_DECIMATION 2            // keep every 2nd frame: 22050 Hz, 0-11 kHz view
+#define SCOPE_FFT_SIZE 512            // power of two, <= SCOPE_RING_SIZE
+#define SCOPE_FFT_BINS (SCOPE_FFT_SIZE / 2)
+#define SCOPE_DB_FLOOR -96.0f         // 0 in a spectrum byte; 255 = 0 dBFS
+#define SCOPE_IDLE_TIMEOUT_MS 2000    // capture switches off when nobody is looking
+#define SCOPE_WRITE_MARGIN 32         // decimated samples in one 64-frame block
+
+// Capture budget (ESP32 @ 240 MHz): 32 decimated samples per 64-frame block at
+// ~6 cycles each plus the publish, comfortably under SCOPE_CYCLE_BUDGET per block
+// (0.15% of the ~348k cycles a block takes to play). Measured and reported.
+#define SCOPE_CYCLE_BUDGET 500
+
+// --- Lock-Free Capture Tap ---
+// Single producer (audio core) / single consumer (UI core). The producer never
+// waits: it overwrites the oldest samples and then publishes a monotonically
+// increasing write index. The consumer copies a window and re-reads the index;
+// if the producer lapped the window during the copy, the read is retried. A
+// block is written into the ring before its index is published, so a window
+// is only intact while it stays a block's worth of samples clear of the index.
+class ScopeTap {
+private:
+    int16_t ring[SCOPE_RING_SIZE];
+    volatile uint32_t writeIndex = 0;
+    volatile bool enabled = false;
+    uint32_t phase = 0;               // decimation phase carried across blocks
+    uint32_t enabledIndex = 0;        // UI core: write index when capture last started
+
+public:
+    volatile uint32_t maxCaptureCycles = 0;
+
+    // Audio core: 'dacWords' is the interleaved L/R block handed to i2s_write
+    // (8-bit DAC samples in the high byte, offset binary)
+    void capture(const int16_t* dacWords, int frames);
+    bool isEnabled() const { return enabled; }
+
+    // UI core
+    // Enabling restarts the window: samples left from an earlier capture are
+    // never returned
+    void setEnabled(bool on);
+    // Copies the newest 'count' samples (oldest first); false if not enough
+    // have been captured since enabling or the producer kept lapping the reader
+    bool read(int16_t* out, int count);
+    uint32_t takeMaxCaptureCycles();
+};
+
+// Hann-windowed magnitude spectrum of SCOPE_FFT_SIZE samples, one byte per bin
+// (SCOPE_DB_FLOOR..0 dBFS mapped to 0..255). Runs on the UI core; uses static
+// scratch, so it is not reentrant.
+void scopeSpectrum(const int16_t* samples, uint8_t bins[SCOPE_FFT_BINS]);
+
+#endif
@@ -0,0 +1,186 @@
+// sequencer.cpp
+
+#include "Sequencer.h"
+#include <math.h>
+#include <string.h>
+
+Sequencer::Sequencer() {
+    for (int i = 0; i < SEQ_NUM_STEPS; i++) {
+        // Default pattern: a C major arpeggio on the beats, rests between
+        static const uint8_t PATTERN[4] = { 60, 64, 67, 72 };
+        steps[i].note = PATTERN[(i / 2) % 4];
+        steps[i].velocity = (i % 2 == 0) ? 100 : 0;
+    }
+}
+
+uint32_t Sequencer::nextRandom() {
+    // xorshift32: deterministic for a given seed
+    uint32_t x = randomState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    randomState = x;
+    return x;
+}
+
+void Sequencer::setTempo(float bpm, uint32_t sampleRate) {
+    tempo = bpm;
+    // samples per step = sampleRate * 60 / (bpm * steps per beat), in Q32,
+    // rounded to the nearest fraction so thousands of steps add up exactly
+    stepLengthQ32 = llround((double)sampleRate * 60.0 * 4294967296.0 / (bpm * SEQ_STEPS_PER_BEAT));
+}
+
+int Sequencer::setMode(SequencerMode newMode, uint32_t now, SequencerEvent* out) {
+    int count = 0;
+    if (newMode == mode) return 0;
+
+    count = releaseSounding(out, count);
+    gatePending = false;
+    mode = newMode;
+    stepIndex = 0;
+    descending = false;
+    // Keys held in the old mode were released along with its voices
+    heldCount = 0;
+    // First step plays at 'now'
+    nextStepQ32 = (uint64_t)now << 32;
+    return count;
+}
+
+void Sequencer::holdNote(uint8_t note, uint8_t velocity) {
+    if (heldCount == ARP_MAX_NOTES) return;
+
+    int i = heldCount;
+    for (int k = 0; k < heldCount; k++) {
+        if (heldNotes[k] == note) return;
+    }
+    // Insertion keeps the list sorted for up/down
+    while (i > 0 && heldNotes[i - 1] > note) {
+        heldNotes[i] = heldNotes[i - 1];
+        heldVelocity[i] = heldVelocity[i - 1];
+        i--;
+    }
+    heldNotes[i] = note;
+    heldVelocity[i] = velocity;
+    heldCount++;
+}
+
+void Sequencer::releaseNote(uint8_t note) {
+    for (int i = 0; i < heldCount; i++) {
+        if (heldNotes[i] != note) continue;
+
+        for (int k = i; k < heldCount - 1; k++) {
+            heldNotes[k] = heldNotes[k + 1];
+            heldVelocity[k] = heldVelocity[k + 1];
+        }
+        heldCount--;
+        return;
+    }
+}
+
+uint32_t Sequencer::nextEventSample() const {
+    uint32_t step = (uint32_t)((nextStepQ32 + 0x80000000) >> 32);
+    if (gatePending && (int32_t)(gateOffSample - step) < 0) return gateOffSample;
+    return step;
+}
+
+int Sequencer::releaseSounding(SequencerEvent* out, int count) {
+    for (int i = 0; i < soundingCount; i++) {
+        out[count].noteOn = false;
+        out[count].note = soundingNotes[i];
+        out[count].velocity = 0;
+        count++;
+    }
+    soundingCount = 0;
+    return count;
+}
+
+int Sequencer::startStep(SequencerEvent* out, int count) {
+    if (mode == SEQ_STEP) {
+        const SequencerStep& step = steps[stepIndex];
+        stepIndex = (stepIndex + 1) % (length > 0 ? length : 1);
+
+        if (step.velocity > 0) {
+            out[count++] = { true, step.note, step.velocity };
+            soundingNotes[soundingCount++] = step.note;
+        }
+        return count;
+    }
+
+    if (heldCount == 0) return count;
+
+    if (arpMode == ARP_CHORD) {
+        for (int i = 0; i < heldCount; i++) {
+            out[count++] = { true, heldNotes[i], heldVelocity[i] };
+            soundingNotes[soundingCount++] = heldNotes[i];
+        }
+        return count;
+    }
+
+    // Wraps on the held count, not a fixed period, so the pattern never skips
+    // or repeats a note when the step counter wraps
+    int position = stepIndex % heldCount;
+    int index;
+    switch (arpMode) {
+        case ARP_DOWN: index = heldCount - 1 - position; break;
+        case ARP_RANDOM: index = nextRandom() % heldCount; break;
+        case ARP_UP:
+        default: index = position; break;
+    }
+    stepIndex = (position + 1) % heldCount;
+
+    out[count++] = { true, heldNotes[index], heldVelocity[index] };
+    soundingNotes[soundingCount++] = heldNotes[index];
+    return count;
+}
+
+int Sequencer::process(uint32_t now, SequencerEvent* out) {
+    int count = 0;
+    if (mode == SEQ_OFF || stepLengthQ32 == 0) return 0;
+
+    if (gatePending && (int32_t)(now - gateOffSample) >= 0) {
+        count = releaseSounding(out, count);
+        gatePending = false;
+    }
+
+    uint32_t stepSample = (uint32_t)((nextStepQ32 + 0x80000000) >> 32);
+    if ((int32_t)(now - stepSample) >= 0) {
+        // A legato (100%) gate ends exactly where the next step starts
+        count = releaseSounding(out, count);
+        count = startStep(out, count);
+
+        gateOffSample = stepSample + (uint32_t)(((stepLengthQ32 >> 32) * gatePercent) / 100);
+        gatePending = (soundingCount > 0);
+        nextStepQ32 += stepLengthQ32;
+    }
+    return count;
+}
+
+SequencerState Sequencer::saveState() const {
+    SequencerState state = {};
+    state.nextStepQ32 = nextStepQ32;
+    state.gateOffSample = gateOffSample;
+    state.randomState = randomState;
+    state.stepIndex = stepIndex;
+    state.heldCount = heldCount;
+    state.soundingCount = soundingCount;
+    state.gatePending = gatePending;
+    memcpy(state.heldNotes, heldNotes, sizeof(heldNotes));
+    memcpy(state.heldVelocity, heldVelocity, sizeof(heldVelocity));
+    memcpy(state.soundingNotes, soundingNotes, sizeof(soundingNotes));
+    return state;
+}
+
+void Sequencer::restoreState(const SequencerState& state) {
+    nextStepQ32 = state.nextStepQ32;
+    gateOffSample = state.gateOffSample;
+    seed(state.randomState);
+    stepIndex = (state.stepIndex >= 0 && state.stepIndex < SEQ_NUM_STEPS) ? state.stepIndex : 0;
+    heldCount = (state.heldCount >= 0 && state.heldCount <= ARP_MAX_NOTES) ? state.heldCount : 0;
+    soundingCount = (state.soundingCount >= 0 && state.soundingCount <= ARP_MAX_NOTES) ? state.soundingCount : 0;
+    gatePending = (state.gatePending != 0);
+    for (int i = 0; i < ARP_MAX_NOTES; i++) {
+        heldNotes[i] = state.heldNotes[i] & 0x7F;
+        heldVelocity[i] = state.heldVelocity[i] & 0x7F;
+        soundingNotes[i] = state.soundingNotes[i] & 0x7F;
+    }
+}
@@ -0,0 +1,108 @@
+// sequencer.h
+
+#ifndef SEQUENCER_H
+#define SEQUENCER_H
+
+// Plain C++ (no Arduino dependencies): the audio core feeds it the sample
+// clock, so step timing can be checked on a host sample by sample.
+#include <stdint.h>
+
+// --- Sequencer Constants ---
+#define SEQ_NUM_STEPS 16
+#define SEQ_STEPS_PER_BEAT 4        // 16th notes
+#define ARP_MAX_NOTES 16
+#define SEQ_MAX_EVENTS (2 * ARP_MAX_NOTES) // worst case at one sample: chord off + chord on
+
+enum SequencerMode { SEQ_OFF, SEQ_ARP, SEQ_STEP };
+enum ArpMode { ARP_UP, ARP_DOWN, ARP_RANDOM, ARP_CHORD };
+
+struct SequencerStep {
+    uint8_t note;
+    uint8_t velocity;  // 0 = rest
+};
+
+struct SequencerEvent {
+    bool noteOn;
+    uint8_t note;
+    uint8_t velocity;
+};
+
+// Clock and note state carried between blocks (event log snapshots); the
+// mode, tempo and pattern are parameters
+struct SequencerState {
+    uint64_t nextStepQ32;
+    uint32_t gateOffSample;
+    uint32_t randomState;
+    int32_t stepIndex;
+    int32_t heldCount;
+    int32_t soundingCount;
+    uint8_t gatePending;
+    uint8_t heldNotes[ARP_MAX_NOTES];
+    uint8_t heldVelocity[ARP_MAX_NOTES];
+    uint8_t soundingNotes[ARP_MAX_NOTES];
+    uint8_t reserved[3];
+};
+
+// --- Arpeggiator & 16-Step Sequencer ---
+// All state is preallocated. Step times are kept in Q32 samples and only
+// rounded when compared, so a tempo that is not a whole number of samples per
+// step never accumulates drift: the step length is off by at most 2^-33 of a
+// sample, and every step lands on the same rounded sample an ideal clock
+// would give it.
+class Sequencer {
+private:
+    SequencerMode mode = SEQ_OFF;
+    uint64_t stepLengthQ32 = 0;
+    uint64_t nextStepQ32 = 0;       // absolute sample position of the next step
+    uint32_t gateOffSample = 0;
+    bool gatePending = false;
+    int stepIndex = 0;              // next sequencer step / arp position
+    bool descending = false;
+    uint32_t randomState = 0x12345678;
+
+    // Keys held for the arpeggiator, sorted ascending
+    uint8_t heldNotes[ARP_MAX_NOTES];
+    uint8_t heldVelocity[ARP_MAX_NOTES];
+    int heldCount = 0;
+
+    // Notes this sequencer has started and not yet released
+    uint8_t soundingNotes[ARP_MAX_NOTES];
+    int soundingCount = 0;
+
+    uint32_t nextRandom();
+    int releaseSounding(SequencerEvent* out, int count);
+    int startStep(SequencerEvent* out, int count);
+
+public:
+    // Settings (audio core only; changed through the parameter batch)
+    ArpMode arpMode = ARP_UP;
+    float tempo = 120.0f;           // BPM
+    uint8_t gatePercent = 50;       // note length as % of a step
+    uint8_t length = SEQ_NUM_STEPS; // active sequencer steps
+    SequencerStep steps[SEQ_NUM_STEPS];
+
+    Sequencer();
+    void setTempo(float bpm, uint32_t sampleRate);
+    // Starts (or stops) clocking from 'now'; switching off returns the note-offs
+    int setMode(SequencerMode newMode, uint32_t now, SequencerEvent* out);
+    SequencerMode getMode() const { return mode; }
+    void seed(uint32_t value) { randomState = value ? value : 1; }
+
+    // Arpeggiator input
+    void holdNote(uint8_t note, uint8_t velocity);
+    void releaseNote(uint8_t note);
+    // Forgets held and sounding notes without emitting note-offs (their voices are gone)
+    void clearNotes() { heldCount = 0; soundingCount = 0; gatePending = false; }
+
+    bool isRunning() const { return mode != SEQ_OFF; }
+    // Sample time of the next step or gate-off
+    uint32_t nextEventSample() const;
+    // Emits every event due at or before 'now' into 'out' (SEQ_MAX_EVENTS)
+    int process(uint32_t now, SequencerEvent* out);
+
+    SequencerState saveState() const;
+    // Takes the mode and settings as they are; counts and notes are clamped
+    void restoreState(const SequencerState& state);
+};
+
+#endif
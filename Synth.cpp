@@ -1,6 +1,9 @@
 // synth.cpp
 
-#include "synth.h" 
+#include "Synth.h" 
+#include "Preset.h"
+#include "EventLog.h"
+#include "esp_partition.h"
 
 // -------------------------------------------------------------------
 // --- GLOBAL DEFINITIONS ---
@@ -21,18 +24,26 @@ const i2s_config_t i2s_config = {
 
 // Note & Wave Names
 const char* NOTE_NAMES[] = {"C", "C#", "D", "D#", "E", "F", "F#", "G", "G#", "A", "A#", "B"};
-const char* WAVE_NAMES[] = {"Sine", "Square", "Sawtooth", "Triangle"};
+const char* WAVE_NAMES[] = {"Sine", "Square", "Sawtooth", "Triangle", "Sample"};
 
 // Scale Step Intervals
 const int SCALE_MAJOR[] = {2, 2, 1, 2, 2, 2, 1}; 
 const int SCALE_MINOR[] = {2, 1, 2, 2, 1, 2, 2}; 
 const int SCALE_PENT_MAJOR[] = {2, 2, 3, 2, 3}; 
 const int SCALE_PENT_MINOR[] = {3, 2, 2, 3, 2}; 
+const int SCALE_CHROMATIC[] = {1};
 
 // Global Synth Objects
-int16_t SINE_TABLE[SINE_TABLE_SIZE]; 
 Synth synth; 
 
+static_assert(TABLE_SAMPLE_RATE == I2S_SAMPLE_RATE, "Regenerate Tables.cpp for the new sample rate");
+static_assert(TABLE_MIDI_NOTES == NUM_MIDI_NOTES, "Tables.h and Synth.h disagree on the note count");
+
+// Guards the note event ring (producers on core 0, consumer on core 1)
+static portMUX_TYPE eventQueueMux = portMUX_INITIALIZER_UNLOCKED;
+// Guards the staged parameter batch
+static portMUX_TYPE paramMux = portMUX_INITIALIZER_UNLOCKED;
+
 
 // -------------------------------------------------------------------
 // --- HELPER FUNCTION: MIDI TO FREQUENCY ---
@@ -41,6 +52,12 @@ double midiToFrequency(int midiNote) {
     return 440.0 * pow(2.0, (midiNote - 69.0) / 12.0);
 }
 
+// Phase offset = mod(Q15) * fmDepth << 4 spans fmIndex radians:
+// fmIndex / (2*PI) * 2^32 / 2^15 / 2^4 = fmIndex * 2^13 / (2*PI)
+int32_t fmDepthForIndex(double index) {
+    return (int32_t)(index * 8192.0 / (2.0 * PI));
+}
+
 
 // -------------------------------------------------------------------
 // --- OSCILLATOR CLASS IMPLEMENTATION ---
@@ -63,6 +80,21 @@ void Oscillator::setFrequency(double freq) {
     phaseIncrement = frequency * SINE_TABLE_SIZE / I2S_SAMPLE_RATE;
 }
 
+OscillatorState Oscillator::saveState() const {
+    OscillatorState state = {};
+    state.phase = phaseAccumulator;
+    state.frequency = frequency;
+    state.wave = wave;
+    return state;
+}
+
+void Oscillator::restoreState(const OscillatorState& state) {
+    // The phase indexes the wave tables: anything outside one cycle restarts it
+    phaseAccumulator = (state.phase >= 0.0 && state.phase < SINE_TABLE_SIZE) ? state.phase : 0.0;
+    wave = (state.wave >= SINE && state.wave <= TRIANGLE) ? (WaveType)state.wave : SINE;
+    setFrequency(state.frequency);
+}
+
 int16_t Oscillator::getNextSample() {
     if (frequency <= 0.0) return 0; 
 
@@ -86,23 +118,168 @@ int16_t Oscillator::getNextSample() {
 }
 
 
+// -------------------------------------------------------------------
+// --- UNISON OSCILLATOR IMPLEMENTATION ---
+// -------------------------------------------------------------------
+
+// Integer waveform shapes over a full 32-bit phase (matches the double versions above)
+static inline int32_t unisonSine(uint32_t p) { return SINE_TABLE[p >> PHASE_INDEX_SHIFT]; }
+// Linear interpolation between neighbouring table entries, 15-bit fraction
+static inline int32_t unisonSineInterp(uint32_t p) {
+    uint32_t index = p >> PHASE_INDEX_SHIFT;
+    int32_t frac = (int32_t)((p >> (PHASE_INDEX_SHIFT - 15)) & 0x7FFF);
+    int32_t a = SINE_TABLE[index];
+    int32_t b = SINE_TABLE[(index + 1) & (SINE_TABLE_SIZE - 1)];
+    return a + (((b - a) * frac) >> 15);
+}
+static inline int32_t unisonSquare(uint32_t p) { return (p & 0x80000000u) ? -32767 : 32767; }
+static inline int32_t unisonSaw(uint32_t p) { return (int32_t)(p >> 16) - 32768; }
+static inline int32_t unisonTriangle(uint32_t p) {
+    int32_t u = (int32_t)(p >> 16);
+    return (p & 0x80000000u) ? (98303 - 2 * u) : (2 * u - 32768);
+}
+
+// One pass per oscillator over the block; the inner loop has no branches on the
+// waveform so the compiler can unroll/vectorize it. Modulated kernels add a
+// per-sample phase offset (FM mode) shared by every unison copy. The increment
+// ramps linearly from pitchStart to pitchEnd (Q16) for smooth pitch modulation.
+template <int32_t (*Shape)(uint32_t), bool Modulated>
+static void renderUnisonKernel(uint32_t* phase, const uint32_t* inc,
+                               const int32_t* gainL, const int32_t* gainR, int count,
+                               int32_t* outL, int32_t* outR, int numSamples,
+                               const int32_t* phaseMod, uint32_t pitchStart, uint32_t pitchEnd) {
+    for (int k = 0; k < count; k++) {
+        uint32_t p = phase[k];
+        uint32_t step = (uint32_t)(((uint64_t)inc[k] * pitchStart) >> 16);
+        const uint32_t stepEnd = (uint32_t)(((uint64_t)inc[k] * pitchEnd) >> 16);
+        const int32_t stepDelta = (int32_t)(((int64_t)stepEnd - (int64_t)step) / numSamples);
+        const int32_t gl = gainL[k];
+        const int32_t gr = gainR[k];
+
+        for (int i = 0; i < numSamples; i++) {
+            int32_t s = Modulated ? Shape(p + (uint32_t)phaseMod[i]) : Shape(p);
+            p += step;
+            step += stepDelta;
+            outL[i] += (s * gl) >> 15;
+            outR[i] += (s * gr) >> 15;
+        }
+        phase[k] = p;
+    }
+}
+
+UnisonOscillator::UnisonOscillator() {
+    for (int k = 0; k < MAX_UNISON; k++) {
+        // Spread the free-running start phases so stacked copies don't phase-lock
+        phase[k] = (uint32_t)k * 0x9E3779B9u;
+        phaseIncrement[k] = 0;
+        gainL[k] = 32767;
+        gainR[k] = 32767;
+    }
+}
+
+UnisonCoefficients UnisonOscillator::computeCoefficients(int voices, double detuneCents, double stereoSpread) {
+    UnisonCoefficients c = {};   // unused copies zeroed: presets store the whole struct
+    c.count = constrain(voices, 1, MAX_UNISON);
+    stereoSpread = constrain(stereoSpread, 0.0, 1.0);
+    
+    // 1/sqrt(N) keeps the perceived level roughly constant as copies are added
+    double level = 1.0 / sqrt((double)c.count);
+
+    for (int k = 0; k < c.count; k++) {
+        // Position of this copy across the stack: -1.0 (first) to +1.0 (last)
+        double position = (c.count > 1) ? (2.0 * k / (c.count - 1) - 1.0) : 0.0;
+        
+        double cents = position * detuneCents / 2.0;
+        c.ratio[k] = (uint32_t)(pow(2.0, cents / 1200.0) * PITCH_RATIO_UNITY + 0.5);
+
+        // Balance pan law: unity at centre, the far side fades out
+        double pan = position * stereoSpread;
+        c.gainL[k] = (int32_t)(min(1.0, 1.0 - pan) * level * 32767.0);
+        c.gainR[k] = (int32_t)(min(1.0, 1.0 + pan) * level * 32767.0);
+    }
+    return c;
+}
+
+// Note-on: one multiply per copy, the detune and pan math is precomputed
+void UnisonOscillator::setup(uint32_t baseIncrement, const UnisonCoefficients& coefficients) {
+    count = coefficients.count;
+
+    for (int k = 0; k < count; k++) {
+        phaseIncrement[k] = (uint32_t)(((uint64_t)baseIncrement * coefficients.ratio[k]) >> 16);
+        gainL[k] = coefficients.gainL[k];
+        gainR[k] = coefficients.gainR[k];
+    }
+}
+
+void UnisonOscillator::renderBlock(int32_t* outL, int32_t* outR, int numSamples, const int32_t* phaseMod,
+                                   uint32_t pitchStart, uint32_t pitchEnd) {
+    if (phaseMod != NULL) {
+        // Phase-modulated carrier: sine uses the interpolated lookup to keep sidebands clean
+        switch (wave) {
+            case SQUARE: renderUnisonKernel<unisonSquare, true>(phase, phaseIncrement, gainL, gainR, count, outL, outR, numSamples, phaseMod, pitchStart, pitchEnd); break;
+            case SAW: renderUnisonKernel<unisonSaw, true>(phase, phaseIncrement, gainL, gainR, count, outL, outR, numSamples, phaseMod, pitchStart, pitchEnd); break;
+            case TRIANGLE: renderUnisonKernel<unisonTriangle, true>(phase, phaseIncrement, gainL, gainR, count, outL, outR, numSamples, phaseMod, pitchStart, pitchEnd); break;
+            case SINE:
+            default: renderUnisonKernel<unisonSineInterp, true>(phase, phaseIncrement, gainL, gainR, count, outL, outR, numSamples, phaseMod, pitchStart, pitchEnd); break;
+        }
+        return;
+    }
+
+    switch (wave) {
+        case SQUARE: renderUnisonKernel<unisonSquare, false>(phase, phaseIncrement, gainL, gainR, count, outL, outR, numSamples, NULL, pitchStart, pitchEnd); break;
+        case SAW: renderUnisonKernel<unisonSaw, false>(phase, phaseIncrement, gainL, gainR, count, outL, outR, numSamples, NULL, pitchStart, pitchEnd); break;
+        case TRIANGLE: renderUnisonKernel<unisonTriangle, false>(phase, phaseIncrement, gainL, gainR, count, outL, outR, numSamples, NULL, pitchStart, pitchEnd); break;
+        case SINE:
+        default: renderUnisonKernel<unisonSine, false>(phase, phaseIncrement, gainL, gainR, count, outL, outR, numSamples, NULL, pitchStart, pitchEnd); break;
+    }
+}
+
+
+UnisonState UnisonOscillator::saveState() const {
+    UnisonState state = {};
+    memcpy(state.phase, phase, sizeof(phase));
+    memcpy(state.phaseIncrement, phaseIncrement, sizeof(phaseIncrement));
+    memcpy(state.gainL, gainL, sizeof(gainL));
+    memcpy(state.gainR, gainR, sizeof(gainR));
+    state.count = count;
+    state.wave = wave;
+    return state;
+}
+
+void UnisonOscillator::restoreState(const UnisonState& state) {
+    memcpy(phase, state.phase, sizeof(phase));
+    memcpy(phaseIncrement, state.phaseIncrement, sizeof(phaseIncrement));
+    memcpy(gainL, state.gainL, sizeof(gainL));
+    memcpy(gainR, state.gainR, sizeof(gainR));
+    count = constrain(state.count, 1, MAX_UNISON);
+    wave = (state.wave >= SINE && state.wave <= SAMPLE) ? (WaveType)state.wave : SINE;
+}
+
+
 // -------------------------------------------------------------------
 // --- ENVELOPE CLASS IMPLEMENTATION (FIXED RELEASE) ---
 // -------------------------------------------------------------------
 
-void Envelope::setup(double attackTime, double decayTime, double sustainLvl, double releaseTime) {
+EnvelopeCoefficients Envelope::computeCoefficients(double attackTime, double decayTime, double sustainLvl, double releaseTime) {
     attackTime = max(0.001, attackTime); 
     decayTime = max(0.001, decayTime);
     releaseTime = max(0.001, releaseTime);
     sustainLvl = constrain(sustainLvl, 0.0, 1.0);
     
-    attackRate = 1.0 / (attackTime * I2S_SAMPLE_RATE);
-    decayRate = (1.0 - sustainLvl) / (decayTime * I2S_SAMPLE_RATE);
-    releaseRateFixed = 1.0 / (releaseTime * I2S_SAMPLE_RATE); 
-    sustainLevel = sustainLvl;
-    
-    currentGain = 0.0;
-    state = IDLE;
+    EnvelopeCoefficients c;
+    c.attackRate = 1.0 / (attackTime * I2S_SAMPLE_RATE);
+    c.decayRate = (1.0 - sustainLvl) / (decayTime * I2S_SAMPLE_RATE);
+    c.releaseRate = 1.0 / (releaseTime * I2S_SAMPLE_RATE); 
+    c.sustainLevel = sustainLvl;
+    return c;
+}
+
+void Envelope::setup(const EnvelopeCoefficients& coefficients) {
+    attackRate = coefficients.attackRate;
+    decayRate = coefficients.decayRate;
+    releaseRateFixed = coefficients.releaseRate;
+    sustainLevel = coefficients.sustainLevel;
+    // Sounding notes keep their state and continue with the new rates
 }
 
 void Envelope::noteOn() {
@@ -117,6 +294,25 @@ void Envelope::noteOff() {
     }
 }
 
+void Envelope::stop() {
+    state = IDLE;
+    currentGain = 0.0;
+}
+
+EnvelopeState Envelope::saveState() const {
+    EnvelopeState saved = {};
+    saved.currentGain = currentGain;
+    saved.releaseStartGain = releaseStartGain;
+    saved.state = state;
+    return saved;
+}
+
+void Envelope::restoreState(const EnvelopeState& saved) {
+    currentGain = constrain(saved.currentGain, 0.0, 1.0);
+    releaseStartGain = constrain(saved.releaseStartGain, 0.0, 1.0);
+    state = (saved.state >= IDLE && saved.state <= RELEASE) ? (State)saved.state : IDLE;
+}
+
 double Envelope::getNextGain() {
     switch (state) {
         case IDLE:
@@ -162,12 +358,28 @@ double Envelope::getNextGain() {
 // --- VOICE CLASS IMPLEMENTATION ---
 // -------------------------------------------------------------------
 
-void Voice::noteOn(double freq, WaveType wave1, WaveType wave2) {
+// 'increment' comes straight from the tuning table: no pow() on the audio core
+void Voice::noteOn(uint32_t increment, WaveType wave1, WaveType wave2) {
+    baseFrequency = increment * (double)I2S_SAMPLE_RATE / 4294967296.0;
+
     osc1.setWaveform(wave1);
-    osc1.setFrequency(freq);
+    osc1.setup(increment, synth.unisonCoefficients);
     
     osc2.setWaveform(wave2);
-    osc2.setFrequency(freq); 
+    osc2.setFrequency(baseFrequency); 
+
+    // Up to 16x a high note's increment exceeds 32 bits: convert through 64
+    // bits and wrap, as the phase accumulator itself would
+    fmIncrement = (uint32_t)(uint64_t)(increment * synth.fmRatio);
+
+    playingSample = (wave1 == SAMPLE);
+    if (playingSample) {
+        sampler.start(synth.samples, synth.sampleIndex);
+        sampleStep = sampler.isActive() ? synth.samples.stepFor(synth.sampleIndex, increment) : 0;
+    }
+
+    // Start the next block's modulation ramp from its own target (no glide-in)
+    modPrimed = false;
     
     envelope.noteOn(); 
 }
@@ -176,28 +388,170 @@ void Voice::noteOff() {
     envelope.noteOff(); 
 }
 
-int16_t Voice::getSample() {
-    double envGain = envelope.getNextGain(); 
+void Voice::renderBlock(int32_t* mixL, int32_t* mixR, int numSamples) {
+    int32_t osc1L[DMA_BUF_LEN] = {0};
+    int32_t osc1R[DMA_BUF_LEN] = {0};
+
+    // --- Control-rate modulation: one evaluation per block ---
+    int32_t gain1 = (int32_t)(synth.osc1Gain * 32767.0);
+    int32_t gain2 = (int32_t)(synth.osc2Gain * 32767.0);
+    int32_t pan = 0;
+    uint32_t pitch = synth.pitchBendRatio;
+    const bool modulated = !synth.modMatrix.isEmpty();
+
+    if (modulated) {
+        int32_t mod[NUM_MOD_DESTS];
+        int32_t envQ15 = (int32_t)(envelope.getGain() * 32767.0);
+        int32_t keyQ15 = constrain((note - MIDI_C4) * 512, -32767, 32767);
+        synth.modMatrix.evaluate(envQ15, keyQ15, mod);
+
+        gain1 = constrain(gain1 + mod[MOD_DST_OSC1_GAIN], 0, 32767);
+        gain2 = constrain(gain2 + mod[MOD_DST_OSC2_GAIN], 0, 32767);
+        pan = mod[MOD_DST_PAN];
+        pitch = (uint32_t)(((uint64_t)pitch * pitchRatioQ16(mod[MOD_DST_PITCH])) >> 16);
+    }
+
+    if (!modPrimed || pitch != modPitch) {
+        osc2.setFrequency(baseFrequency * pitch / 65536.0);
+    }
+
+    if (!modPrimed) {
+        modGain1 = gain1;
+        modGain2 = gain2;
+        modPan = pan;
+        modPitch = pitch;
+        modPrimed = true;
+    }
+
+    // Per-sample ramps from the previous block's values to this block's targets
+    int32_t gain1Step = (gain1 - modGain1) / numSamples;
+    int32_t gain2Step = (gain2 - modGain2) / numSamples;
+    int32_t panStep = (pan - modPan) / numSamples;
+    const uint32_t pitchStart = modPitch;
 
-    if (envGain <= 0.0 && envelope.getState() == Envelope::IDLE) {
-        // Stop oscillator activity once the voice is fully silent (in IDLE state)
-        if (osc1.getFrequency() > 0.0) {
-            osc1.setFrequency(0.0);
-            osc2.setFrequency(0.0);
+    // --- Oscillators ---
+    const bool fmMode = (synth.synthMode == MODE_FM);
+
+    if (playingSample) {
+        // Samples are mono and take no FM; pitch (bend, modulation) scales the step
+        sampler.render(osc1L, numSamples, (uint32_t)(((uint64_t)sampleStep * pitch) >> 16));
+        memcpy(osc1R, osc1L, numSamples * sizeof(int32_t));
+    } else if (fmMode) {
+        // Modulator output (Q15) scaled by fmDepth gives a 32-bit phase offset
+        int32_t phaseMod[DMA_BUF_LEN];
+        const int32_t depth = synth.fmDepth;
+        const uint32_t step = (uint32_t)(((uint64_t)fmIncrement * pitch) >> 16);
+        uint32_t p = fmPhase;
+        for (int i = 0; i < numSamples; i++) {
+            phaseMod[i] = (int32_t)((uint32_t)(unisonSineInterp(p) * depth) << 4);
+            p += step;
         }
-        return 0; 
-    } 
+        fmPhase = p;
+        osc1.renderBlock(osc1L, osc1R, numSamples, phaseMod, pitchStart, pitch);
+    } else {
+        osc1.renderBlock(osc1L, osc1R, numSamples, NULL, pitchStart, pitch);
+    }
 
-    int16_t sample1 = (int16_t)(osc1.getNextSample() * synth.osc1Gain);
-    
-    int16_t sample2 = 0;
-    if (synth.osc2Enabled && synth.osc2Gain > 0.0) {
-        sample2 = (int16_t)(osc2.getNextSample() * synth.osc2Gain);
+    // In FM mode OSC2 is the modulator and is not heard directly
+    const bool useOsc2 = !fmMode && synth.osc2Enabled && (gain2 > 0 || modGain2 > 0);
+
+    int32_t g1 = modGain1;
+    int32_t g2 = modGain2;
+    int32_t p = modPan;
+
+    modGain1 = gain1;
+    modGain2 = gain2;
+    modPan = pan;
+    modPitch = pitch;
+
+    for (int i = 0; i < numSamples; i++) {
+        double envGain = envelope.getNextGain();
+
+        if (envGain <= 0.0 && envelope.getState() == Envelope::IDLE) {
+            // Stop oscillator activity once the voice is fully silent (in IDLE state)
+            if (osc2.getFrequency() > 0.0) {
+                osc2.setFrequency(0.0);
+            }
+            return;
+        }
+
+        // A full unison stack sums to ~2.8x full scale: the gain, pan and
+        // velocity products need more than 32 bits
+        int32_t sample2 = useOsc2 ? ((osc2.getNextSample() * g2) >> 15) : 0;
+        int32_t left = (int32_t)(((int64_t)osc1L[i] * g1) >> 15) + sample2;
+        int32_t right = (int32_t)(((int64_t)osc1R[i] * g1) >> 15) + sample2;
+
+        if (modulated) {
+            // Balance pan law, same as the unison spread
+            left = (int32_t)(((int64_t)left * min(32767, 32767 - p)) >> 15);
+            right = (int32_t)(((int64_t)right * min(32767, 32767 + p)) >> 15);
+            p += panStep;
+        }
+        g1 += gain1Step;
+        g2 += gain2Step;
+
+        left = (int32_t)(((int64_t)left * velocityGain) >> 15);
+        right = (int32_t)(((int64_t)right * velocityGain) >> 15);
+
+        mixL[i] += (int32_t)(left * envGain / 2.0);
+        mixR[i] += (int32_t)(right * envGain / 2.0);
     }
-    
-    int16_t finalSample = (int16_t)(((double)sample1 + (double)sample2) * envGain / 2.0);
-    
-    return finalSample;
+
+    // A finished one-shot with nothing else audible frees the voice at once,
+    // rather than holding it in sustain until its key is released
+    if (playingSample && !sampler.isActive() && !useOsc2) {
+        envelope.stop();
+    }
+}
+
+
+VoiceState Voice::saveState() const {
+    VoiceState state = {};
+    state.osc1 = osc1.saveState();
+    state.osc2 = osc2.saveState();
+    state.envelope = envelope.saveState();
+    state.sampler = sampler.saveState();
+    state.baseFrequency = baseFrequency;
+    state.keyIndex = keyIndex;
+    state.note = note;
+    state.velocityGain = velocityGain;
+    state.age = age;
+    state.modGain1 = modGain1;
+    state.modGain2 = modGain2;
+    state.modPan = modPan;
+    state.modPitch = modPitch;
+    state.fmPhase = fmPhase;
+    state.fmIncrement = fmIncrement;
+    state.sampleStep = sampleStep;
+    state.sustained = sustained;
+    state.sequenced = sequenced;
+    state.modPrimed = modPrimed;
+    state.playingSample = playingSample;
+    return state;
+}
+
+// Envelope rates are not restored here: every voice shares synth.envelopeCoefficients
+void Voice::restoreState(const VoiceState& state) {
+    osc1.restoreState(state.osc1);
+    osc2.restoreState(state.osc2);
+    envelope.restoreState(state.envelope);
+    sampler.restoreState(synth.samples, state.sampler);
+    baseFrequency = state.baseFrequency;
+    keyIndex = constrain(state.keyIndex, -1, TOTAL_KEYS - 1);
+    note = constrain(state.note, 0, NUM_MIDI_NOTES - 1);
+    velocityGain = constrain(state.velocityGain, 0, 32767);
+    age = state.age;
+    modGain1 = constrain(state.modGain1, 0, 32767);
+    modGain2 = constrain(state.modGain2, 0, 32767);
+    modPan = constrain(state.modPan, -32767, 32767);
+    modPitch = state.modPitch;
+    fmPhase = state.fmPhase;
+    fmIncrement = state.fmIncrement;
+    sampleStep = min(state.sampleStep, (uint32_t)SAMPLE_MAX_STEP);
+    sustained = (state.sustained != 0);
+    sequenced = (state.sequenced != 0);
+    modPrimed = (state.modPrimed != 0);
+    playingSample = (state.playingSample != 0);
 }
 
 
@@ -211,19 +565,53 @@ void Synth::setADSR(double a, double d, double s, double r) {
     sustainLevel = s;
     releaseTime = r;
     
-    // Update the envelope setup for ALL voices
-    for (int i = 0; i < TOTAL_KEYS; i++) {
-        voices[i].envelope.setup(attackTime, decayTime, sustainLevel, releaseTime);
-    }
+    updateEnvelopes();
     Serial.printf("Synth: ADSR set to A:%.3fs, D:%.3fs, S:%.3f, R:%.3fs\n", a, d, s, r);
 }
 
 
+void Synth::updateEnvelopes() {
+    // Computed once, then copied into ALL voices
+    envelopeCoefficients = Envelope::computeCoefficients(attackTime, decayTime, sustainLevel, releaseTime);
+    for (int i = 0; i < NUM_VOICES; i++) {
+        voices[i].envelope.setup(envelopeCoefficients);
+    }
+}
+
+void Synth::updateUnison() {
+    // Picked up by the next note-on
+    unisonCoefficients = UnisonOscillator::computeCoefficients(unisonVoices, unisonDetune, stereoSpread);
+}
+
+void Synth::setUnison(int voices, double detuneCents, double spread) {
+    unisonVoices = constrain(voices, 1, MAX_UNISON);
+    unisonDetune = constrain(detuneCents, 0.0, 100.0);
+    stereoSpread = constrain(spread, 0.0, 1.0);
+    updateUnison();
+    Serial.printf("Synth: Unison set to %d voices, %.1f cents, spread %.2f\n", unisonVoices, unisonDetune, stereoSpread);
+}
+
+
+void Synth::setFM(SynthMode mode, double ratio, double index) {
+    synthMode = mode;
+    fmRatio = constrain(ratio, 0.25, 16.0);
+    fmIndex = constrain(index, 0.0, 10.0);
+    fmDepth = fmDepthForIndex(fmIndex);
+    Serial.printf("Synth: Mode %s, FM ratio %.2f, index %.2f\n", mode == MODE_FM ? "FM" : "Mix", fmRatio, fmIndex);
+}
+
+
 void Synth::begin() {
-    for (int i = 0; i < SINE_TABLE_SIZE; i++) {
-        SINE_TABLE[i] = (int16_t)(sin(i * 2.0 * PI / SINE_TABLE_SIZE) * 32767);
+    // Same word the render path produces for a zero sample (8-bit DAC code 128)
+    for (int i = 0; i < AUDIO_BUFFER_SIZE; i++) {
+        silenceBuffer[i] = (int16_t)0x8000;
     }
+
+    // 12-TET until a Scala tuning is loaded (precomputed, see Tables.h)
+    memcpy(noteIncrement[activeTuning], NOTE_INCREMENT_12TET, sizeof(NOTE_INCREMENT_12TET));
     
+    loadSamples();
+
     i2s_driver_install(I2S_PORT, &i2s_config, 0, NULL);
     i2s_set_pin(I2S_PORT, NULL);
     dac_output_enable(DAC_CHANNEL_1); 
@@ -232,6 +620,10 @@ void Synth::begin() {
     setScale(MIDI_C4, 0); 
     
     setADSR(attackTime, decayTime, sustainLevel, releaseTime);
+    setFM(synthMode, fmRatio, fmIndex);
+    setUnison(unisonVoices, unisonDetune, stereoSpread);
+    modMatrix.begin();
+    sequencer.setTempo(sequencer.tempo, I2S_SAMPLE_RATE);
 
     Serial.println("Synth Engine: I2S, Controllable ADSR, & 16 Polyphonic Voices ready.");
 }
@@ -245,18 +637,16 @@ void Synth::calculateScale(int rootMIDI, int type) {
         case 1: scaleIntervals = SCALE_MINOR; numSteps = 7; break;
         case 2: scaleIntervals = SCALE_PENT_MAJOR; numSteps = 5; break;
         case 3: scaleIntervals = SCALE_PENT_MINOR; numSteps = 5; break;
+        case 5: scaleIntervals = SCALE_CHROMATIC; numSteps = 1; break;
         case 4: 
         default: return; 
     }
     
+    // Running sum: each key is one interval above the previous one
+    int midiNote = rootMIDI;
     for (int i = 0; i < TOTAL_KEYS; i++) {
-        int midiNote = rootMIDI;
-        
-        for (int j = 0; j < i; j++) {
-            midiNote += scaleIntervals[j % numSteps];
-        }
-        
         currentScale[i] = midiNote;
+        midiNote += scaleIntervals[i % numSteps];
     }
 }
 
@@ -271,80 +661,961 @@ void Synth::setScale(int rootMIDI, int type) {
     Serial.printf("Synth: Scale set to Type %d (Root MIDI %d). Mapped %d keys.\n", type, rootMIDI, TOTAL_KEYS);
 }
 
-void Synth::setCustomNote(int keyIndex, int midiNote) {
-    if (keyIndex >= 0 && keyIndex < TOTAL_KEYS) {
-        currentScale[keyIndex] = midiNote;
-        scaleType = 4;
-        Serial.printf("Synth: Custom Key K%d mapped to MIDI %d.\n", keyIndex + 1, midiNote);
+bool Synth::setTuning(const double frequencies[NUM_MIDI_NOTES]) {
+    // The inactive table is still the one in use until the last flip is taken
+    if (tuningPending) return false;
+
+    int inactive = 1 - activeTuning;
+    int mapped = 0;
+
+    for (int n = 0; n < NUM_MIDI_NOTES; n++) {
+        // At or above Nyquist a note would only alias; treat it as unmapped
+        double freq = frequencies[n];
+        bool playable = freq > 0.0 && freq < I2S_SAMPLE_RATE / 2.0;
+        noteIncrement[inactive][n] = playable ? (uint32_t)(freq * 4294967296.0 / I2S_SAMPLE_RATE) : 0;
+        if (playable) mapped++;
     }
+
+    // Publish: the audio core switches tables at its next block and acks
+    activeTuning = inactive;
+    tuningPending = true;
+    wakeAudio();
+    Serial.printf("Synth: Tuning updated, %d of %d notes mapped.\n", mapped, NUM_MIDI_NOTES);
+    return true;
 }
 
 void Synth::setKeyBitmap(uint16_t bitmap) {
-    currentKeyBitmap = bitmap;
+    uint16_t changed = bitmap ^ currentKeyBitmap;
+    if (changed == 0) return;
+
+    uint32_t now = micros();
     
     for (int i = 0; i < TOTAL_KEYS; i++) {
-        bool isPressed = (bitmap & (1 << i));
-        
-        if (isPressed) {
-            // Key is pressed: Trigger noteOn only if voice is silent or has already released
-            if (voices[i].envelope.getState() == Envelope::IDLE || voices[i].envelope.getState() == Envelope::RELEASE) { 
-                double freq = midiToFrequency(currentScale[i]);
-                voices[i].noteOn(freq, osc1Wave, osc2Wave); 
-                voices[i].keyIndex = i;
-                lastPlayingKeyIndex = i; 
-            }
+        if (!(changed & (1 << i))) continue;
+
+        if (bitmap & (1 << i)) {
+            // Remember the note so a scale change while held still releases it
+            keyNotes[i] = currentScale[i];
+            noteOn(keyNotes[i], 127, now, i);
         } else {
-            // Key is released: Trigger noteOff only if the voice is currently in a key-down phase
-            if (voices[i].envelope.getState() != Envelope::IDLE && voices[i].envelope.getState() != Envelope::RELEASE) { 
-                voices[i].noteOff();
-            }
+            noteOff(keyNotes[i], now);
         }
-        
-        // This check is a safety for UI status reporting
-        if (voices[i].envelope.getState() == Envelope::IDLE) {
-            voices[i].keyIndex = -1;
+    }
+
+    currentKeyBitmap = bitmap;
+}
+
+
+// Maps the sample partition into the data address space; voices then read the
+// PCM in place. Without a partition or a valid bank the SAMPLE waveform is silent.
+void Synth::loadSamples() {
+    const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+        (esp_partition_subtype_t)SAMPLE_PARTITION_SUBTYPE, SAMPLE_PARTITION_LABEL);
+    if (partition == NULL) {
+        Serial.println("Samples: No sample partition (see partitions.csv).");
+        return;
+    }
+
+    const void* image;
+    spi_flash_mmap_handle_t handle;
+    if (esp_partition_mmap(partition, 0, partition->size, ESP_PARTITION_MMAP_DATA, &image, &handle) != ESP_OK) {
+        Serial.println("Samples: Failed to map the sample partition.");
+        return;
+    }
+
+    // The mapping stays in place for the life of the program
+    if (!samples.attach((const uint8_t*)image, partition->size)) {
+        spi_flash_munmap(handle);
+        Serial.println("Samples: Partition holds no valid sample bank.");
+        return;
+    }
+    Serial.printf("Samples: %d samples mapped from flash.\n", samples.getCount());
+}
+
+// -------------------------------------------------------------------
+// --- BATCHED PARAMETER UPDATES ---
+// -------------------------------------------------------------------
+
+bool Synth::applyParams(const ParamUpdate* updates, int count) {
+    bool staged = false;
+
+    portENTER_CRITICAL(&paramMux);
+    if (pendingParamCount + count <= MAX_PARAMS_PER_FRAME) {
+        memcpy(&pendingParams[pendingParamCount], updates, count * sizeof(ParamUpdate));
+        pendingParamCount += count;
+        staged = true;
+    }
+    portEXIT_CRITICAL(&paramMux);
+
+    if (staged) wakeAudio();
+    return staged;
+}
+
+// Audio core, block boundary: every staged entry lands before the next sample
+void Synth::applyPendingParams() {
+    ParamUpdate batch[MAX_PARAMS_PER_FRAME];
+    int count;
+
+    portENTER_CRITICAL(&paramMux);
+    count = pendingParamCount;
+    memcpy(batch, pendingParams, count * sizeof(ParamUpdate));
+    pendingParamCount = 0;
+    portEXIT_CRITICAL(&paramMux);
+
+    if (count == 0) return;
+
+    if (eventLog.state == EVENT_LOG_RECORDING) {
+        for (int i = 0; i < count; i++) {
+            uint8_t flags = (i == count - 1) ? LOG_FLAG_BATCH_END : 0;
+            EventLogEntry entry = { sampleClock, LOG_PARAM, flags, 0, batch[i].id, 0, -1, 0, batch[i].value };
+            eventLog.append(entry);
         }
     }
+    applyParamBatch(batch, count);
 }
 
-void Synth::audioGeneratorLoop() {
+void Synth::applyParamBatch(const ParamUpdate* batch, int count) {
+    double oldAttack = attackTime, oldDecay = decayTime, oldSustain = sustainLevel, oldRelease = releaseTime;
+    double oldDetune = unisonDetune, oldSpread = stereoSpread;
+    int oldUnison = unisonVoices;
+    int oldRoot = rootNoteMIDI, oldType = scaleType;
+
+    for (int i = 0; i < count; i++) {
+        setParam(batch[i].id, batch[i].value);
+    }
+
+    // Derived state is rebuilt once per batch, not once per entry
+    if (attackTime != oldAttack || decayTime != oldDecay || sustainLevel != oldSustain || releaseTime != oldRelease) {
+        updateEnvelopes();
+    }
+    if (unisonVoices != oldUnison || unisonDetune != oldDetune || stereoSpread != oldSpread) {
+        updateUnison();
+    }
+    if ((rootNoteMIDI != oldRoot || scaleType != oldType) && scaleType != 4) {
+        calculateScale(rootNoteMIDI, scaleType);
+    }
+}
+
+// Plain field writes (no logging): values were range-checked by parseParamFrame
+void Synth::setParam(uint8_t id, float value) {
+    if (id == PARAM_SAMPLE) {
+        sampleIndex = (int)value;
+        return;
+    }
+    if (id >= PARAM_SEQ_MODE) {
+        setSequencerParam(id, value);
+        return;
+    }
+    if (id >= PARAM_KEY_NOTE) {
+        currentScale[id - PARAM_KEY_NOTE] = (int)value;
+        scaleType = 4;
+        return;
+    }
+    if (id >= PARAM_MOD_SOURCE) {
+        int slot = (id - PARAM_MOD_SOURCE) % MAX_MOD_SLOTS;
+        ModSlot config = modMatrix.getSlot(slot);
+        if (id < PARAM_MOD_DEST) config.source = (ModSource)(int)value;
+        else if (id < PARAM_MOD_DEPTH) config.dest = (ModDest)(int)value;
+        else config.depth = value;
+        modMatrix.updateSlot(slot, config.source, config.dest, config.depth);
+        return;
+    }
+    if (id >= PARAM_LFO_RATE) {
+        int lfo = (id - PARAM_LFO_RATE) % NUM_LFOS;
+        Lfo& target = modMatrix.lfos[lfo];
+        if (id < PARAM_LFO_SHAPE) target.setup(value, target.getShape());
+        else target.setup(target.getRate(), (LfoShape)(int)value);
+        return;
+    }
+
+    switch (id) {
+        case PARAM_OSC1_WAVE: osc1Wave = (WaveType)(int)value; break;
+        case PARAM_OSC2_WAVE: osc2Wave = (WaveType)(int)value; break;
+        case PARAM_OSC1_GAIN: osc1Gain = value; break;
+        case PARAM_OSC2_GAIN: osc2Gain = value; break;
+        case PARAM_OSC2_ENABLED: osc2Enabled = (value >= 0.5f); break;
+        case PARAM_ATTACK: attackTime = value; break;
+        case PARAM_DECAY: decayTime = value; break;
+        case PARAM_SUSTAIN: sustainLevel = value; break;
+        case PARAM_RELEASE: releaseTime = value; break;
+        case PARAM_ROOT_NOTE: rootNoteMIDI = (int)value; break;
+        case PARAM_SCALE_TYPE: scaleType = (int)value; break;
+        case PARAM_UNISON_VOICES: unisonVoices = (int)value; break;
+        case PARAM_UNISON_DETUNE: unisonDetune = value; break;
+        case PARAM_STEREO_SPREAD: stereoSpread = value; break;
+        case PARAM_SYNTH_MODE: synthMode = (SynthMode)(int)value; break;
+        case PARAM_FM_RATIO: fmRatio = value; break;
+        case PARAM_FM_INDEX:
+            fmIndex = value;
+            fmDepth = fmDepthForIndex(fmIndex);
+            break;
+        case PARAM_PITCH_BEND_RANGE: pitchBendRange = (int)value; break;
+    }
+}
+
+void Synth::setSequencerParam(uint8_t id, float value) {
+    if (id >= PARAM_SEQ_VELOCITY) {
+        sequencer.steps[id - PARAM_SEQ_VELOCITY].velocity = (uint8_t)value;
+        return;
+    }
+    if (id >= PARAM_SEQ_NOTE) {
+        sequencer.steps[id - PARAM_SEQ_NOTE].note = (uint8_t)value;
+        return;
+    }
+
+    switch (id) {
+        case PARAM_SEQ_MODE: {
+            // Notes still sounding from the old mode are released at once,
+            // the sequencer's and those played into it alike
+            SequencerMode mode = (SequencerMode)(int)value;
+            if (mode != sequencer.getMode()) releasePlayedNotes();
+            SequencerEvent events[SEQ_MAX_EVENTS];
+            applySequencerEvents(events, sequencer.setMode(mode, sampleClock, events));
+            break;
+        }
+        case PARAM_ARP_MODE: sequencer.arpMode = (ArpMode)(int)value; break;
+        case PARAM_SEQ_TEMPO: sequencer.setTempo(value, I2S_SAMPLE_RATE); break;
+        case PARAM_SEQ_GATE: sequencer.gatePercent = (uint8_t)value; break;
+        case PARAM_SEQ_LENGTH: sequencer.length = (uint8_t)value; break;
+    }
+}
+
+float Synth::getParam(uint8_t id) const {
+    if (id == PARAM_SAMPLE) return sampleIndex;
+    if (id >= PARAM_SEQ_VELOCITY) return sequencer.steps[id - PARAM_SEQ_VELOCITY].velocity;
+    if (id >= PARAM_SEQ_NOTE) return sequencer.steps[id - PARAM_SEQ_NOTE].note;
+    switch (id) {
+        case PARAM_SEQ_MODE: return sequencer.getMode();
+        case PARAM_ARP_MODE: return sequencer.arpMode;
+        case PARAM_SEQ_TEMPO: return sequencer.tempo;
+        case PARAM_SEQ_GATE: return sequencer.gatePercent;
+        case PARAM_SEQ_LENGTH: return sequencer.length;
+    }
+    if (id >= PARAM_KEY_NOTE) return currentScale[id - PARAM_KEY_NOTE];
+    if (id >= PARAM_MOD_SOURCE) {
+        const ModSlot& slot = modMatrix.getSlot((id - PARAM_MOD_SOURCE) % MAX_MOD_SLOTS);
+        if (id < PARAM_MOD_DEST) return slot.source;
+        if (id < PARAM_MOD_DEPTH) return slot.dest;
+        return slot.depth;
+    }
+    if (id >= PARAM_LFO_RATE) {
+        const Lfo& lfo = modMatrix.lfos[(id - PARAM_LFO_RATE) % NUM_LFOS];
+        return (id < PARAM_LFO_SHAPE) ? lfo.getRate() : (float)lfo.getShape();
+    }
+
+    switch (id) {
+        case PARAM_OSC1_WAVE: return osc1Wave;
+        case PARAM_OSC2_WAVE: return osc2Wave;
+        case PARAM_OSC1_GAIN: return osc1Gain;
+        case PARAM_OSC2_GAIN: return osc2Gain;
+        case PARAM_OSC2_ENABLED: return osc2Enabled ? 1.0f : 0.0f;
+        case PARAM_ATTACK: return attackTime;
+        case PARAM_DECAY: return decayTime;
+        case PARAM_SUSTAIN: return sustainLevel;
+        case PARAM_RELEASE: return releaseTime;
+        case PARAM_ROOT_NOTE: return rootNoteMIDI;
+        case PARAM_SCALE_TYPE: return scaleType;
+        case PARAM_UNISON_VOICES: return unisonVoices;
+        case PARAM_UNISON_DETUNE: return unisonDetune;
+        case PARAM_STEREO_SPREAD: return stereoSpread;
+        case PARAM_SYNTH_MODE: return synthMode;
+        case PARAM_FM_RATIO: return fmRatio;
+        case PARAM_FM_INDEX: return fmIndex;
+        case PARAM_PITCH_BEND_RANGE: return pitchBendRange;
+        default: return 0.0f;
+    }
+}
+
+
+// -------------------------------------------------------------------
+// --- PRESET RECALL ---
+// -------------------------------------------------------------------
+
+bool Synth::recallPreset(const Preset* preset) {
+    if (pendingPreset != NULL) return false;
+    // A single pointer store is the publish; the audio core takes it at the next block
+    pendingPreset = preset;
+    wakeAudio();
+    return true;
+}
+
+// Audio core, block boundary: true if a preset was applied
+bool Synth::applyPendingPreset() {
+    const Preset* preset = pendingPreset;
+    if (preset == NULL) return false;
+
+    uint32_t start = micros();
+    applyPreset(*preset);
+
+    pendingPreset = NULL;
+    presetApplyUs = micros() - start;
+    return true;
+}
+
+// Plain copies only, every coefficient comes precomputed
+void Synth::applyPreset(const Preset& preset) {
+    for (int id = 0; id < PARAM_LFO_RATE; id++) {
+        setParam(id, preset.params[id]);
+    }
+    for (int l = 0; l < NUM_LFOS; l++) {
+        modMatrix.lfos[l].restore(preset.params[PARAM_LFO_RATE + l], (LfoShape)(int)preset.params[PARAM_LFO_SHAPE + l],
+                                  preset.lfoIncrement[l]);
+    }
+    for (int slot = 0; slot < MAX_MOD_SLOTS; slot++) {
+        modMatrix.updateSlot(slot, (ModSource)(int)preset.params[PARAM_MOD_SOURCE + slot],
+                             (ModDest)(int)preset.params[PARAM_MOD_DEST + slot], preset.params[PARAM_MOD_DEPTH + slot]);
+    }
+    // The stored key map is the resolved one, so no scale is recalculated
+    for (int k = 0; k < TOTAL_KEYS; k++) {
+        currentScale[k] = (int)preset.params[PARAM_KEY_NOTE + k];
+    }
+    for (int id = PARAM_SEQ_MODE; id < PARAM_SAMPLE; id++) {
+        setSequencerParam(id, preset.params[id]);
+    }
+    sampleIndex = (int)preset.params[PARAM_SAMPLE];
+
+    fmDepth = preset.fmDepth;
+    unisonCoefficients = preset.unison;
+    envelopeCoefficients = preset.envelope;
+    for (int v = 0; v < NUM_VOICES; v++) {
+        voices[v].envelope.setup(envelopeCoefficients);
+    }
+}
+
+
+// -------------------------------------------------------------------
+// --- NOTE EVENT API ---
+// -------------------------------------------------------------------
+
+bool Synth::pushEvent(const NoteEvent& event) {
+    bool queued = false;
+
+    portENTER_CRITICAL(&eventQueueMux);
+    uint16_t next = (eventHead + 1) % NOTE_EVENT_QUEUE_SIZE;
+    if (next != eventTail) {
+        eventQueue[eventHead] = event;
+        eventHead = next;
+        queued = true;
+    }
+    portEXIT_CRITICAL(&eventQueueMux);
+
+    if (queued) wakeAudio();
+    return queued;
+}
+
+void Synth::noteOn(int note, int velocity, uint32_t timestamp, int keyIndex, uint32_t dueMicros) {
+    if (note < 0 || note >= NUM_MIDI_NOTES) return;
+
+    NoteEvent event = { timestamp, EVENT_NOTE_ON, (uint8_t)note, (uint8_t)constrain(velocity, 1, 127), (int8_t)keyIndex, 0, dueMicros };
+    pushEvent(event);
+}
+
+void Synth::noteOff(int note, uint32_t timestamp, uint32_t dueMicros) {
+    if (note < 0 || note >= NUM_MIDI_NOTES) return;
+
+    NoteEvent event = { timestamp, EVENT_NOTE_OFF, (uint8_t)note, 0, -1, 0, dueMicros };
+    pushEvent(event);
+}
+
+void Synth::pitchBend(int bend, uint32_t timestamp, uint32_t dueMicros) {
+    NoteEvent event = { timestamp, EVENT_PITCH_BEND, 0, 0, -1, (int16_t)constrain(bend, -8192, 8191), dueMicros };
+    pushEvent(event);
+}
+
+void Synth::controlChange(int cc, int value, uint32_t timestamp, uint32_t dueMicros) {
+    NoteEvent event = { timestamp, EVENT_CONTROL_CHANGE, (uint8_t)(cc & 0x7F), (uint8_t)(value & 0x7F), -1, 0, dueMicros };
+    pushEvent(event);
+}
+
+void Synth::scheduleParam(uint8_t id, float value, uint32_t timestamp, uint32_t dueMicros) {
+    if (id >= NUM_PARAMS) return;
+
+    NoteEvent event = { timestamp, EVENT_PARAM, id, 0, -1, 0, dueMicros, value };
+    pushEvent(event);
+}
+
+// Audio core: apply everything queued since the last block. Timed events are
+// converted to the sample clock here and held until their sample comes up.
+void Synth::processEvents() {
+    uint32_t blockMicros = micros();
+
     while (true) {
-        int samplesToGenerate = i2s_config.dma_buf_len;
-        int totalVoicesActive = 0;
+        NoteEvent event;
+
+        portENTER_CRITICAL(&eventQueueMux);
+        bool empty = (eventTail == eventHead);
+        if (!empty) {
+            event = eventQueue[eventTail];
+            eventTail = (eventTail + 1) % NOTE_EVENT_QUEUE_SIZE;
+        }
+        portEXIT_CRITICAL(&eventQueueMux);
+
+        if (empty) break;
+
+        // Arrival -> audio core; time spent waiting in the schedule is not latency
+        uint32_t latency = micros() - event.timestamp;
+        if (latency > maxEventLatencyUs) {
+            maxEventLatencyUs = latency;
+        }
+
+        int32_t aheadUs = (int32_t)(event.dueMicros - blockMicros);
+        if (event.dueMicros == 0 || aheadUs <= 0 || scheduledCount == SCHEDULED_EVENT_SLOTS) {
+            // Immediate, already late, or no room: sound it now rather than drop it
+            logEvent(event, sampleClock, 0);
+            applyEvent(event);
+            continue;
+        }
+
+        ScheduledEvent& slot = scheduledEvents[scheduledCount++];
+        slot.dueSample = sampleClock + (uint32_t)((int64_t)aheadUs * I2S_SAMPLE_RATE / 1000000);
+        slot.event = event;
+    }
+}
+
+// Applies every held event due at or before 'offset' samples into this block
+// and returns the offset of the next one (or blockLength if none is due in it)
+int Synth::applyScheduledEvents(int offset, int blockLength) {
+    int nextOffset = blockLength;
+    int kept = 0;
+
+    for (int i = 0; i < scheduledCount; i++) {
+        int32_t due = (int32_t)(scheduledEvents[i].dueSample - sampleClock);
+
+        if (due <= offset) {
+            logEvent(scheduledEvents[i].event, sampleClock + offset, LOG_FLAG_SCHEDULED);
+            applyEvent(scheduledEvents[i].event);
+            continue;
+        }
+        if (due < nextOffset) {
+            nextOffset = due;
+        }
+        // Compact in place so same-sample events keep their arrival order
+        scheduledEvents[kept++] = scheduledEvents[i];
+    }
+
+    scheduledCount = kept;
+    return nextOffset;
+}
+
+uint32_t Synth::takeMaxEventLatency() {
+    uint32_t worst = maxEventLatencyUs;
+    maxEventLatencyUs = 0;
+    return worst;
+}
+
+Voice* Synth::allocateVoice(int note) {
+    Voice* quietest = NULL;
+    Voice* oldest = &voices[0];
+
+    // Same note still sounding anywhere: retrigger it rather than doubling up
+    for (int v = 0; v < NUM_VOICES; v++) {
+        if (voices[v].envelope.getState() != Envelope::IDLE && voices[v].note == note) return &voices[v];
+    }
+
+    for (int v = 0; v < NUM_VOICES; v++) {
+        Voice& voice = voices[v];
+        Envelope::State state = voice.envelope.getState();
+
+        if (state == Envelope::IDLE) return &voice;
+
+        if (state == Envelope::RELEASE && (quietest == NULL || voice.envelope.getGain() < quietest->envelope.getGain())) {
+            quietest = &voice;
+        }
+        if (voice.age < oldest->age) {
+            oldest = &voice;
+        }
+    }
+
+    // Steal the quietest releasing voice, otherwise the oldest held one
+    return (quietest != NULL) ? quietest : oldest;
+}
+
+void Synth::startNote(int note, int velocity, int keyIndex, bool sequenced) {
+    uint32_t increment = tuningTable[note];
+    if (increment == 0) return; // unmapped in the current tuning
+
+    Voice* voice = allocateVoice(note);
+    voice->note = note;
+    voice->keyIndex = keyIndex;
+    voice->velocityGain = (int32_t)velocity * 32767 / 127;
+    voice->age = ++voiceCounter;
+    voice->sustained = false;
+    voice->sequenced = sequenced;
+    voice->noteOn(increment, osc1Wave, osc2Wave);
+
+    lastPlayingKeyIndex = keyIndex;
+    lastPlayingNote = note;
+}
+
+void Synth::releaseNote(int note, bool sequenced) {
+    for (int v = 0; v < NUM_VOICES; v++) {
+        Voice& voice = voices[v];
+        Envelope::State state = voice.envelope.getState();
+        // Only voices in a key-down phase can be released
+        if (voice.note != note || voice.sequenced != sequenced) continue;
+        if (state == Envelope::IDLE || state == Envelope::RELEASE) continue;
+
+        if (sustainPedal) {
+            voice.sustained = true;
+        } else {
+            voice.noteOff();
+        }
+    }
+}
+
+// Sequencer mode change: a key played before it would otherwise never see its
+// note-off reach the voice (the arpeggiator takes note-offs for its own list)
+void Synth::releasePlayedNotes() {
+    for (int v = 0; v < NUM_VOICES; v++) {
+        Voice& voice = voices[v];
+        Envelope::State state = voice.envelope.getState();
+        if (voice.sequenced || state == Envelope::IDLE || state == Envelope::RELEASE) continue;
+        voice.sustained = false;
+        voice.noteOff();
+    }
+}
+
+void Synth::applySequencerEvents(const SequencerEvent* events, int count) {
+    for (int i = 0; i < count; i++) {
+        if (events[i].noteOn) {
+            startNote(events[i].note, events[i].velocity, -1, true);
+        } else {
+            releaseNote(events[i].note, true);
+        }
+    }
+}
+
+// Plays every sequencer event due at or before 'offset' samples into this
+// block and returns the offset of the next one (or blockLength)
+int Synth::runSequencer(int offset, int blockLength) {
+    if (!sequencer.isRunning()) return blockLength;
+
+    SequencerEvent events[SEQ_MAX_EVENTS];
+    uint32_t now = sampleClock + offset;
+    applySequencerEvents(events, sequencer.process(now, events));
+
+    // Never returns a zero-length segment, even if a step is somehow overdue
+    int32_t next = (int32_t)(sequencer.nextEventSample() - sampleClock);
+    return constrain(next, offset + 1, blockLength);
+}
+
+void Synth::applyEvent(const NoteEvent& event) {
+    switch (event.type) {
+        case EVENT_NOTE_ON:
+            // While the arpeggiator runs, played notes only feed its held-key list
+            if (sequencer.getMode() == SEQ_ARP) {
+                sequencer.holdNote(event.note, event.value);
+            } else {
+                startNote(event.note, event.value, event.keyIndex);
+            }
+            break;
+        case EVENT_NOTE_OFF:
+            if (sequencer.getMode() == SEQ_ARP) {
+                sequencer.releaseNote(event.note);
+            }
+            // Played voices only: the sequencer ends its own notes
+            releaseNote(event.note);
+            break;
+        case EVENT_PITCH_BEND: {
+            // bend / 8192 * range semitones, as a Q15 fraction of an octave.
+            // 8191 * 12 * 32768 does not fit 32 bits: multiply in 64.
+            int32_t pitchQ15 = (int32_t)((int64_t)event.bend * pitchBendRange * 32768 / (8192 * 12));
+            pitchBendRatio = pitchRatioQ16(pitchQ15);
+            break;
+        }
+        case EVENT_CONTROL_CHANGE:
+            switch (event.note) {
+                case 1: // Mod wheel
+                    modMatrix.setModWheel((int32_t)event.value * 32767 / 127);
+                    break;
+                case 64: // Sustain pedal
+                    sustainPedal = (event.value >= 64);
+                    if (!sustainPedal) {
+                        for (int v = 0; v < NUM_VOICES; v++) {
+                            if (voices[v].sustained) {
+                                voices[v].sustained = false;
+                                voices[v].noteOff();
+                            }
+                        }
+                    }
+                    break;
+                case 120: // All sound off
+                case 123: // All notes off
+                    for (int v = 0; v < NUM_VOICES; v++) {
+                        voices[v].sustained = false;
+                        voices[v].noteOff();
+                    }
+                    break;
+            }
+            break;
+        case EVENT_PARAM: {
+            ParamUpdate update = { event.note, event.paramValue };
+            applyParamBatch(&update, 1);
+            break;
+        }
+    }
+}
+
+// -------------------------------------------------------------------
+// --- AUDIO TASK IDLE ---
+// -------------------------------------------------------------------
+
+// Any core: called after new work is published
+void Synth::wakeAudio() {
+    if (!audioIdle) return;
+    wakeRequestMicros = micros();
+    xTaskNotifyGive(audioTaskHandle);
+}
 
-        for (int i = 0; i < samplesToGenerate; i++) {
-            int32_t mixedSample32Bit = 0;
-            totalVoicesActive = 0;
+// Audio core: anything that must be rendered or applied at the next block
+bool Synth::hasPendingWork() {
+    portENTER_CRITICAL(&eventQueueMux);
+    bool events = (eventTail != eventHead);
+    portEXIT_CRITICAL(&eventQueueMux);
 
-            for (int v = 0; v < TOTAL_KEYS; v++) {
-                if (voices[v].envelope.getState() != Envelope::IDLE) {
-                    mixedSample32Bit += voices[v].getSample();
-                    totalVoicesActive++;
+    portENTER_CRITICAL(&paramMux);
+    bool params = (pendingParamCount > 0);
+    portEXIT_CRITICAL(&paramMux);
+
+    // Event log start/stop requests and a running replay
+    EventLogState logState = eventLog.state;
+    bool logWork = eventLog.stopRequested || (logState != EVENT_LOG_IDLE && logState != EVENT_LOG_RECORDING);
+
+    return events || params || logWork || pendingPreset != NULL || tuningPending || scheduledCount > 0 ||
+           sequencer.isRunning();
+}
+
+// Audio core, after a block in which no voice sounded. The driver keeps
+// replaying its DMA buffers when nothing new is written (auto-clear would
+// output code 0, a full-scale step on the built-in DAC), so every buffer is
+// first overwritten with the midpoint. Work is re-checked before each write
+// and before sleeping, so a note arriving meanwhile is rendered at the next
+// free DMA slot, exactly as it would have been while playing.
+void Synth::waitForWork() {
+    for (int i = 0; i < i2s_config.dma_buf_count; i++) {
+        if (hasPendingWork()) return;
+        size_t bytes_written;
+        i2s_write(I2S_PORT, silenceBuffer, sizeof(silenceBuffer), &bytes_written, portMAX_DELAY);
+    }
+
+    // Publish the idle flag before the final check: a producer either sees
+    // it and notifies, or queued its work early enough to be seen here
+    audioIdle = true;
+    __sync_synchronize();
+    if (!hasPendingWork()) {
+        idleEntries++;
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        uint32_t latency = micros() - wakeRequestMicros;
+        if (latency > maxWakeLatencyUs) {
+            maxWakeLatencyUs = latency;
+        }
+    }
+    audioIdle = false;
+}
+
+// Reader side (UI / serial report); the audio core only adds to audioBusyMicros
+uint32_t Synth::takeAudioLoad() {
+    uint32_t now = micros();
+    uint32_t busy = audioBusyMicros;
+    uint32_t elapsed = now - loadWindowStart;
+    uint32_t load = (elapsed > 0) ? (uint32_t)((uint64_t)(busy - loadWindowBusy) * 1000 / elapsed) : 0;
+
+    loadWindowStart = now;
+    loadWindowBusy = busy;
+    return load;
+}
+
+uint32_t Synth::takeMaxWakeLatency() {
+    uint32_t worst = maxWakeLatencyUs;
+    maxWakeLatencyUs = 0;
+    return worst;
+}
+
+// -------------------------------------------------------------------
+// --- EVENT LOG RECORD / REPLAY ---
+// -------------------------------------------------------------------
+
+// Records what the audio core applies (not what core 0 sends): a key press is
+// logged as the note event setKeyBitmap produced, at the sample it sounded
+void Synth::logEvent(const NoteEvent& event, uint32_t sample, uint8_t flags) {
+    if (eventLog.state != EVENT_LOG_RECORDING) return;
+
+    EventLogEntry entry = { sample, LOG_EVENT, flags, event.type, event.note, event.value, event.keyIndex,
+                            event.bend, event.paramValue };
+    eventLog.append(entry);
+}
+
+// Audio core, block boundary while recording: opens a new segment when one
+// is due, or when this block's preset recall or retune must be replayed from
+// the snapshot rather than from entries
+void Synth::recordSegment(bool retuned, bool recalled) {
+    uint32_t flags = (recalled ? SEGMENT_RECALL : 0) | (retuned ? SEGMENT_RETUNE : 0);
+    if (flags == 0 && !eventLog.segmentDue()) return;
+
+    uint32_t start = micros();
+    captureSnapshot(eventLog.beginSegment(sampleClock, flags).start);
+    uint32_t elapsed = micros() - start;
+    if (elapsed > eventLog.maxSnapshotMicros) eventLog.maxSnapshotMicros = elapsed;
+}
+
+// Everything the next blocks render from, besides the entries still to come
+void Synth::captureSnapshot(EngineSnapshot& snapshot) {
+    presetCapture(snapshot.sound, "eventlog");
+    memcpy(snapshot.tuning, tuningTable, sizeof(snapshot.tuning));
+    for (int v = 0; v < NUM_VOICES; v++) {
+        snapshot.voices[v] = voices[v].saveState();
+    }
+    snapshot.sequencer = sequencer.saveState();
+    snapshot.modulation = modMatrix.saveState();
+    memcpy(snapshot.scheduled, scheduledEvents, sizeof(snapshot.scheduled));
+    snapshot.scheduledCount = scheduledCount;
+    snapshot.pitchBendRatio = pitchBendRatio;
+    snapshot.voiceCounter = voiceCounter;
+    snapshot.sustainPedal = sustainPedal;
+}
+
+// Replay start: the sound first (it resets what a parameter change resets),
+// then the state of every voice, the sequencer and the LFOs on top of it
+void Synth::restoreSnapshot(const EngineSnapshot& snapshot, uint32_t sample) {
+    applyPreset(snapshot.sound);
+    tuningTable = snapshot.tuning;
+    for (int v = 0; v < NUM_VOICES; v++) {
+        voices[v].restoreState(snapshot.voices[v]);
+    }
+    sequencer.restoreState(snapshot.sequencer);
+    modMatrix.restoreState(snapshot.modulation);
+    memcpy(scheduledEvents, snapshot.scheduled, sizeof(scheduledEvents));
+    scheduledCount = snapshot.scheduledCount;
+    pitchBendRatio = snapshot.pitchBendRatio;
+    voiceCounter = snapshot.voiceCounter;
+    sustainPedal = (snapshot.sustainPedal != 0);
+    sampleClock = sample;
+}
+
+// Live input that arrived while a replay ran is stale by the time it ends
+void Synth::discardPendingInput() {
+    portENTER_CRITICAL(&eventQueueMux);
+    eventTail = eventHead;
+    portEXIT_CRITICAL(&eventQueueMux);
+
+    portENTER_CRITICAL(&paramMux);
+    pendingParamCount = 0;
+    portEXIT_CRITICAL(&paramMux);
+
+    pendingPreset = NULL;
+}
+
+void Synth::endReplay() {
+    eventLog.finishReplay();
+    discardPendingInput();
+
+    // Notes, held arpeggiator keys and controllers the log left down would
+    // otherwise hang
+    for (int v = 0; v < NUM_VOICES; v++) {
+        voices[v] = Voice();
+        voices[v].envelope.setup(envelopeCoefficients);
+    }
+    scheduledCount = 0;
+    sequencer.clearNotes();
+    sustainPedal = false;
+    pitchBendRatio = PITCH_RATIO_UNITY;
+    modMatrix.setModWheel(0);
+
+    // Back from the log's tunings to the live one, taking any retune made meanwhile
+    tuningTable = noteIncrement[activeTuning];
+    tuningPending = false;
+}
+
+// Audio core, block boundary: takes core 0's start and stop requests.
+// Recording leaves the engine alone; its first snapshot is taken in this block.
+void Synth::updateEventLog() {
+    switch (eventLog.state) {
+        case EVENT_LOG_RECORD_REQUESTED:
+            eventLog.beginRecording();
+            break;
+        case EVENT_LOG_REPLAY_REQUESTED: {
+            const EventLogSegment& oldest = eventLog.segment(0);
+            restoreSnapshot(oldest.start, oldest.sample);
+            eventLog.beginReplay();
+            break;
+        }
+        case EVENT_LOG_RECORDING:
+            if (eventLog.stopRequested) eventLog.finishRecording();
+            break;
+        default:
+            break;
+    }
+
+    if (eventLog.state == EVENT_LOG_REPLAYING &&
+        (eventLog.stopRequested || eventLog.replayBlocks >= eventLog.data.header.blockCount)) {
+        endReplay();
+    }
+}
+
+// Audio core, replay: the log's entries for this block take the place of live
+// input. A segment that began with a recall or retune takes it from its
+// snapshot first, as the recording applied it before the block's entries.
+// Block-start entries are applied in their recorded order; scheduled events
+// go back into the schedule, so the block splits on the same samples.
+void Synth::feedReplay(int blockLength) {
+    const EventLogHeader& header = eventLog.data.header;
+    uint32_t blockEnd = sampleClock + blockLength;
+    ParamUpdate batch[MAX_PARAMS_PER_FRAME];
+    int batchCount = 0;
+
+    if (eventLog.replaySegment + 1 < header.segmentCount &&
+        eventLog.segment(eventLog.replaySegment + 1).sample == sampleClock) {
+        eventLog.nextReplaySegment();
+        const EventLogSegment& segment = eventLog.segment(eventLog.replaySegment);
+        if (segment.flags & SEGMENT_RETUNE) tuningTable = segment.start.tuning;
+        if (segment.flags & SEGMENT_RECALL) applyPreset(segment.start.sound);
+    }
+
+    while (eventLog.replayCursor < header.entryCount &&
+           (int32_t)(eventLog.entry(eventLog.replayCursor).sample - blockEnd) < 0) {
+        const EventLogEntry& entry = eventLog.entry(eventLog.replayCursor++);
+
+        switch (entry.kind) {
+            case LOG_PARAM:
+                // Re-batched exactly as recorded: derived state is rebuilt per batch
+                batch[batchCount].id = entry.note;
+                batch[batchCount].value = entry.paramValue;
+                batchCount++;
+                if ((entry.flags & LOG_FLAG_BATCH_END) || batchCount == MAX_PARAMS_PER_FRAME) {
+                    applyParamBatch(batch, batchCount);
+                    batchCount = 0;
+                }
+                break;
+            case LOG_EVENT: {
+                NoteEvent event = { 0, entry.type, entry.note, entry.value, entry.keyIndex, entry.bend, 0, entry.paramValue };
+                if ((entry.flags & LOG_FLAG_SCHEDULED) && scheduledCount < SCHEDULED_EVENT_SLOTS) {
+                    ScheduledEvent& slot = scheduledEvents[scheduledCount++];
+                    slot.dueSample = entry.sample;
+                    slot.event = event;
+                } else {
+                    applyEvent(event);
                 }
+                break;
             }
-            
-            // Mixing factor divided by 4 for headroom
-            int16_t finalMixedSample = (int16_t)(mixedSample32Bit / 4);
+        }
+    }
+
+    if (batchCount > 0) {
+        applyParamBatch(batch, batchCount);
+    }
+}
+
+int Synth::renderNextBlock() {
+    int32_t mixL[DMA_BUF_LEN];
+    int32_t mixR[DMA_BUF_LEN];
+    int samplesToGenerate = i2s_config.dma_buf_len;
+    int totalVoicesActive = 0;
+    uint32_t blockStart = micros();
+
+    memset(mixL, 0, sizeof(mixL));
+    memset(mixR, 0, sizeof(mixR));
+
+    updateEventLog();
+    const bool replaying = (eventLog.state == EVENT_LOG_REPLAYING);
+
+    if (replaying) {
+        // Live input waits (and is discarded) until the replay ends
+        feedReplay(samplesToGenerate);
+    } else {
+        // A tuning published by setTuning() applies from this block on; the
+        // table it replaces goes back to core 0
+        bool retuned = tuningPending;
+        if (retuned) {
+            tuningTable = noteIncrement[activeTuning];
+            tuningPending = false;
+        }
+
+        // Apply a recalled preset, staged parameter batches and queued
+        // note/controller events at the block boundary. A recording snapshots
+        // the engine between the first two.
+        bool recalled = applyPendingPreset();
+        if (eventLog.state == EVENT_LOG_RECORDING) recordSegment(retuned, recalled);
+        applyPendingParams();
+        processEvents();
+    }
+
+    // Advance the LFOs once per block (no-op when nothing is routed)
+    modMatrix.tick();
+
+    // Render the active voices, splitting the block wherever a timed
+    // event falls so it lands on its exact sample
+    int rendered = 0;
+    while (rendered < samplesToGenerate) {
+        int segmentEnd = min(applyScheduledEvents(rendered, samplesToGenerate),
+                             runSequencer(rendered, samplesToGenerate));
+
+        for (int v = 0; v < NUM_VOICES; v++) {
+            if (voices[v].envelope.getState() != Envelope::IDLE) {
+                voices[v].renderBlock(mixL + rendered, mixR + rendered, segmentEnd - rendered);
+                totalVoicesActive++;
+            }
+        }
+        rendered = segmentEnd;
+    }
+    sampleClock += samplesToGenerate;
+
+    for (int i = 0; i < samplesToGenerate; i++) {
+        // Mixing factor divided by 4 for headroom
+        int16_t finalLeft = (int16_t)constrain(mixL[i] / 4, -32768, 32767);
+        int16_t finalRight = (int16_t)constrain(mixR[i] / 4, -32768, 32767);
+
+        // DAC output needs 8-bit samples * 256 for 16-bit space
+        // This is the correct way to map a signed 16-bit sample (centered at 0) 
+        // to an unsigned 8-bit sample (centered at 128) and then shift it.
+        audioBuffer[i * 2] = (int16_t)(((uint8_t)((finalLeft >> 8) + 128)) << 8);
+        audioBuffer[i * 2 + 1] = (int16_t)(((uint8_t)((finalRight >> 8) + 128)) << 8);
+    }
+
+    if (replaying) {
+        eventLog.addReplayedBlock(audioBuffer, samplesToGenerate * 2, micros() - blockStart);
+    } else if (eventLog.state == EVENT_LOG_RECORDING) {
+        // A block whose entries did not all fit is not part of the log
+        if (eventLog.data.header.flags & EVENT_LOG_TRUNCATED) {
+            eventLog.finishRecording();
+        } else {
+            eventLog.addRecordedBlock(audioBuffer, samplesToGenerate * 2);
+        }
+    }
+
+    return totalVoicesActive;
+}
+
+void Synth::audioGeneratorLoop() {
+    audioTaskHandle = xTaskGetCurrentTaskHandle();
 
-            // DAC output needs 8-bit samples * 256 for 16-bit space
-            // This is the correct way to map a signed 16-bit sample (centered at 0) 
-            // to an unsigned 8-bit sample (centered at 128) and then shift it.
-            uint8_t sample8Bit = (uint8_t)((finalMixedSample >> 8) + 128);
-            int16_t final_sample = sample8Bit << 8;
+    while (true) {
+        uint32_t blockStart = micros();
+        int totalVoicesActive = renderNextBlock();
 
-            audioBuffer[i * 2] = final_sample;
-            audioBuffer[i * 2 + 1] = final_sample;
+        // Scope tap: a few hundred cycles per block, and only while someone is watching
+        if (scope.isEnabled()) {
+            uint32_t captureStart = ESP.getCycleCount();
+            scope.capture(audioBuffer, i2s_config.dma_buf_len);
+            uint32_t captureCycles = ESP.getCycleCount() - captureStart;
+            if (captureCycles > scope.maxCaptureCycles) scope.maxCaptureCycles = captureCycles;
         }
 
+        audioBusyMicros += micros() - blockStart;
+
         size_t bytes_written;
         i2s_write(I2S_PORT, audioBuffer, sizeof(audioBuffer), &bytes_written, portMAX_DELAY);
+        if (firstBlockMicros == 0) {
+            firstBlockMicros = micros();
+        }
         
-        if (totalVoicesActive == 0) {
-            vTaskDelay(1); 
+        // Nothing sounded in this block: stop rendering silence until new work arrives
+        if (totalVoicesActive == 0 && !hasPendingWork()) {
+            waitForWork();
         }
     }
 }
 
-void Synth::audioTask(void *parameter) {
+void Synth::audioTask(void *) {
     synth.audioGeneratorLoop(); 
 }
\ No newline at end of file
@@ -4,7 +4,14 @@
 #define SYNTH_H
 
 #include <Arduino.h>
-#include "control.h" 
+#include "Control.h" 
+#include "Modulation.h"
+#include "ParamFrame.h"
+#include "Tuning.h"
+#include "Sequencer.h"
+#include "Scope.h"
+#include "SampleBank.h"
+#include "Tables.h"
 #include "driver/i2s.h"
 #include "driver/dac.h"
 #include <math.h>
@@ -15,10 +22,20 @@ typedef int16_t (*WaveformFunc)(double phase);
 // --- I2S Configuration & Audio Constants ---
 #define I2S_PORT I2S_NUM_0
 #define I2S_SAMPLE_RATE 44100
-#define SINE_TABLE_SIZE 512
 #define DMA_BUF_LEN 64
 #define AUDIO_BUFFER_SIZE (DMA_BUF_LEN * 2) 
 
+// --- Polyphony & Note Event Constants ---
+#define NUM_VOICES 16
+#define NUM_MIDI_NOTES 128
+#define NOTE_EVENT_QUEUE_SIZE 64
+#define SCHEDULED_EVENT_SLOTS 32   // timed events held by the audio core until due
+
+// --- Unison Constants ---
+#define MAX_UNISON 8
+// 32-bit phase accumulators: the top SINE_TABLE_BITS bits index the table
+#define PHASE_INDEX_SHIFT (32 - SINE_TABLE_BITS)
+
 // Global I2S Configuration (DECLARED HERE, DEFINED IN synth.cpp)
 extern const i2s_config_t i2s_config;
 
@@ -31,17 +48,122 @@ extern const int SCALE_MAJOR[];
 extern const int SCALE_MINOR[]; 
 extern const int SCALE_PENT_MAJOR[]; 
 extern const int SCALE_PENT_MINOR[]; 
+extern const int SCALE_CHROMATIC[];
 
-// Waveform Enumeration
-enum WaveType { SINE, SQUARE, SAW, TRIANGLE };
+// --- Sample Partition (see partitions.csv, written by tools/build_samples.py) ---
+#define SAMPLE_PARTITION_LABEL "samples"
+#define SAMPLE_PARTITION_SUBTYPE 0x40
+
+// Waveform Enumeration (SAMPLE: OSC 1 only, plays synth.sampleIndex from the bank)
+enum WaveType { SINE, SQUARE, SAW, TRIANGLE, SAMPLE };
 extern const char* WAVE_NAMES[];
 
-// Global Array to hold the pre-calculated Sine Table
-extern int16_t SINE_TABLE[SINE_TABLE_SIZE];
+// Oscillator Combination Mode
+// MODE_MIX: OSC1 + OSC2 mixed by osc1Gain/osc2Gain
+// MODE_FM:  2-operator phase modulation, OSC2 (sine) modulates OSC1's phase
+enum SynthMode { MODE_MIX, MODE_FM };
+
+// FM cycle budget (estimated, ESP32 @ 240 MHz, 44.1 kHz => ~5440 cycles per
+// output sample for the whole engine, ~340 per voice at 16-voice polyphony):
+//   modulator: 1 interpolated table read + multiply        ~ 14 cycles/sample
+//   carrier:   1 interpolated (or shaped) read per unison copy ~ 16 cycles/sample
+// A single-carrier FM voice stays under ~35 cycles/sample, about 10% of core 1
+// with all 16 voices sounding.
+
+// SINE_TABLE and the other lookup tables are constant, see Tables.h
+
+// --- Note Events (core 0 producers -> audio core) ---
+enum NoteEventType { EVENT_NOTE_ON, EVENT_NOTE_OFF, EVENT_PITCH_BEND, EVENT_CONTROL_CHANGE, EVENT_PARAM };
+
+struct NoteEvent {
+    uint32_t timestamp;  // micros() when the event was produced
+    uint8_t type;        // NoteEventType
+    uint8_t note;        // MIDI note, CC number or ParamId
+    uint8_t value;       // velocity or CC value
+    int8_t keyIndex;     // keypad key that produced it, -1 for MIDI
+    int16_t bend;        // pitch bend, -8192 to 8191
+    uint32_t dueMicros;  // 0 = next block, otherwise micros() at which it should sound
+    float paramValue;    // EVENT_PARAM only
+};
+
+// A timed event converted to the audio sample clock
+struct ScheduledEvent {
+    uint32_t dueSample;
+    NoteEvent event;
+};
 
 // Forward declaration of the global Synth instance
 class Synth;
 extern Synth synth; 
+struct Preset;
+struct EngineSnapshot;
+
+// --- Precomputed Engine Coefficients ---
+// Derived from the sound parameters on a parameter change (or stored in a
+// Preset), so note-on and preset recall only copy them.
+struct EnvelopeCoefficients {
+    double attackRate;
+    double decayRate;
+    double releaseRate;   // 1.0 / (R_Time * SR), scaled by the gain at note-off
+    double sustainLevel;
+};
+
+struct UnisonCoefficients {
+    int32_t count;
+    uint32_t ratio[MAX_UNISON];  // Q16 detune ratio per copy
+    int32_t gainL[MAX_UNISON];   // Q15, includes pan and 1/sqrt(N) level
+    int32_t gainR[MAX_UNISON];
+};
+
+// --- Voice State (event log snapshots) ---
+// Fixed layout and pointer-free, so a snapshot taken on the ESP32 restores in
+// the Linux host build. Coefficients shared by every voice are not repeated:
+// they come back with the snapshot's sound (a Preset).
+struct OscillatorState {
+    double phase;
+    double frequency;
+    int32_t wave;
+    int32_t reserved;
+};
+
+struct UnisonState {
+    uint32_t phase[MAX_UNISON];
+    uint32_t phaseIncrement[MAX_UNISON];
+    int32_t gainL[MAX_UNISON];
+    int32_t gainR[MAX_UNISON];
+    int32_t count;
+    int32_t wave;
+};
+
+struct EnvelopeState {
+    double currentGain;
+    double releaseStartGain;
+    int32_t state;
+    int32_t reserved;
+};
+
+struct VoiceState {
+    UnisonState osc1;
+    OscillatorState osc2;
+    EnvelopeState envelope;
+    SamplePlayerState sampler;
+    double baseFrequency;
+    int32_t keyIndex;
+    int32_t note;
+    int32_t velocityGain;
+    uint32_t age;
+    int32_t modGain1;
+    int32_t modGain2;
+    int32_t modPan;
+    uint32_t modPitch;
+    uint32_t fmPhase;
+    uint32_t fmIncrement;
+    uint32_t sampleStep;
+    uint8_t sustained;
+    uint8_t sequenced;
+    uint8_t modPrimed;
+    uint8_t playingSample;
+};
 
 // --- Core Oscillator Class ---
 class Oscillator {
@@ -61,6 +183,33 @@ public:
     void setFrequency(double freq);
     double getFrequency() const { return frequency; }
     int16_t getNextSample();
+    OscillatorState saveState() const;
+    void restoreState(const OscillatorState& state);
+};
+
+// --- Unison Oscillator Bank (NEW) ---
+// Renders 1 to MAX_UNISON detuned copies of one waveform. The per-oscillator
+// state lives in contiguous arrays and the kernel runs one tight integer loop
+// per oscillator, so cost grows linearly with the unison count.
+class UnisonOscillator {
+private:
+    uint32_t phase[MAX_UNISON];
+    uint32_t phaseIncrement[MAX_UNISON];
+    int32_t gainL[MAX_UNISON]; // Q15, includes pan and 1/sqrt(N) level
+    int32_t gainR[MAX_UNISON];
+    int count = 1;
+    WaveType wave = SINE;
+
+public:
+    UnisonOscillator();
+    void setWaveform(WaveType type) { wave = type; }
+    static UnisonCoefficients computeCoefficients(int voices, double detuneCents, double stereoSpread);
+    void setup(uint32_t baseIncrement, const UnisonCoefficients& coefficients);
+    // pitchStart/pitchEnd (Q16 ratios) ramp every copy's increment across the block
+    void renderBlock(int32_t* outL, int32_t* outR, int numSamples, const int32_t* phaseMod = NULL,
+                     uint32_t pitchStart = PITCH_RATIO_UNITY, uint32_t pitchEnd = PITCH_RATIO_UNITY);
+    UnisonState saveState() const;
+    void restoreState(const UnisonState& state);
 };
 
 // --- Envelope Class (MODIFIED) ---
@@ -81,25 +230,55 @@ private:
     double releaseStartGain; // NEW: Capture the gain when noteOff is triggered
     
 public:
-    void setup(double attackTime, double decayTime, double sustainLvl, double releaseTime); 
+    static EnvelopeCoefficients computeCoefficients(double attackTime, double decayTime, double sustainLvl, double releaseTime);
+    void setup(const EnvelopeCoefficients& coefficients);
     void noteOn();
     void noteOff();
+    void stop();    // straight to IDLE with no release: the voice has nothing left to play
     double getNextGain();
+    double getGain() const { return currentGain; }
     State getState() const { return state; }
+    // The rates are not part of the state: setup() provides them
+    EnvelopeState saveState() const;
+    void restoreState(const EnvelopeState& saved);
 };
 
 
 // --- Voice Class ---
 class Voice {
 public:
-    Oscillator osc1;
+    UnisonOscillator osc1;
     Oscillator osc2;
     Envelope envelope; 
     int keyIndex = -1; 
+    int note = MIDI_C4;      // MIDI note currently assigned to this voice
+    int32_t velocityGain = 32767; // Q15
+    uint32_t age = 0;        // note-on order, used for voice stealing
+    bool sustained = false;  // released while the sustain pedal was down
+    bool sequenced = false;  // started by the sequencer, which also ends it
+    double baseFrequency = 0.0;
+
+    // Modulation state carried between blocks for per-sample interpolation
+    bool modPrimed = false;
+    int32_t modGain1 = 0;    // Q15
+    int32_t modGain2 = 0;    // Q15
+    int32_t modPan = 0;      // Q15, -32767 (left) to 32767 (right)
+    uint32_t modPitch = PITCH_RATIO_UNITY;
+
+    // FM modulator (interpolated sine, 32-bit phase)
+    uint32_t fmPhase = 0;
+    uint32_t fmIncrement = 0;
+
+    // Sample playback (replaces the unison oscillator when OSC 1 is SAMPLE)
+    SamplePlayer sampler;
+    uint32_t sampleStep = 0;     // Q16, at unity pitch
+    bool playingSample = false;
     
-    void noteOn(double freq, WaveType wave1, WaveType wave2);
+    void noteOn(uint32_t increment, WaveType wave1, WaveType wave2);
     void noteOff();
-    int16_t getSample();
+    void renderBlock(int32_t* mixL, int32_t* mixR, int numSamples);
+    VoiceState saveState() const;
+    void restoreState(const VoiceState& state);
 };
 
 
@@ -107,9 +286,80 @@ public:
 class Synth {
 private: 
     int16_t audioBuffer[AUDIO_BUFFER_SIZE]; 
+    int16_t silenceBuffer[AUDIO_BUFFER_SIZE]; // DAC midpoint, written while idle
     uint16_t currentKeyBitmap = 0; 
+    int keyNotes[TOTAL_KEYS];     // note started by each held key
+
+    // Note event ring (guarded by a spinlock, drained once per block)
+    NoteEvent eventQueue[NOTE_EVENT_QUEUE_SIZE];
+    uint16_t eventHead = 0;
+    uint16_t eventTail = 0;
+
+    // Timed events waiting for their sample (audio core only, kept in arrival order)
+    ScheduledEvent scheduledEvents[SCHEDULED_EVENT_SLOTS];
+    int scheduledCount = 0;
+
+    // Parameter batches staged by core 0, applied by the audio core at a block boundary
+    ParamUpdate pendingParams[MAX_PARAMS_PER_FRAME];
+    int pendingParamCount = 0;
+
+    // Phase increment per MIDI note (0 = unmapped). Double-buffered: setTuning
+    // fills the inactive table, flips 'activeTuning' and sets 'tuningPending';
+    // the audio core clears it once it has switched tables. Until then the
+    // other table may still be in use, so setTuning refuses to rewrite it.
+    uint32_t noteIncrement[2][NUM_MIDI_NOTES];
+    volatile int activeTuning = 0;
+    volatile bool tuningPending = false;
+    // Table note-ons use, resolved once per block (a replay points it into the log)
+    const uint32_t* tuningTable = noteIncrement[0];
+
+    // Preset published by recallPreset(), consumed at the next block boundary
+    const Preset* volatile pendingPreset = NULL;
+
+    // Idle handling: with no voice, sequencer or pending work the audio task
+    // parks the DMA on silence and sleeps until wakeAudio() notifies it
+    TaskHandle_t audioTaskHandle = NULL;
+    volatile bool audioIdle = false;
+    volatile uint32_t wakeRequestMicros = 0;
+    uint32_t loadWindowStart = 0;      // takeAudioLoad() bookkeeping (reader side)
+    uint32_t loadWindowBusy = 0;
+
+    // Audio-core performance state
+    bool sustainPedal = false;
+    uint32_t voiceCounter = 0;
     
     void calculateScale(int rootMIDI, int type);
+    bool pushEvent(const NoteEvent& event);
+    void processEvents();
+    int applyScheduledEvents(int offset, int blockLength);
+    int runSequencer(int offset, int blockLength);
+    void applyEvent(const NoteEvent& event);
+    void startNote(int note, int velocity, int keyIndex, bool sequenced = false);
+    // Releases 'note' on the voices played directly (sequenced = false) or on
+    // the sequencer's own voices, never both
+    void releaseNote(int note, bool sequenced = false);
+    void releasePlayedNotes();
+    void applySequencerEvents(const SequencerEvent* events, int count);
+    Voice* allocateVoice(int note);
+    void applyPendingParams();
+    void applyParamBatch(const ParamUpdate* batch, int count);
+    bool applyPendingPreset();
+    void applyPreset(const Preset& preset);
+    void updateEventLog();
+    void recordSegment(bool retuned, bool recalled);
+    void captureSnapshot(EngineSnapshot& snapshot);
+    void restoreSnapshot(const EngineSnapshot& snapshot, uint32_t sample);
+    void discardPendingInput();
+    void endReplay();
+    void feedReplay(int blockLength);
+    void logEvent(const NoteEvent& event, uint32_t sample, uint8_t flags);
+    bool hasPendingWork();
+    void waitForWork();
+    void loadSamples();
+    void setParam(uint8_t id, float value);
+    void setSequencerParam(uint8_t id, float value);
+    void updateEnvelopes();
+    void updateUnison();
 
 public:
     // Global parameters controlled by Web UI
@@ -119,29 +369,119 @@ public:
     double osc2Gain = 0.0; 
     bool osc2Enabled = false;
 
+    // Unison (applied to OSC 1 at note-on)
+    int unisonVoices = 1;        // 1 to MAX_UNISON
+    double unisonDetune = 20.0;  // total detune spread in cents
+    double stereoSpread = 0.5;   // 0.0 (mono) to 1.0 (hard L/R)
+
+    // FM / Phase Modulation
+    SynthMode synthMode = MODE_MIX;
+    double fmRatio = 1.0;        // modulator frequency = note frequency * ratio
+    double fmIndex = 2.0;        // peak phase deviation in radians
+    int32_t fmDepth = 0;         // fmIndex in phase units (see fmDepthForIndex)
+
+    // PCM samples read in place from the mapped flash partition
+    SampleBank samples;
+    int sampleIndex = 0;         // played by OSC 1 in SAMPLE mode
+
+    // LFOs and modulation routing (evaluated once per DMA block)
+    ModMatrix modMatrix;
+
+    // Arpeggiator / step sequencer, clocked by sampleClock on the audio core.
+    // Edit it only through applyParams (PARAM_SEQ_*).
+    Sequencer sequencer;
+
+    // Output capture for the Web UI scope (read it from the UI core only)
+    ScopeTap scope;
+
     // ADSR Envelope Parameters
     double attackTime = 0.05; // seconds
     double decayTime = 0.1;   // seconds
     double sustainLevel = 0.5; // 0.0 to 1.0
     double releaseTime = 0.5; // seconds
 
-    // Polyphony: An array of 16 independent voices
-    Voice voices[TOTAL_KEYS]; 
+    // Derived from the fields above (see updateEnvelopes / updateUnison)
+    EnvelopeCoefficients envelopeCoefficients;
+    UnisonCoefficients unisonCoefficients;
+
+    // Polyphony: 16 voices dynamically assigned to any of the 128 MIDI notes
+    Voice voices[NUM_VOICES]; 
+
+    // Performance controls (MIDI)
+    int pitchBendRange = 2;              // semitones
+    uint32_t pitchBendRatio = PITCH_RATIO_UNITY; // Q16, applied to every voice
 
     // Scale mapping and UI state
     int currentScale[TOTAL_KEYS]; 
     int rootNoteMIDI = MIDI_C4; 
-    int scaleType = 0; 
+    int scaleType = 0;      // 0-3 = SCALE_* arrays, 4 = custom map, 5 = chromatic
     
     // UI state for key reporting
     int lastPlayingKeyIndex = -1; 
+    int lastPlayingNote = -1;
+
+    // Samples rendered since boot (set back to a log's clock while it replays):
+    // the clock timed events are scheduled on
+    volatile uint32_t sampleClock = 0;
+    // micros() when the first block reached the DAC (0 until then)
+    volatile uint32_t firstBlockMicros = 0;
+
+    // Worst event-to-audio-core latency seen since last read (us)
+    volatile uint32_t maxEventLatencyUs = 0;
+    // Audio-core time spent applying the last recalled preset (us)
+    volatile uint32_t presetApplyUs = 0;
+    uint32_t takeMaxEventLatency();
+
+    // Audio task load: time spent rendering (not blocked in i2s_write or idle)
+    volatile uint32_t audioBusyMicros = 0;
+    volatile uint32_t idleEntries = 0;
+    // Worst notification -> audio task running delay after idle (us)
+    volatile uint32_t maxWakeLatencyUs = 0;
+    // Busy share of the audio task since the last call, in 0.1 % units
+    uint32_t takeAudioLoad();
+    uint32_t takeMaxWakeLatency();
     
     void begin();
     void setKeyBitmap(uint16_t bitmap);
+
+    // Note API (any core): events are queued and applied at the next block, or
+    // at the exact sample matching 'dueMicros' when one is given
+    void noteOn(int note, int velocity, uint32_t timestamp, int keyIndex = -1, uint32_t dueMicros = 0);
+    void noteOff(int note, uint32_t timestamp, uint32_t dueMicros = 0);
+    void pitchBend(int bend, uint32_t timestamp, uint32_t dueMicros = 0);
+    void controlChange(int cc, int value, uint32_t timestamp, uint32_t dueMicros = 0);
+    // Single timed parameter write (value must already be range-checked)
+    void scheduleParam(uint8_t id, float value, uint32_t timestamp, uint32_t dueMicros);
     void setScale(int rootMIDI, int type);
-    void setCustomNote(int keyIndex, int midiNote);
+    // Retune all 128 notes at once (any core; Hz, 0.0 = unmapped). Sounding
+    // notes keep their pitch, the next note-on uses the new table. Returns
+    // false while the audio core has not yet taken the previous tuning.
+    bool setTuning(const double frequencies[NUM_MIDI_NOTES]);
+    bool isTuningPending() const { return tuningPending; }
     
     void setADSR(double a, double d, double s, double r);
+    void setUnison(int voices, double detuneCents, double spread);
+    void setFM(SynthMode mode, double ratio, double index);
+
+    // Atomic batch update (any core): all entries take effect in the same block.
+    // Returns false if the staging area is full; nothing is applied in that case.
+    bool applyParams(const ParamUpdate* updates, int count);
+    // Current value of any ParamId, in the units applyParams takes
+    float getParam(uint8_t id) const;
+
+    // Preset recall (any core): 'preset' must stay untouched until the audio
+    // core has taken it. Returns false while a previous recall is pending.
+    bool recallPreset(const Preset* preset);
+    bool isPresetPending() const { return pendingPreset != NULL; }
+
+    // Any core: called after new work is published
+    void wakeAudio();
+
+    // Renders one DMA block into the output buffer (no I2S), applying
+    // pending work or, while an event log replays, the log's entries.
+    // Returns the number of voice segments rendered.
+    int renderNextBlock();
+    const int16_t* getOutputBlock() const { return audioBuffer; }
     
     void audioGeneratorLoop();
 
@@ -151,4 +491,7 @@ public:
 // --- Helper function for MIDI to Frequency Conversion ---
 double midiToFrequency(int midiNote);
 
+// FM index (radians) to the fmDepth phase scale used by Voice::renderBlock
+int32_t fmDepthForIndex(double index);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,70 @@
+// tables.cpp
+// GENERATED by tools/build_tables.py from Tables.h -- do not edit.
+
+#include "Tables.h"
+
+const int16_t SINE_TABLE[SINE_TABLE_SIZE] = {
+    0, 402, 804, 1206, 1607, 2009, 2410, 2811, 3211, 3611, 4011, 4409, 4807, 5205, 5601, 5997,
+    6392, 6786, 7179, 7571, 7961, 8351, 8739, 9126, 9511, 9895, 10278, 10659, 11038, 11416, 11792, 12166,
+    12539, 12909, 13278, 13645, 14009, 14372, 14732, 15090, 15446, 15799, 16150, 16499, 16845, 17189, 17530, 17868,
+    18204, 18537, 18867, 19194, 19519, 19840, 20159, 20474, 20787, 21096, 21402, 21705, 22004, 22301, 22594, 22883,
+    23169, 23452, 23731, 24006, 24278, 24546, 24811, 25072, 25329, 25582, 25831, 26077, 26318, 26556, 26789, 27019,
+    27244, 27466, 27683, 27896, 28105, 28309, 28510, 28706, 28897, 29085, 29268, 29446, 29621, 29790, 29955, 30116,
+    30272, 30424, 30571, 30713, 30851, 30984, 31113, 31236, 31356, 31470, 31580, 31684, 31785, 31880, 31970, 32056,
+    32137, 32213, 32284, 32350, 32412, 32468, 32520, 32567, 32609, 32646, 32678, 32705, 32727, 32744, 32757, 32764,
+    32767, 32764, 32757, 32744, 32727, 32705, 32678, 32646, 32609, 32567, 32520, 32468, 32412, 32350, 32284, 32213,
+    32137, 32056, 31970, 31880, 31785, 31684, 31580, 31470, 31356, 31236, 31113, 30984, 30851, 30713, 30571, 30424,
+    30272, 30116, 29955, 29790, 29621, 29446, 29268, 29085, 28897, 28706, 28510, 28309, 28105, 27896, 27683, 27466,
+    27244, 27019, 26789, 26556, 26318, 26077, 25831, 25582, 25329, 25072, 24811, 24546, 24278, 24006, 23731, 23452,
+    23169, 22883, 22594, 22301, 22004, 21705, 21402, 21096, 20787, 20474, 20159, 19840, 19519, 19194, 18867, 18537,
+    18204, 17868, 17530, 17189, 16845, 16499, 16150, 15799, 15446, 15090, 14732, 14372, 14009, 13645, 13278, 12909,
+    12539, 12166, 11792, 11416, 11038, 10659, 10278, 9895, 9511, 9126, 8739, 8351, 7961, 7571, 7179, 6786,
+    6392, 5997, 5601, 5205, 4807, 4409, 4011, 3611, 3211, 2811, 2410, 2009, 1607, 1206, 804, 402,
+    0, -402, -804, -1206, -1607, -2009, -2410, -2811, -3211, -3611, -4011, -4409, -4807, -5205, -5601, -5997,
+    -6392, -6786, -7179, -7571, -7961, -8351, -8739, -9126, -9511, -9895, -10278, -10659, -11038, -11416, -11792, -12166,
+    -12539, -12909, -13278, -13645, -14009, -14372, -14732, -15090, -15446, -15799, -16150, -16499, -16845, -17189, -17530, -17868,
+    -18204, -18537, -18867, -19194, -19519, -19840, -20159, -20474, -20787, -21096, -21402, -21705, -22004, -22301, -22594, -22883,
+    -23169, -23452, -23731, -24006, -24278, -24546, -24811, -25072, -25329, -25582, -25831, -26077, -26318, -26556, -26789, -27019,
+    -27244, -27466, -27683, -27896, -28105, -28309, -28510, -28706, -28897, -29085, -29268, -29446, -29621, -29790, -29955, -30116,
+    -30272, -30424, -30571, -30713, -30851, -30984, -31113, -31236, -31356, -31470, -31580, -31684, -31785, -31880, -31970, -32056,
+    -32137, -32213, -32284, -32350, -32412, -32468, -32520, -32567, -32609, -32646, -32678, -32705, -32727, -32744, -32757, -32764,
+    -32767, -32764, -32757, -32744, -32727, -32705, -32678, -32646, -32609, -32567, -32520, -32468, -32412, -32350, -32284, -32213,
+    -32137, -32056, -31970, -31880, -31785, -31684, -31580, -31470, -31356, -31236, -31113, -30984, -30851, -30713, -30571, -30424,
+    -30272, -30116, -29955, -29790, -29621, -29446, -29268, -29085, -28897, -28706, -28510, -28309, -28105, -27896, -27683, -27466,
+    -27244, -27019, -26789, -26556, -26318, -26077, -25831, -25582, -25329, -25072, -24811, -24546, -24278, -24006, -23731, -23452,
+    -23169, -22883, -22594, -22301, -22004, -21705, -21402, -21096, -20787, -20474, -20159, -19840, -19519, -19194, -18867, -18537,
+    -18204, -17868, -17530, -17189, -16845, -16499, -16150, -15799, -15446, -15090, -14732, -14372, -14009, -13645, -13278, -12909,
+    -12539, -12166, -11792, -11416, -11038, -10659, -10278, -9895, -9511, -9126, -8739, -8351, -7961, -7571, -7179, -6786,
+    -6392, -5997, -5601, -5205, -4807, -4409, -4011, -3611, -3211, -2811, -2410, -2009, -1607, -1206, -804, -402,
+};
+
+const uint32_t EXP2_TABLE[EXP2_TABLE_SIZE] = {
+    65536u, 66971u, 68438u, 69936u, 71468u, 73032u, 74632u, 76266u,
+    77936u, 79642u, 81386u, 83169u, 84990u, 86851u, 88752u, 90696u,
+    92682u, 94711u, 96785u, 98905u, 101070u, 103283u, 105545u, 107856u,
+    110218u, 112631u, 115098u, 117618u, 120194u, 122825u, 125515u, 128263u,
+    131072u, 133942u, 136875u, 139872u, 142935u, 146065u, 149263u, 152532u,
+    155872u, 159285u, 162773u, 166337u, 169979u, 173701u, 177505u, 181392u,
+    185364u, 189423u, 193571u, 197809u, 202141u, 206567u, 211090u, 215712u,
+    220436u, 225263u, 230195u, 235236u, 240387u, 245651u, 251030u, 256527u,
+    262144u,
+};
+
+const uint32_t NOTE_INCREMENT_12TET[TABLE_MIDI_NOTES] = {
+    796253u, 843601u, 893764u, 946910u, 1003216u, 1062871u, 1126072u, 1193032u,
+    1263973u, 1339133u, 1418762u, 1503126u, 1592507u, 1687202u, 1787529u, 1893821u,
+    2006433u, 2125742u, 2252145u, 2386065u, 2527947u, 2678267u, 2837525u, 3006253u,
+    3185014u, 3374405u, 3575058u, 3787642u, 4012867u, 4251484u, 4504291u, 4772130u,
+    5055895u, 5356535u, 5675051u, 6012507u, 6370029u, 6748811u, 7150116u, 7575284u,
+    8025734u, 8502969u, 9008582u, 9544260u, 10111791u, 10713070u, 11350102u, 12025014u,
+    12740059u, 13497622u, 14300233u, 15150569u, 16051469u, 17005939u, 18017164u, 19088521u,
+    20223583u, 21426140u, 22700205u, 24050029u, 25480118u, 26995245u, 28600466u, 30301138u,
+    32102938u, 34011878u, 36034329u, 38177042u, 40447167u, 42852281u, 45400410u, 48100059u,
+    50960237u, 53990491u, 57200933u, 60602277u, 64205876u, 68023756u, 72068659u, 76354085u,
+    80894335u, 85704562u, 90800821u, 96200119u, 101920475u, 107980982u, 114401866u, 121204555u,
+    128411752u, 136047513u, 144137319u, 152708170u, 161788670u, 171409125u, 181601642u, 192400238u,
+    203840951u, 215961965u, 228803732u, 242409110u, 256823505u, 272095026u, 288274638u, 305416340u,
+    323577341u, 342818251u, 363203285u, 384800476u, 407681903u, 431923931u, 457607464u, 484818220u,
+    513647011u, 544190052u, 576549277u, 610832681u, 647154682u, 685636502u, 726406570u, 769600953u,
+    815363807u, 863847862u, 915214929u, 969636440u, 1027294023u, 1088380105u, 1153098554u, 1221665362u,
+};
@@ -0,0 +1,22 @@
+// tables.h
+
+#ifndef TABLES_H
+#define TABLES_H
+
+#include <stdint.h>
+
+// --- Lookup Tables (GENERATED into Tables.cpp by tools/build_tables.py) ---
+// Constant data: the linker places it in flash (.rodata), so nothing is
+// computed or copied at boot. Re-run the script after changing a constant here.
+#define SINE_TABLE_BITS 9
+#define SINE_TABLE_SIZE (1 << SINE_TABLE_BITS)
+#define EXP2_TABLE_SIZE 65            // 2^(i/32) in Q16 over two octaves
+#define TABLE_SAMPLE_RATE 44100       // must match I2S_SAMPLE_RATE
+#define TABLE_MIDI_NOTES 128
+
+extern const int16_t SINE_TABLE[SINE_TABLE_SIZE];
+extern const uint32_t EXP2_TABLE[EXP2_TABLE_SIZE];
+// 12-TET phase increment per MIDI note at TABLE_SAMPLE_RATE (0 = at or above Nyquist)
+extern const uint32_t NOTE_INCREMENT_12TET[TABLE_MIDI_NOTES];
+
+#endif
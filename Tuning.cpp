@@ -0,0 +1,176 @@
+// tuning.cpp
+
+#include "Tuning.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Advances 'cursor' past the next line that is not a '!' comment and returns
+// its start, or NULL at the end of the text
+static const char* nextLine(const char*& cursor) {
+    while (*cursor != '\0') {
+        const char* line = cursor;
+        const char* end = strchr(line, '\n');
+        cursor = (end != NULL) ? end + 1 : line + strlen(line);
+
+        if (line[0] != '!') return line;
+    }
+    return NULL;
+}
+
+static const char* skipSpaces(const char* p) {
+    while (*p == ' ' || *p == '\t') p++;
+    return p;
+}
+
+static bool parseInt(const char* line, int& value) {
+    if (line == NULL) return false;
+    char* end;
+    value = (int)strtol(skipSpaces(line), &end, 10);
+    return end != skipSpaces(line);
+}
+
+// "100.0" (cents, has a '.'), "3/2" (ratio) or "2" (integer ratio)
+static bool parsePitch(const char* line, double& cents) {
+    const char* p = skipSpaces(line);
+    const char* token = p;
+    while (*token != '\0' && *token != ' ' && *token != '\t' && *token != '\r' && *token != '\n' && *token != '.') token++;
+
+    char* end;
+    if (*token == '.') {
+        cents = strtod(p, &end);
+        return end != p;
+    }
+
+    long numerator = strtol(p, &end, 10);
+    if (end == p || numerator <= 0) return false;
+
+    long denominator = 1;
+    if (*end == '/') {
+        const char* start = end + 1;
+        denominator = strtol(start, &end, 10);
+        if (end == start || denominator <= 0) return false;
+    }
+
+    cents = 1200.0 * log2((double)numerator / (double)denominator);
+    return true;
+}
+
+bool parseScl(const char* text, ScaleDefinition& out) {
+    const char* cursor = text;
+
+    // The description line may be empty but must exist
+    const char* line = nextLine(cursor);
+    if (line == NULL) return false;
+
+    size_t length = strcspn(line, "\r\n");
+    if (length >= TUNING_DESCRIPTION_LENGTH) length = TUNING_DESCRIPTION_LENGTH - 1;
+    memcpy(out.description, line, length);
+    out.description[length] = '\0';
+
+    if (!parseInt(nextLine(cursor), out.count) || out.count < 1 || out.count > MAX_SCALE_DEGREES) return false;
+
+    for (int i = 0; i < out.count; i++) {
+        line = nextLine(cursor);
+        if (line == NULL || !parsePitch(line, out.cents[i])) return false;
+    }
+
+    // A period at or below the tonic would make the table non-monotonic across octaves
+    return out.cents[out.count - 1] > 0.0;
+}
+
+bool parseKbm(const char* text, KeyboardMapping& out) {
+    const char* cursor = text;
+
+    if (!parseInt(nextLine(cursor), out.mapSize) || out.mapSize < 0 || out.mapSize > MAX_SCALE_DEGREES) return false;
+    if (!parseInt(nextLine(cursor), out.firstNote) || !parseInt(nextLine(cursor), out.lastNote)) return false;
+    if (!parseInt(nextLine(cursor), out.middleNote) || !parseInt(nextLine(cursor), out.referenceNote)) return false;
+
+    const char* line = nextLine(cursor);
+    if (line == NULL) return false;
+    char* end;
+    out.referenceFrequency = strtod(skipSpaces(line), &end);
+    if (end == skipSpaces(line) || !(out.referenceFrequency > 0.0)) return false;
+
+    if (!parseInt(nextLine(cursor), out.octaveDegree) || out.octaveDegree < 0) return false;
+
+    for (int i = 0; i < out.mapSize; i++) {
+        line = nextLine(cursor);
+        if (line == NULL) return false;
+
+        const char* p = skipSpaces(line);
+        int degree;
+        if (*p == 'x' || *p == 'X') {
+            out.map[i] = -1;
+        } else if (parseInt(p, degree) && degree >= 0) {
+            out.map[i] = (int16_t)degree;
+        } else {
+            return false;
+        }
+    }
+
+    return out.firstNote >= 0 && out.lastNote < TUNING_NUM_NOTES && out.firstNote <= out.lastNote &&
+           out.middleNote >= 0 && out.middleNote < TUNING_NUM_NOTES &&
+           out.referenceNote >= 0 && out.referenceNote < TUNING_NUM_NOTES;
+}
+
+void defaultScale(ScaleDefinition& scale) {
+    strcpy(scale.description, "12-TET");
+    scale.count = 12;
+    for (int i = 0; i < 12; i++) {
+        scale.cents[i] = 100.0 * (i + 1);
+    }
+}
+
+void defaultKeyboardMapping(KeyboardMapping& mapping, int scaleCount) {
+    mapping.mapSize = 0;
+    mapping.firstNote = 0;
+    mapping.lastNote = TUNING_NUM_NOTES - 1;
+    mapping.middleNote = 60;
+    mapping.referenceNote = 69;
+    mapping.referenceFrequency = 440.0;
+    mapping.octaveDegree = scaleCount;
+}
+
+static int floorDiv(int a, int b) {
+    int q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+// Scale degree played by MIDI note 'note', or false if the key is unmapped
+static bool keyDegree(const KeyboardMapping& mapping, int note, int& degree) {
+    int offset = note - mapping.middleNote;
+    if (mapping.mapSize == 0) {
+        degree = offset;
+        return true;
+    }
+
+    int octave = floorDiv(offset, mapping.mapSize);
+    int entry = mapping.map[offset - octave * mapping.mapSize];
+    if (entry < 0) return false;
+
+    degree = octave * mapping.octaveDegree + entry;
+    return true;
+}
+
+static double degreeCents(const ScaleDefinition& scale, int degree) {
+    int period = floorDiv(degree, scale.count);
+    int step = degree - period * scale.count;
+    return period * scale.cents[scale.count - 1] + (step > 0 ? scale.cents[step - 1] : 0.0);
+}
+
+bool buildTuningTable(const ScaleDefinition& scale, const KeyboardMapping& mapping, double frequencies[TUNING_NUM_NOTES]) {
+    int referenceDegree;
+    if (!keyDegree(mapping, mapping.referenceNote, referenceDegree)) return false;
+    double referenceCents = degreeCents(scale, referenceDegree);
+
+    for (int note = 0; note < TUNING_NUM_NOTES; note++) {
+        int degree;
+        if (note < mapping.firstNote || note > mapping.lastNote || !keyDegree(mapping, note, degree)) {
+            frequencies[note] = 0.0;
+            continue;
+        }
+        frequencies[note] = mapping.referenceFrequency * pow(2.0, (degreeCents(scale, degree) - referenceCents) / 1200.0);
+    }
+    return true;
+}
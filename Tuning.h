@@ -0,0 +1,48 @@
+// tuning.h
+
+#ifndef TUNING_H
+#define TUNING_H
+
+// Plain C++ (no Arduino dependencies) so Scala files can be parsed and tables
+// checked on a host machine.
+#include <stdint.h>
+
+#define TUNING_NUM_NOTES 128
+#define MAX_SCALE_DEGREES 128
+#define TUNING_DESCRIPTION_LENGTH 48
+
+// --- Scala Scale (.scl) ---
+// cents[i] is degree i+1 above the tonic; cents[count-1] is the period (usually 1200)
+struct ScaleDefinition {
+    char description[TUNING_DESCRIPTION_LENGTH];
+    int count;
+    double cents[MAX_SCALE_DEGREES];
+};
+
+// --- Scala Keyboard Mapping (.kbm) ---
+// mapSize == 0 is the linear mapping: consecutive keys are consecutive degrees
+struct KeyboardMapping {
+    int mapSize;
+    int firstNote;
+    int lastNote;
+    int middleNote;        // key that plays degree 0
+    int referenceNote;
+    double referenceFrequency;
+    int octaveDegree;      // degrees the mapping shifts by every mapSize keys
+    int16_t map[MAX_SCALE_DEGREES]; // scale degree per key, -1 = unmapped ('x')
+};
+
+// Both parsers read the NUL-terminated text in place and never allocate.
+// They return false (leaving 'out' unusable) on any malformed field.
+bool parseScl(const char* text, ScaleDefinition& out);
+bool parseKbm(const char* text, KeyboardMapping& out);
+
+// 12-TET and the default mapping (A4 = 440 Hz on MIDI 69, degree 0 on MIDI 60)
+void defaultScale(ScaleDefinition& scale);
+void defaultKeyboardMapping(KeyboardMapping& mapping, int scaleCount);
+
+// Frequency in Hz for every MIDI note (0.0 = unmapped or outside first/last).
+// Returns false if the reference note itself is unmapped.
+bool buildTuningTable(const ScaleDefinition& scale, const KeyboardMapping& mapping, double frequencies[TUNING_NUM_NOTES]);
+
+#endif
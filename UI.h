@@ -5,8 +5,13 @@
 
 #include <WiFi.h>
 #include <WebServer.h>
-#include "synth.h"
-#include "HTML_content.h"
+#include <WebSocketsServer.h>
+#include "Synth.h"
+#include "OscServer.h"
+#include "Preset.h"
+#include "Footprint.h"
+#include "EventLog.h"
+#include "HTML_Content_gz.h" // generated from HTML_Content.h by tools/build_html.py
 
 // WiFi credentials
 const char* ssid = "APSIT_SYNTH";
@@ -15,22 +20,62 @@ const char* password = "12345678";
 // Instantiate the web server
 WebServer server(80);
 
+// WebSocket channel: pushes status changes, accepts compact parameter frames
+#define WS_PORT 81
+WebSocketsServer webSocket(WS_PORT);
+
+// Last status pushed to WebSocket clients
+int lastPushedNote = -2;
+int lastPushedKeyIndex = -2;
+
+// --- STATUS ---
+
+// Writes {"note": "..."} into buf without touching the heap
+void formatStatus(char* buf, size_t len) {
+    int midi = synth.lastPlayingNote;
+    if (midi == -1) {
+        snprintf(buf, len, "{\"note\": \"None\"}");
+    } else if (synth.lastPlayingKeyIndex != -1) {
+        // Keypad notes show their key, MIDI notes have no key index
+        snprintf(buf, len, "{\"note\": \"K%d (%s%d)\"}", synth.lastPlayingKeyIndex + 1, NOTE_NAMES[midi % 12], (midi / 12) - 1);
+    } else {
+        snprintf(buf, len, "{\"note\": \"MIDI (%s%d)\"}", NOTE_NAMES[midi % 12], (midi / 12) - 1);
+    }
+}
+
 // --- HANDLERS ---
 
+// Serves the pre-compressed page straight from flash. The ETag changes only when
+// the page does, so repeat visits revalidate with a tiny 304 instead of a resend.
 void handleRoot() {
-    server.send(200, "text/html", INDEX_HTML);
+    server.sendHeader("ETag", INDEX_HTML_ETAG);
+    server.sendHeader("Cache-Control", "no-cache");
+
+    if (server.hasHeader("If-None-Match") && server.header("If-None-Match") == INDEX_HTML_ETAG) {
+        server.send(304);
+        return;
+    }
+
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, "text/html", (const char*)INDEX_HTML_GZ, INDEX_HTML_GZ_LEN);
+}
+
+// Legacy endpoints stage their writes as one batch, like a binary frame, so
+// every UI parameter write lands on a block boundary (and in the event log)
+bool stageParams(const ParamUpdate* updates, int count) {
+    for (int i = 0; i < count; i++) {
+        if (!paramInRange(updates[i].id, updates[i].value)) return false;
+    }
+    return synth.applyParams(updates, count);
 }
 
 void handleSetOsc() {
     int oscNum = server.arg("osc").toInt(); 
     int waveType = server.arg("wave").toInt(); 
 
-    if (waveType >= SINE && waveType <= TRIANGLE) {
-        if (oscNum == 1) {
-            synth.osc1Wave = (WaveType)waveType;
-        } else if (oscNum == 2) {
-            synth.osc2Wave = (WaveType)waveType;
-        }
+    // SAMPLE replaces OSC 1's oscillator bank; OSC 2 only synthesizes (see PARAM_INFO)
+    ParamUpdate update = { (uint8_t)(oscNum == 1 ? PARAM_OSC1_WAVE : PARAM_OSC2_WAVE), (float)waveType };
+    if ((oscNum == 1 || oscNum == 2) && stageParams(&update, 1)) {
         server.send(200, "text/plain", "OK");
     } else {
         server.send(400, "text/plain", "Invalid Wave Type");
@@ -41,106 +86,539 @@ void handleSetGain() {
     int oscNum = server.arg("osc").toInt();
     
     // Handle Gain (0 to 100)
-    if (server.hasArg("gain")) {
-        double gain = server.arg("gain").toInt() / 100.0;
-        
-        if (oscNum == 1) {
-            synth.osc1Gain = gain;
-        } else if (oscNum == 2) {
-            synth.osc2Gain = gain;
+    if (server.hasArg("gain") && (oscNum == 1 || oscNum == 2)) {
+        ParamUpdate update = { (uint8_t)(oscNum == 1 ? PARAM_OSC1_GAIN : PARAM_OSC2_GAIN), server.arg("gain").toInt() / 100.0f };
+        if (stageParams(&update, 1)) {
+            server.send(200, "text/plain", "OK");
+            return;
         }
-        server.send(200, "text/plain", "OK");
-        return;
     }
     
     // Handle OSC 2 Enable/Disable
     if (server.hasArg("enabled")) {
-        bool enabled = server.arg("enabled").toInt() == 1;
-        synth.osc2Enabled = enabled;
-        server.send(200, "text/plain", "OK");
-        return;
+        ParamUpdate update = { PARAM_OSC2_ENABLED, server.arg("enabled").toInt() == 1 ? 1.0f : 0.0f };
+        if (stageParams(&update, 1)) {
+            server.send(200, "text/plain", "OK");
+            return;
+        }
     }
     
     server.send(400, "text/plain", "Invalid Parameter");
 }
 
-void handleSetADSR() {
-    double attack = server.arg("a").toFloat();
-    double decay = server.arg("d").toFloat();
-    double sustain = server.arg("s").toFloat();
-    double release = server.arg("r").toFloat();
+void handleSetUnison() {
+    // Clamped rather than rejected, as this endpoint always has been
+    ParamUpdate updates[] = {
+        { PARAM_UNISON_VOICES, (float)constrain(server.arg("voices").toInt(), 1, MAX_UNISON) },
+        { PARAM_UNISON_DETUNE, constrain(server.arg("detune").toFloat(), 0.0f, 100.0f) },
+        { PARAM_STEREO_SPREAD, constrain(server.arg("spread").toInt() / 100.0f, 0.0f, 1.0f) }
+    };
+    
+    if (stageParams(updates, 3)) {
+        server.send(200, "text/plain", "OK");
+    } else {
+        server.send(503, "text/plain", "Busy");
+    }
+}
+
+void handleSetFM() {
+    ParamUpdate updates[] = {
+        { PARAM_SYNTH_MODE, (float)server.arg("mode").toInt() },
+        { PARAM_FM_RATIO, constrain(server.arg("ratio").toFloat(), 0.25f, 16.0f) },
+        { PARAM_FM_INDEX, constrain(server.arg("index").toFloat(), 0.0f, 10.0f) }
+    };
     
-    synth.setADSR(attack, decay, sustain, release);
+    if (stageParams(updates, 3)) {
+        server.send(200, "text/plain", "OK");
+    } else {
+        server.send(400, "text/plain", "Invalid Mode");
+    }
+}
+
+void handleSetLFO() {
+    int lfo = server.arg("lfo").toInt();
+    ParamUpdate updates[] = {
+        { (uint8_t)(PARAM_LFO_RATE + lfo), constrain(server.arg("rate").toFloat(), 0.01f, 50.0f) },
+        { (uint8_t)(PARAM_LFO_SHAPE + lfo), (float)server.arg("shape").toInt() }
+    };
     
-    server.send(200, "text/plain", "OK");
+    if (lfo >= 0 && lfo < NUM_LFOS && stageParams(updates, 2)) {
+        server.send(200, "text/plain", "OK");
+    } else {
+        server.send(400, "text/plain", "Invalid LFO");
+    }
 }
 
+void handleSetMod() {
+    int slot = server.arg("slot").toInt();
+    ParamUpdate updates[] = {
+        { (uint8_t)(PARAM_MOD_SOURCE + slot), (float)server.arg("src").toInt() },
+        { (uint8_t)(PARAM_MOD_DEST + slot), (float)server.arg("dst").toInt() },
+        { (uint8_t)(PARAM_MOD_DEPTH + slot), constrain(server.arg("depth").toInt() / 100.0f, -1.0f, 1.0f) }
+    };
+    
+    if (slot >= 0 && slot < MAX_MOD_SLOTS && stageParams(updates, 3)) {
+        server.send(200, "text/plain", "OK");
+    } else {
+        server.send(400, "text/plain", "Invalid Mod Slot");
+    }
+}
 
-void handleSetScale() {
-    int rootMIDI = server.arg("root").toInt();
-    int type = server.arg("type").toInt();
+void handleSetADSR() {
+    ParamUpdate updates[] = {
+        { PARAM_ATTACK, server.arg("a").toFloat() },
+        { PARAM_DECAY, server.arg("d").toFloat() },
+        { PARAM_SUSTAIN, server.arg("s").toFloat() },
+        { PARAM_RELEASE, server.arg("r").toFloat() }
+    };
     
-    synth.setScale(rootMIDI, type);
+    if (stageParams(updates, 4)) {
+        server.send(200, "text/plain", "OK");
+    } else {
+        server.send(400, "text/plain", "Invalid ADSR");
+    }
+}
+
+
+void handleSetScale() {
+    ParamUpdate updates[] = {
+        { PARAM_ROOT_NOTE, (float)server.arg("root").toInt() },
+        { PARAM_SCALE_TYPE, (float)server.arg("type").toInt() }
+    };
     
-    server.send(200, "text/plain", "OK");
+    if (stageParams(updates, 2)) {
+        server.send(200, "text/plain", "OK");
+    } else {
+        server.send(400, "text/plain", "Invalid Scale");
+    }
 }
 
-// FIX: Corrected the string parsing logic to avoid infinite loop
+// Parses "keyIndex:midiNote,keyIndex:midiNote,..." in place (no substring copies)
 void handleSetCustomNote() {
     if (server.method() == HTTP_POST && server.hasArg("key_data")) {
         String data = server.arg("key_data");
+        const char* cursor = data.c_str();
+        ParamUpdate updates[TOTAL_KEYS + 1];
+        int count = 0;
         
-        int startIndex = 0;
-        // Loop while there is remaining data to process
-        while (startIndex < data.length()) {
-            int commaIndex = data.indexOf(',', startIndex);
-            String pair;
+        while (*cursor != '\0' && count < TOTAL_KEYS) {
+            char* end;
+            int keyIndex = strtol(cursor, &end, 10);
             
-            if (commaIndex == -1) {
-                // Last segment, no comma found
-                pair = data.substring(startIndex);
-                startIndex = data.length(); // Force termination of the loop next cycle
-            } else {
-                // Segment found before comma
-                pair = data.substring(startIndex, commaIndex);
-                startIndex = commaIndex + 1;
-            }
-            
-            int colonIndex = pair.indexOf(':');
-            if (colonIndex != -1) {
-                // The pair format is "keyIndex:midiNote"
-                int keyIndex = pair.substring(0, colonIndex).toInt();
-                int midiNote = pair.substring(colonIndex + 1).toInt();
-
-                // Set the note in the synth engine if index is valid
-                if (keyIndex >= 0 && keyIndex < TOTAL_KEYS) {
-                    synth.setCustomNote(keyIndex, midiNote);
+            if (*end == ':') {
+                int midiNote = strtol(end + 1, &end, 10);
+
+                // Skip invalid keys and notes
+                if (keyIndex >= 0 && keyIndex < TOTAL_KEYS && midiNote >= 0 && midiNote < NUM_MIDI_NOTES) {
+                    updates[count].id = PARAM_KEY_NOTE + keyIndex;
+                    updates[count].value = midiNote;
+                    count++;
                 }
             }
+            
+            // Skip to the next pair
+            while (*end != '\0' && *end != ',') end++;
+            cursor = (*end == ',') ? end + 1 : end;
         }
         
         // Ensure the synth switches to custom scale mode
-        synth.scaleType = 4;
-        server.send(200, "text/plain", "Custom Scale Set OK");
+        updates[count].id = PARAM_SCALE_TYPE;
+        updates[count].value = 4;
+        count++;
+
+        if (stageParams(updates, count)) {
+            server.send(200, "text/plain", "Custom Scale Set OK");
+        } else {
+            server.send(503, "text/plain", "Busy");
+        }
     } else {
         server.send(400, "text/plain", "Invalid Custom Note Request");
     }
 }
 
 void handleStatus() {
-    String json = "{\"note\": \"";
-    if (synth.lastPlayingKeyIndex != -1) {
-        int midi = synth.currentScale[synth.lastPlayingKeyIndex];
-        const char* noteName = NOTE_NAMES[midi % 12];
-        int octave = (midi / 12) - 1;
-        json += "K" + String(synth.lastPlayingKeyIndex + 1) + " (" + String(noteName) + String(octave) + ")";
+    char json[48];
+    formatStatus(json, sizeof(json));
+    server.send(200, "application/json", json);
+}
+
+// Parses a binary parameter frame (see ParamFrame.h) and stages it as one
+// atomic batch. Uses only stack memory.
+bool applyParamFrame(const uint8_t* frame, size_t length) {
+    ParamUpdate updates[MAX_PARAMS_PER_FRAME];
+    int count = parseParamFrame(frame, length, updates, MAX_PARAMS_PER_FRAME);
+    if (count < 0) return false;
+    return synth.applyParams(updates, count);
+}
+
+// HTTP fallback for the WebSocket: the same binary frame, hex-encoded in the body
+void handleParams() {
+    uint8_t frame[MAX_PARAM_FRAME_SIZE];
+    int length = decodeHexFrame(server.arg("plain").c_str(), frame, sizeof(frame));
+
+    if (length > 0 && applyParamFrame(frame, length)) {
+        server.send(200, "text/plain", "OK");
+    } else {
+        server.send(400, "text/plain", "Invalid Frame");
+    }
+}
+
+// --- TUNING ---
+
+// Description of the loaded tuning, JSON-safe
+char tuningDescription[TUNING_DESCRIPTION_LENGTH] = "12-TET";
+int tuningDegrees = 12;
+
+void handleTuning() {
+    char json[96];
+    snprintf(json, sizeof(json), "{\"description\": \"%s\", \"degrees\": %d}", tuningDescription, tuningDegrees);
+    server.send(200, "application/json", json);
+}
+
+// POST scl=<.scl text>[&kbm=<.kbm text>]. Parsed in place; the tables are
+// static so the 2 KB of scratch space does not come off the loop() stack.
+void handleSetTuning() {
+    static ScaleDefinition scale;
+    static KeyboardMapping mapping;
+    static double frequencies[NUM_MIDI_NOTES];
+
+    if (!parseScl(server.arg("scl").c_str(), scale)) {
+        server.send(400, "text/plain", "Invalid .scl File");
+        return;
+    }
+    if (server.hasArg("kbm") && server.arg("kbm").length() > 0) {
+        if (!parseKbm(server.arg("kbm").c_str(), mapping)) {
+            server.send(400, "text/plain", "Invalid .kbm File");
+            return;
+        }
+    } else {
+        defaultKeyboardMapping(mapping, scale.count);
+    }
+    if (!buildTuningTable(scale, mapping, frequencies)) {
+        server.send(400, "text/plain", "Reference Note Unmapped");
+        return;
+    }
+    if (!synth.setTuning(frequencies)) {
+        server.send(409, "text/plain", "Tuning Pending");
+        return;
+    }
+
+    for (int i = 0; ; i++) {
+        char c = scale.description[i];
+        tuningDescription[i] = (c == '"' || c == '\\' || (c > 0 && c < ' ')) ? ' ' : c;
+        if (c == '\0') break;
+    }
+    tuningDegrees = scale.count;
+    handleTuning();
+}
+
+void handleResetTuning() {
+    static ScaleDefinition scale;
+    static KeyboardMapping mapping;
+    static double frequencies[NUM_MIDI_NOTES];
+
+    defaultScale(scale);
+    defaultKeyboardMapping(mapping, scale.count);
+    buildTuningTable(scale, mapping, frequencies);
+    if (!synth.setTuning(frequencies)) {
+        server.send(409, "text/plain", "Tuning Pending");
+        return;
+    }
+
+    strcpy(tuningDescription, scale.description);
+    tuningDegrees = scale.count;
+    handleTuning();
+}
+
+// --- PRESETS ---
+
+// {"active": n, "presets": ["name", "", ...]} (empty string = unused slot)
+void handlePresets() {
+    char json[64 + NUM_PRESET_SLOTS * (PRESET_NAME_LENGTH + 4)];
+    int length = snprintf(json, sizeof(json), "{\"active\": %d, \"presets\": [", presetBank.getActiveSlot());
+
+    for (int slot = 0; slot < NUM_PRESET_SLOTS; slot++) {
+        length += snprintf(json + length, sizeof(json) - length, "%s\"%s\"", slot > 0 ? ", " : "",
+                           presetBank.isUsed(slot) ? presetBank.getName(slot) : "");
+    }
+    snprintf(json + length, sizeof(json) - length, "]}");
+    server.send(200, "application/json", json);
+}
+
+void handlePresetStore() {
+    int slot = server.arg("slot").toInt();
+    if (slot < 0 || slot >= NUM_PRESET_SLOTS) {
+        server.send(400, "text/plain", "Invalid Preset Slot");
+        return;
+    }
+
+    // Keep names JSON-safe: letters, digits, space, '-' and '_' only
+    // arg() returns a temporary: keep it alive while its characters are read
+    String nameArg = server.arg("name");
+    char name[PRESET_NAME_LENGTH];
+    const char* source = nameArg.c_str();
+    int length = 0;
+    for (; *source != '\0' && length < PRESET_NAME_LENGTH - 1; source++) {
+        if (isalnum((unsigned char)*source) || *source == ' ' || *source == '-' || *source == '_') {
+            name[length++] = *source;
+        }
+    }
+    name[length] = '\0';
+    if (length == 0) {
+        // Checked above; the narrow type bounds the width for the compiler too
+        snprintf(name, sizeof(name), "Preset %u", (unsigned)(uint8_t)(slot + 1));
+    }
+
+    if (presetBank.store(slot, name)) {
+        server.send(200, "text/plain", "OK");
+    } else {
+        server.send(400, "text/plain", "Invalid Preset Slot");
+    }
+}
+
+void handlePresetRecall() {
+    int slot = server.arg("slot").toInt();
+
+    if (!presetBank.isUsed(slot)) {
+        server.send(400, "text/plain", "Empty Preset Slot");
+    } else if (presetBank.recall(slot)) {
+        server.send(200, "text/plain", "OK");
+    } else {
+        server.send(409, "text/plain", "Recall Pending");
+    }
+}
+
+void handlePresetErase() {
+    if (presetBank.erase(server.arg("slot").toInt())) {
+        server.send(200, "text/plain", "OK");
+    } else {
+        server.send(400, "text/plain", "Empty Preset Slot");
+    }
+}
+
+// --- SAMPLES ---
+
+// {"samples": ["name", ...]} in bank order (the index is the "sample" parameter)
+void handleSamples() {
+    char json[32 + SAMPLE_BANK_MAX_SAMPLES * (SAMPLE_NAME_LENGTH + 4)];
+    int length = snprintf(json, sizeof(json), "{\"samples\": [");
+    for (int i = 0; i < synth.samples.getCount(); i++) {
+        // Names come from the bank image: keep the JSON well-formed whatever they hold
+        char name[SAMPLE_NAME_LENGTH];
+        const char* source = synth.samples.getInfo(i).name;
+        for (int c = 0; ; c++) {
+            name[c] = (source[c] == '"' || source[c] == '\\' || (source[c] > 0 && source[c] < ' ')) ? ' ' : source[c];
+            if (source[c] == '\0') break;
+        }
+        length += snprintf(json + length, sizeof(json) - length, "%s\"%s\"", i > 0 ? ", " : "", name);
+    }
+    snprintf(json + length, sizeof(json) - length, "]}");
+    server.send(200, "application/json", json);
+}
+
+// --- SCOPE ---
+
+// The audio core only captures while the scope is being polled
+unsigned long lastScopeRequest = 0;
+
+// GET /scope?mode=wave -> SCOPE_FFT_SIZE int16 samples (little-endian) at
+// 44100 / SCOPE_DECIMATION Hz; mode=fft -> SCOPE_FFT_BINS dB bytes
+void handleScope() {
+    static int16_t samples[SCOPE_FFT_SIZE];
+    static uint8_t bins[SCOPE_FFT_BINS];
+
+    lastScopeRequest = millis();
+    if (!synth.scope.isEnabled()) {
+        synth.scope.setEnabled(true);
+    }
+
+    if (!synth.scope.read(samples, SCOPE_FFT_SIZE)) {
+        // First request after idle: nothing captured yet
+        server.send(204, "text/plain", "");
+        return;
+    }
+
+    if (server.arg("mode") == "fft") {
+        scopeSpectrum(samples, bins);
+        server.send_P(200, "application/octet-stream", (const char*)bins, sizeof(bins));
     } else {
-        json += "None";
+        server.send_P(200, "application/octet-stream", (const char*)samples, sizeof(samples));
+    }
+}
+
+void updateScopeIdle() {
+    if (synth.scope.isEnabled() && millis() - lastScopeRequest > SCOPE_IDLE_TIMEOUT_MS) {
+        synth.scope.setEnabled(false);
+    }
+}
+
+// Worst-case input timing since the last read (also reset by the serial report)
+void handleTiming() {
+    // Sized for every field at its widest (20-digit %lu on a 64-bit host build)
+    char json[512];
+    snprintf(json, sizeof(json),
+             "{\"scan_interval_max_us\": %lu, \"event_latency_max_us\": %lu, "
+             "\"osc_packets\": %lu, \"osc_rejected\": %lu, \"osc_late\": %lu, \"preset_apply_us\": %lu, "
+             "\"scope_capture_max_cycles\": %lu, \"scope_cycle_budget\": %d, "
+             "\"audio_load_permille\": %lu, \"audio_wake_max_us\": %lu, \"audio_idle_entries\": %lu}",
+             synthControl.takeMaxScanInterval(), (unsigned long)synth.takeMaxEventLatency(),
+             (unsigned long)oscServer.packetsReceived, (unsigned long)oscServer.packetsRejected,
+             (unsigned long)oscServer.lateMessages, (unsigned long)synth.presetApplyUs,
+             (unsigned long)synth.scope.takeMaxCaptureCycles(), SCOPE_CYCLE_BUDGET,
+             (unsigned long)synth.takeAudioLoad(), (unsigned long)synth.takeMaxWakeLatency(),
+             (unsigned long)synth.idleEntries);
+    server.send(200, "application/json", json);
+}
+
+// --- FOOTPRINT ---
+
+void handleFootprint() {
+    char json[512];
+    if (footprint.format(json, sizeof(json)) < 0) {
+        server.send(500, "text/plain", "Report Too Large");
+        return;
+    }
+    server.send(200, "application/json", json);
+}
+
+// --- EVENT LOG ---
+
+#define EVENT_LOG_STOP_TIMEOUT_MS 100
+
+void handleEventLog() {
+    char json[512];
+    if (eventLog.format(json, sizeof(json)) < 0) {
+        server.send(500, "text/plain", "Report Too Large");
+        return;
     }
-    json += "\"}";
     server.send(200, "application/json", json);
 }
 
+// Leaves the engine as it is: the first segment starts with a snapshot of it
+void handleEventLogRecord() {
+    if (eventLog.startRecording()) {
+        handleEventLog();
+    } else {
+        server.send(409, "text/plain", "Event Log Busy");
+    }
+}
+
+void handleEventLogStop() {
+    if (eventLog.stop(EVENT_LOG_STOP_TIMEOUT_MS)) {
+        handleEventLog();
+    } else {
+        server.send(503, "text/plain", "Audio Core Not Responding");
+    }
+}
+
+// Header, segments with their snapshots and the entry ring as one binary blob
+// (layout in EventLog.h)
+void handleEventLogDownload() {
+    if (!eventLog.isIdle()) {
+        server.send(409, "text/plain", "Event Log Busy");
+        return;
+    }
+    size_t length = eventLog.size();
+    if (length == 0) {
+        server.send(404, "text/plain", "No Event Log");
+        return;
+    }
+    server.sendHeader("Content-Disposition", "attachment; filename=eventlog.bin");
+    server.send_P(200, "application/octet-stream", (const char*)&eventLog.data, length);
+}
+
+// Multipart file upload, streamed straight into the log buffer
+bool eventLogUploadOk = false;
+
+void handleEventLogUpload() {
+    HTTPUpload& upload = server.upload();
+
+    switch (upload.status) {
+        case UPLOAD_FILE_START:
+            eventLogUploadOk = eventLog.beginUpload();
+            break;
+        case UPLOAD_FILE_WRITE:
+            eventLogUploadOk = eventLogUploadOk && eventLog.writeUpload(upload.buf, upload.currentSize);
+            break;
+        case UPLOAD_FILE_END:
+            eventLogUploadOk = eventLogUploadOk && eventLog.endUpload();
+            break;
+        default:
+            eventLogUploadOk = false;
+            break;
+    }
+}
+
+void handleEventLogUploaded() {
+    if (eventLogUploadOk) {
+        handleEventLog();
+    } else {
+        server.send(400, "text/plain", "Invalid Event Log");
+    }
+}
+
+// Plays the log through the engine in real time; live input waits until it ends
+void handleEventLogReplay() {
+    if (!eventLog.isIdle()) {
+        server.send(409, "text/plain", "Event Log Busy");
+    } else if (eventLog.startReplay()) {
+        handleEventLog();
+    } else {
+        server.send(400, "text/plain", "Invalid Event Log");
+    }
+}
+
+// Render time of each replayed block in us (uint16, little-endian), in block order
+void handleEventLogTimings() {
+    if (!eventLog.isIdle()) {
+        server.send(409, "text/plain", "Event Log Busy");
+        return;
+    }
+    uint32_t blocks = min(eventLog.replayBlocks, (uint32_t)EVENT_LOG_TIMING_BLOCKS);
+    server.send_P(200, "application/octet-stream", (const char*)eventLog.blockMicros, blocks * sizeof(uint16_t));
+}
+
+// Route wrapper: counts heap blocks each handler leaves behind
+template <void (*Handler)()>
+void tracked() {
+    footprint.beginHandler();
+    Handler();
+    footprint.endHandler();
+}
+
+// --- WEBSOCKET ---
+
+void onWebSocketEvent(uint8_t client, WStype_t type, uint8_t* payload, size_t length) {
+    switch (type) {
+        case WStype_CONNECTED: {
+            // Bring the new client up to date immediately
+            char json[48];
+            formatStatus(json, sizeof(json));
+            webSocket.sendTXT(client, json);
+            break;
+        }
+        case WStype_BIN:
+            if (!applyParamFrame(payload, length)) {
+                webSocket.sendTXT(client, "{\"error\": \"Invalid Frame\"}");
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+// Push only when the reported note changes
+void pushStatusIfChanged() {
+    if (synth.lastPlayingNote == lastPushedNote && synth.lastPlayingKeyIndex == lastPushedKeyIndex) return;
+
+    lastPushedNote = synth.lastPlayingNote;
+    lastPushedKeyIndex = synth.lastPlayingKeyIndex;
+
+    char json[48];
+    formatStatus(json, sizeof(json));
+    webSocket.broadcastTXT(json);
+}
+
 // --- SETUP & LOOP ---
 
 void uiSetup() {
@@ -149,20 +627,52 @@ void uiSetup() {
     Serial.printf("Hotspot: %s\n", ssid);
     Serial.printf("IP: %s\n", WiFi.softAPIP().toString().c_str());
 
-    server.on("/", handleRoot);
-    server.on("/setosc", HTTP_GET, handleSetOsc);
-    server.on("/setgain", HTTP_GET, handleSetGain);
-    server.on("/setscale", HTTP_GET, handleSetScale);
-    server.on("/setadsr", HTTP_GET, handleSetADSR); 
-    server.on("/status", HTTP_GET, handleStatus);
-    server.on("/setcustom", HTTP_POST, handleSetCustomNote); 
+    // Request headers the WebServer should keep for the handlers
+    static const char* collectedHeaders[] = { "If-None-Match" };
+    server.collectHeaders(collectedHeaders, 1);
+
+    server.on("/", tracked<handleRoot>);
+    server.on("/setosc", HTTP_GET, tracked<handleSetOsc>);
+    server.on("/setgain", HTTP_GET, tracked<handleSetGain>);
+    server.on("/setscale", HTTP_GET, tracked<handleSetScale>);
+    server.on("/setadsr", HTTP_GET, tracked<handleSetADSR>); 
+    server.on("/setunison", HTTP_GET, tracked<handleSetUnison>);
+    server.on("/setfm", HTTP_GET, tracked<handleSetFM>);
+    server.on("/setlfo", HTTP_GET, tracked<handleSetLFO>);
+    server.on("/setmod", HTTP_GET, tracked<handleSetMod>);
+    server.on("/status", HTTP_GET, tracked<handleStatus>);
+    server.on("/timing", HTTP_GET, tracked<handleTiming>);
+    server.on("/setcustom", HTTP_POST, tracked<handleSetCustomNote>); 
+    server.on("/params", HTTP_POST, tracked<handleParams>);
+    server.on("/tuning", HTTP_GET, tracked<handleTuning>);
+    server.on("/tuning", HTTP_POST, tracked<handleSetTuning>);
+    server.on("/tuning/reset", HTTP_GET, tracked<handleResetTuning>);
+    server.on("/presets", HTTP_GET, tracked<handlePresets>);
+    server.on("/preset/store", HTTP_GET, tracked<handlePresetStore>);
+    server.on("/preset/recall", HTTP_GET, tracked<handlePresetRecall>);
+    server.on("/preset/erase", HTTP_GET, tracked<handlePresetErase>);
+    server.on("/samples", HTTP_GET, tracked<handleSamples>);
+    server.on("/scope", HTTP_GET, tracked<handleScope>);
+    server.on("/footprint", HTTP_GET, tracked<handleFootprint>);
+    server.on("/eventlog", HTTP_GET, tracked<handleEventLog>);
+    server.on("/eventlog/record", HTTP_GET, tracked<handleEventLogRecord>);
+    server.on("/eventlog/stop", HTTP_GET, tracked<handleEventLogStop>);
+    server.on("/eventlog/download", HTTP_GET, tracked<handleEventLogDownload>);
+    server.on("/eventlog/upload", HTTP_POST, tracked<handleEventLogUploaded>, handleEventLogUpload);
+    server.on("/eventlog/replay", HTTP_GET, tracked<handleEventLogReplay>);
+    server.on("/eventlog/timings", HTTP_GET, tracked<handleEventLogTimings>);
 
     server.begin();
-    Serial.println("Web Server running.");
+    webSocket.begin();
+    webSocket.onEvent(onWebSocketEvent);
+    Serial.printf("Web Server running (WebSocket on port %d).\n", WS_PORT);
 }
 
 void uiLoop() {
     server.handleClient();
+    webSocket.loop();
+    pushStatusIfChanged();
+    updateScopeIdle();
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,54 @@
+#!/usr/bin/env python3
+"""Compress the Web UI for flash.
+
+Reads the INDEX_HTML raw literal from HTML_Content.h, gzips it and writes
+HTML_Content_gz.h with the compressed bytes, their length and an ETag derived
+from the content. Re-run after every edit to HTML_Content.h:
+
+    python3 tools/build_html.py
+"""
+
+import gzip
+import hashlib
+import os
+import re
+
+SKETCH_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SOURCE = os.path.join(SKETCH_DIR, "HTML_Content.h")
+OUTPUT = os.path.join(SKETCH_DIR, "HTML_Content_gz.h")
+
+
+def main():
+    with open(SOURCE, encoding="utf-8") as f:
+        text = f.read()
+
+    match = re.search(r'R"rawliteral\((.*)\)rawliteral"', text, re.S)
+    if not match:
+        raise SystemExit("INDEX_HTML raw literal not found in HTML_Content.h")
+    html = match.group(1).encode("utf-8")
+
+    # mtime=0 keeps the output (and so the ETag) identical for identical input
+    packed = gzip.compress(html, compresslevel=9, mtime=0)
+    etag = hashlib.sha1(html).hexdigest()[:16]
+
+    lines = []
+    for i in range(0, len(packed), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in packed[i:i + 16]) + ",")
+
+    with open(OUTPUT, "w", encoding="utf-8", newline="\n") as f:
+        f.write("// HTML_content_gz.h\n")
+        f.write("// GENERATED by tools/build_html.py from HTML_Content.h -- do not edit.\n\n")
+        f.write("#ifndef HTML_CONTENT_GZ_H\n#define HTML_CONTENT_GZ_H\n\n")
+        f.write("#include <Arduino.h>\n\n")
+        f.write("// %d bytes of HTML compressed to %d bytes\n" % (len(html), len(packed)))
+        f.write("const size_t INDEX_HTML_GZ_LEN = %d;\n" % len(packed))
+        f.write('const char INDEX_HTML_ETAG[] = "\\"%s\\"";\n\n' % etag)
+        f.write("const uint8_t INDEX_HTML_GZ[] PROGMEM = {\n")
+        f.write("\n".join(lines))
+        f.write("\n};\n\n#endif\n")
+
+    print("HTML_Content_gz.h: %d -> %d bytes, ETag %s" % (len(html), len(packed), etag))
+
+
+if __name__ == "__main__":
+    main()
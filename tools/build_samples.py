@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""Build the PCM sample bank image for the "samples" flash partition.
+
+Each argument is a WAV file (8/16-bit PCM, mono or stereo; stereo is mixed
+down) with an optional MIDI root note and loop points in frames:
+
+    python3 tools/build_samples.py -o samples.bin kick.wav:36 pad.wav:60:2000:48000
+
+Flash the image into the partition (partitions.csv) with ESP-IDF's parttool:
+
+    parttool.py write_partition --partition-name samples --input samples.bin
+
+The layout matches SampleBank.h. On a host the same file can be mmap()ed and
+passed to SampleBank::attach().
+"""
+
+import argparse
+import array
+import os
+import struct
+import sys
+import wave
+
+MAGIC = 0x4C504D53          # "SMPL"
+VERSION = 1
+MAX_SAMPLES = 32
+NAME_LENGTH = 16
+PARTITION_SIZE = 0x160000   # samples partition in partitions.csv
+HEADER = struct.Struct("<IHH")
+INFO = struct.Struct("<%dsIIIIIB3x" % NAME_LENGTH)
+
+
+def read_wav(path):
+    with wave.open(path, "rb") as f:
+        channels, width, rate = f.getnchannels(), f.getsampwidth(), f.getframerate()
+        raw = f.readframes(f.getnframes())
+
+    if width == 1:
+        samples = array.array("h", ((b - 128) << 8 for b in raw))
+    elif width == 2:
+        samples = array.array("h")
+        samples.frombytes(raw)
+        if sys.byteorder != "little":
+            samples.byteswap()
+    else:
+        raise SystemExit("%s: only 8- and 16-bit PCM is supported" % path)
+
+    if channels > 1:
+        samples = array.array("h", (sum(samples[i:i + channels]) // channels
+                                    for i in range(0, len(samples), channels)))
+    return samples, rate
+
+
+def parse_spec(spec):
+    parts = spec.split(":")
+    path = parts[0]
+    root = int(parts[1]) if len(parts) > 1 else 60
+    loop = (int(parts[2]), int(parts[3])) if len(parts) > 3 else (0, 0)
+    return path, root, loop
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build the synth's sample bank image.")
+    parser.add_argument("-o", "--output", default="samples.bin")
+    parser.add_argument("samples", nargs="+", metavar="file.wav[:root[:loop_start:loop_end]]")
+    args = parser.parse_args()
+
+    if len(args.samples) > MAX_SAMPLES:
+        raise SystemExit("at most %d samples fit the bank" % MAX_SAMPLES)
+
+    offset = HEADER.size + INFO.size * len(args.samples)
+    infos, blobs = [], []
+    for spec in args.samples:
+        path, root, (loop_start, loop_end) = parse_spec(spec)
+        samples, rate = read_wav(path)
+        if not 0 <= root <= 127:
+            raise SystemExit("%s: root note must be 0-127" % path)
+        if loop_end and not 0 <= loop_start < loop_end <= len(samples):
+            raise SystemExit("%s: loop must satisfy 0 <= start < end <= %d" % (path, len(samples)))
+
+        offset = (offset + 3) & ~3
+        name = os.path.splitext(os.path.basename(path))[0].encode("ascii", "replace")[:NAME_LENGTH - 1]
+        infos.append(INFO.pack(name, offset, len(samples), loop_start, loop_end, rate, root))
+        blobs.append((offset, samples.tobytes() if sys.byteorder == "little" else _swapped(samples)))
+        offset += len(samples) * 2
+
+    if offset > PARTITION_SIZE:
+        raise SystemExit("bank is %d bytes, the partition holds %d" % (offset, PARTITION_SIZE))
+
+    image = bytearray(offset)
+    image[0:HEADER.size] = HEADER.pack(MAGIC, VERSION, len(infos))
+    for i, info in enumerate(infos):
+        start = HEADER.size + i * INFO.size
+        image[start:start + INFO.size] = info
+    for start, data in blobs:
+        image[start:start + len(data)] = data
+
+    with open(args.output, "wb") as f:
+        f.write(image)
+    print("%s: %d samples, %d bytes (%d%% of the partition)"
+          % (args.output, len(infos), len(image), len(image) * 100 // PARTITION_SIZE))
+
+
+def _swapped(samples):
+    copy = array.array("h", samples)
+    copy.byteswap()
+    return copy.tobytes()
+
+
+if __name__ == "__main__":
+    main()
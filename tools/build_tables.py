@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+"""Generate the synth's constant lookup tables.
+
+Reads the table constants from Tables.h and writes Tables.cpp with the sine,
+exp2 and 12-TET note increment tables as const arrays, so they are built at
+compile time and stay in flash. Re-run after changing a constant in Tables.h:
+
+    python3 tools/build_tables.py
+
+Values match the runtime formulas they replace bit for bit (same double
+arithmetic, same truncation).
+"""
+
+import math
+import os
+import re
+
+SKETCH_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SOURCE = os.path.join(SKETCH_DIR, "Tables.h")
+OUTPUT = os.path.join(SKETCH_DIR, "Tables.cpp")
+
+
+def define(text, name):
+    match = re.search(r"#define %s (\d+)" % name, text)
+    if not match:
+        raise SystemExit("%s not found in Tables.h" % name)
+    return int(match.group(1))
+
+
+def c_array(decl, values, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    return "%s = {\n%s\n};\n" % (decl, "\n".join(lines))
+
+
+def main():
+    with open(SOURCE, encoding="utf-8") as f:
+        text = f.read()
+
+    sine_size = 1 << define(text, "SINE_TABLE_BITS")
+    exp2_size = define(text, "EXP2_TABLE_SIZE")
+    sample_rate = define(text, "TABLE_SAMPLE_RATE")
+    notes = define(text, "TABLE_MIDI_NOTES")
+
+    # int() truncates toward zero, like the C casts these tables replace
+    sine = [int(math.sin(i * 2.0 * math.pi / sine_size) * 32767) for i in range(sine_size)]
+    exp2 = [int(math.pow(2.0, i / 32.0) * 65536.0 + 0.5) for i in range(exp2_size)]
+    increments = []
+    for n in range(notes):
+        freq = 440.0 * math.pow(2.0, (n - 69.0) / 12.0)
+        increments.append(int(freq * 4294967296.0 / sample_rate) if freq < sample_rate / 2.0 else 0)
+
+    with open(OUTPUT, "w", encoding="utf-8", newline="\n") as f:
+        f.write("// tables.cpp\n")
+        f.write("// GENERATED by tools/build_tables.py from Tables.h -- do not edit.\n\n")
+        f.write('#include "Tables.h"\n\n')
+        f.write(c_array("const int16_t SINE_TABLE[SINE_TABLE_SIZE]", sine, 16) + "\n")
+        f.write(c_array("const uint32_t EXP2_TABLE[EXP2_TABLE_SIZE]", ["%uu" % v for v in exp2], 8) + "\n")
+        f.write(c_array("const uint32_t NOTE_INCREMENT_12TET[TABLE_MIDI_NOTES]", ["%uu" % v for v in increments], 8))
+
+    print("Tables.cpp: sine %d, exp2 %d, note increments %d at %d Hz" % (sine_size, exp2_size, notes, sample_rate))
+
+
+if __name__ == "__main__":
+    main()
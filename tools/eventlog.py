@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""Print an event log downloaded from /eventlog/download, or the replay
+block timings from /eventlog/timings:
+
+    python3 tools/eventlog.py eventlog.bin
+    python3 tools/eventlog.py --timings timings.bin
+
+The layout matches EventLog.h (EventLogData, little-endian, ESP32 alignment).
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+MAGIC = 0x474F4C45          # "ELOG"
+VERSION = 2
+CAPACITY = 2048             # EVENT_LOG_CAPACITY
+SEGMENTS = 4                # EVENT_LOG_SEGMENTS
+SAMPLE_RATE = 44100
+HEADER = struct.Struct("<IHHIBBHIIII")
+SEGMENT = struct.Struct("<IIIIII")      # EventLogSegment, up to its snapshot
+ENTRY = struct.Struct("<IBBBBBbhf")
+SEGMENTS_OFFSET = 32        # sizeof(EventLogHeader)
+
+LOG_WRAPPED = 0x01
+LOG_TRUNCATED = 0x02
+SEGMENT_RECALL = 0x01
+SEGMENT_RETUNE = 0x02
+
+EVENT_TYPES = ["note_on", "note_off", "bend", "cc", "param"]
+FLAG_SCHEDULED = 0x01
+FLAG_BATCH_END = 0x02
+
+
+def param_names():
+    # Same table the firmware uses, so ids print as names
+    path = os.path.join(os.path.dirname(__file__), "..", "ParamFrame.cpp")
+    try:
+        with open(path) as f:
+            return re.findall(r'\{\s*"(\w+)",', f.read())
+    except OSError:
+        return []
+
+
+def describe(entry, names):
+    sample, kind, flags, kind_type, note, value, key, bend, param = entry
+    name = lambda i: names[i] if i < len(names) else "param %d" % i
+
+    if kind == 0:
+        event = EVENT_TYPES[kind_type] if kind_type < len(EVENT_TYPES) else "type %d" % kind_type
+        if event == "note_on":
+            text = "note_on %d velocity %d" % (note, value) + (" key K%d" % (key + 1) if key >= 0 else "")
+        elif event == "note_off":
+            text = "note_off %d" % note
+        elif event == "bend":
+            text = "bend %d" % bend
+        elif event == "cc":
+            text = "cc %d = %d" % (note, value)
+        else:
+            text = "param %s = %g" % (name(note), param)
+        return text + (" (scheduled)" if flags & FLAG_SCHEDULED else "")
+    if kind == 1:
+        return "batch %s = %g" % (name(note), param) + (" (end)" if flags & FLAG_BATCH_END else "")
+    return "unknown kind %d" % kind
+
+
+def print_log(data):
+    if len(data) < HEADER.size:
+        sys.exit("error: file too short")
+    (magic, version, entry_size, segment_size, segment_count, first_segment, _,
+     entry_count, block_count, flags, _) = HEADER.unpack_from(data)
+    if magic != MAGIC or version != VERSION or entry_size != ENTRY.size:
+        sys.exit("error: not an event log (or from another firmware version)")
+    if segment_count < 1 or segment_count > SEGMENTS or first_segment >= SEGMENTS:
+        sys.exit("error: corrupt header")
+
+    # Both the segments and the entries are rings, printed oldest first
+    entries_offset = SEGMENTS_OFFSET + SEGMENTS * segment_size
+    if len(data) < entries_offset + CAPACITY * ENTRY.size:
+        sys.exit("error: file truncated")
+    segments = [SEGMENT.unpack_from(data, SEGMENTS_OFFSET + ((first_segment + k) % SEGMENTS) * segment_size)
+                for k in range(segment_count)]
+
+    print("%d entries, %d blocks (%.2f s) in %d segment(s), starting at sample %d%s%s"
+          % (entry_count, block_count, block_count * 64 / SAMPLE_RATE, segment_count, segments[0][0],
+             ", WRAPPED" if flags & LOG_WRAPPED else "", ", TRUNCATED" if flags & LOG_TRUNCATED else ""))
+
+    names = param_names()
+    for k, (sample, first_entry, count, blocks, crc, segment_flags) in enumerate(segments):
+        changes = [text for bit, text in ((SEGMENT_RECALL, "preset recall"), (SEGMENT_RETUNE, "tuning change"))
+                   if segment_flags & bit]
+        print("-- segment %d at %.3f ms: %d entries, %d blocks, output CRC %08x%s"
+              % (k, sample * 1000.0 / SAMPLE_RATE, count, blocks, crc,
+                 " (snapshot after %s)" % " and ".join(changes) if changes else ""))
+        for i in range(count):
+            entry = ENTRY.unpack_from(data, entries_offset + ((first_entry + i) % CAPACITY) * ENTRY.size)
+            print("%10.3f ms  %8d  %s" % (entry[0] * 1000.0 / SAMPLE_RATE, entry[0], describe(entry, names)))
+
+
+def print_timings(data):
+    times = struct.unpack("<%dH" % (len(data) // 2), data[:len(data) // 2 * 2])
+    if not times:
+        sys.exit("error: no replayed blocks")
+
+    budget = 64 * 1000000 / SAMPLE_RATE
+    print("%d blocks, max %d us, mean %.1f us (one block plays in %.0f us)"
+          % (len(times), max(times), sum(times) / len(times), budget))
+    for block, us in sorted(enumerate(times), key=lambda t: -t[1])[:10]:
+        print("  block %6d at %8.3f ms: %5d us" % (block, block * 64 * 1000.0 / SAMPLE_RATE, us))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Print a synth event log or replay timings.")
+    parser.add_argument("file")
+    parser.add_argument("--timings", action="store_true", help="file is /eventlog/timings output")
+    args = parser.parse_args()
+
+    with open(args.file, "rb") as f:
+        data = f.read()
+    if args.timings:
+        print_timings(data)
+    else:
+        print_log(data)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,125 @@
+// hostarduino.cpp
+
+// Host implementations of the stubs in tools/host/stubs
+#include <Arduino.h>
+#include "driver/i2s.h"
+#include "driver/dac.h"
+#include "esp_partition.h"
+#include <esp_heap_caps.h>
+#include <WiFi.h>
+#include <stdarg.h>
+#include <sys/ioctl.h>
+#include <time.h>
+#include <unistd.h>
+
+HardwareSerial Serial;
+HardwareSerial Serial1;
+HardwareSerial Serial2;
+EspClass ESP;
+WiFiClass WiFi;
+
+// -------------------------------------------------------------------
+// --- TIME ---
+// -------------------------------------------------------------------
+
+static uint64_t monotonicMicros() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+// Counts from program start like the ESP32's, and wraps the same way
+static const uint64_t startMicros = monotonicMicros();
+
+unsigned long micros() { return (uint32_t)(monotonicMicros() - startMicros); }
+unsigned long millis() { return (uint32_t)((monotonicMicros() - startMicros) / 1000); }
+void delay(unsigned long ms) { usleep(ms * 1000); }
+void delayMicroseconds(unsigned int us) { usleep(us); }
+
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+int digitalRead(uint8_t) { return HIGH; }
+
+// -------------------------------------------------------------------
+// --- SERIAL ---
+// -------------------------------------------------------------------
+
+void HardwareSerial::begin(unsigned long, uint32_t, int8_t, int8_t) {}
+
+int HardwareSerial::available() {
+    int pending = 0;
+    if (fd < 0 || ioctl(fd, FIONREAD, &pending) != 0) return 0;
+    return pending;
+}
+
+int HardwareSerial::read() {
+    uint8_t byte;
+    if (fd < 0 || ::read(fd, &byte, 1) != 1) return -1;
+    return byte;
+}
+
+size_t HardwareSerial::write(uint8_t byte) { return fwrite(&byte, 1, 1, stdout); }
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) { return fwrite(buffer, 1, size, stdout); }
+
+int HardwareSerial::printf(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int written = vprintf(format, args);
+    va_end(args);
+    return written;
+}
+
+size_t HardwareSerial::print(const char* text) { return fputs(text, stdout) >= 0 ? strlen(text) : 0; }
+size_t HardwareSerial::println(const char* text) { return print(text) + print("\n"); }
+
+// -------------------------------------------------------------------
+// --- ESP / FREERTOS ---
+// -------------------------------------------------------------------
+
+uint32_t EspClass::getCycleCount() { return (uint32_t)(monotonicMicros() * 240); }
+uint32_t EspClass::getHeapSize() { return 320 * 1024; }
+uint32_t EspClass::getFreeHeap() { return 200 * 1024; }
+uint32_t EspClass::getMinFreeHeap() { return 200 * 1024; }
+uint32_t EspClass::getMaxAllocHeap() { return 110 * 1024; }
+
+#define HOST_HEAP_FREE (200 * 1024)
+
+void heap_caps_get_info(multi_heap_info_t* info, uint32_t) {
+    memset(info, 0, sizeof(*info));
+    info->total_free_bytes = HOST_HEAP_FREE;
+    info->largest_free_block = HOST_HEAP_FREE;
+    info->minimum_free_bytes = HOST_HEAP_FREE;
+}
+
+size_t heap_caps_get_free_size(uint32_t) { return HOST_HEAP_FREE; }
+size_t heap_caps_get_minimum_free_size(uint32_t) { return HOST_HEAP_FREE; }
+size_t heap_caps_get_largest_free_block(uint32_t) { return HOST_HEAP_FREE; }
+
+void vTaskDelay(TickType_t ticks) { usleep(ticks * 1000); }
+TaskHandle_t xTaskGetCurrentTaskHandle() { return NULL; }
+BaseType_t xTaskNotifyGive(TaskHandle_t) { return pdPASS; }
+uint32_t ulTaskNotifyTake(BaseType_t, TickType_t) { return 1; }
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) { return 0; }
+
+// -------------------------------------------------------------------
+// --- AUDIO OUTPUT / FLASH ---
+// -------------------------------------------------------------------
+
+esp_err_t i2s_driver_install(i2s_port_t, const i2s_config_t*, int, void*) { return ESP_OK; }
+esp_err_t i2s_set_pin(i2s_port_t, const i2s_pin_config_t*) { return ESP_OK; }
+
+esp_err_t i2s_write(i2s_port_t, const void*, size_t size, size_t* written, TickType_t) {
+    if (written != NULL) *written = size;
+    return ESP_OK;
+}
+
+esp_err_t dac_output_enable(dac_channel_t) { return ESP_OK; }
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t, esp_partition_subtype_t, const char*) { return NULL; }
+
+esp_err_t esp_partition_mmap(const esp_partition_t*, size_t, size_t, esp_partition_mmap_memory_t, const void**,
+                             spi_flash_mmap_handle_t*) {
+    return ESP_FAIL;
+}
+
+void spi_flash_munmap(spi_flash_mmap_handle_t) {}
@@ -0,0 +1,25 @@
+// hostcheck.h
+
+#ifndef HOST_CHECK_H
+#define HOST_CHECK_H
+
+// Minimal assertions for the host checks: every failure is printed, and
+// main() returns checkResult() so make stops on the first failing program
+#include <stdio.h>
+
+static int checkFailures = 0;
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+            checkFailures++; \
+        } \
+    } while (0)
+
+static inline int checkResult(const char* name) {
+    printf("%s: %s\n", name, checkFailures == 0 ? "ok" : "FAILED");
+    return checkFailures == 0 ? 0 : 1;
+}
+
+#endif
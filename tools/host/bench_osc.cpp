@@ -0,0 +1,120 @@
+// bench_osc.cpp
+
+// Oscillator throughput on the host, before and after the unison kernel:
+//   before: Oscillator::getNextSample(), the per-sample double oscillator
+//           every voice ran (twice) before unison mode
+//   after:  UnisonOscillator::renderBlock(), 1 to MAX_UNISON copies per call
+// plus the whole engine rendering 16 voices at each unison count. Reported as
+// oscillator-samples per second and as oscillators that would keep up in real
+// time at 44.1 kHz. Host numbers only rank the kernels; the ESP32 is roughly
+// 20-50x slower per sample.
+//
+//     make -C tools/host bench
+
+#include <Arduino.h>
+#include "Synth.h"
+#include "EventLog.h"
+
+// Defined by ESP32_Synth.ino on the device
+EventLog eventLog;
+
+#define BENCH_BLOCKS 20000
+static const WaveType WAVES[] = { SINE, SQUARE, SAW, TRIANGLE };
+
+static volatile int32_t sink; // keeps the rendered samples alive
+
+static double seconds() {
+    return micros() / 1000000.0;
+}
+
+static void report(const char* label, double oscSamples, double elapsed) {
+    double perSecond = oscSamples / elapsed;
+    printf("  %-30s %8.1f M osc-samples/s  %7.0f real-time oscillators\n", label, perSecond / 1e6,
+           perSecond / I2S_SAMPLE_RATE);
+}
+
+static void benchBefore(WaveType wave) {
+    Oscillator osc[MAX_UNISON];
+    for (int k = 0; k < MAX_UNISON; k++) {
+        osc[k].setWaveform(wave);
+        osc[k].setFrequency(220.0 + k);
+    }
+
+    int32_t acc = 0;
+    double start = seconds();
+    for (int b = 0; b < BENCH_BLOCKS; b++) {
+        for (int i = 0; i < DMA_BUF_LEN; i++) {
+            for (int k = 0; k < MAX_UNISON; k++) acc += osc[k].getNextSample();
+        }
+    }
+    double elapsed = seconds() - start;
+    sink = acc;
+
+    char label[48];
+    snprintf(label, sizeof(label), "before  %-8s x%d", WAVE_NAMES[wave], MAX_UNISON);
+    report(label, (double)BENCH_BLOCKS * DMA_BUF_LEN * MAX_UNISON, elapsed);
+}
+
+static void benchAfter(WaveType wave, int count, bool fm) {
+    UnisonOscillator osc;
+    osc.setWaveform(wave);
+    osc.setup(NOTE_INCREMENT_12TET[57], UnisonOscillator::computeCoefficients(count, 20.0, 0.5));
+
+    int32_t phaseMod[DMA_BUF_LEN];
+    for (int i = 0; i < DMA_BUF_LEN; i++) phaseMod[i] = i * 0x01000000;
+
+    int32_t outL[DMA_BUF_LEN], outR[DMA_BUF_LEN];
+    int32_t acc = 0;
+    double start = seconds();
+    for (int b = 0; b < BENCH_BLOCKS; b++) {
+        memset(outL, 0, sizeof(outL));
+        memset(outR, 0, sizeof(outR));
+        osc.renderBlock(outL, outR, DMA_BUF_LEN, fm ? phaseMod : NULL);
+        acc += outL[b % DMA_BUF_LEN] + outR[0];
+    }
+    double elapsed = seconds() - start;
+    sink = acc;
+
+    char label[48];
+    snprintf(label, sizeof(label), "after   %-8s x%d%s", WAVE_NAMES[wave], count, fm ? " FM" : "");
+    report(label, (double)BENCH_BLOCKS * DMA_BUF_LEN * count, elapsed);
+}
+
+// 16 held notes through Synth::renderNextBlock(): envelopes, mixing and DAC
+// conversion included
+static void benchEngine(int count) {
+    synth.setUnison(count, 20.0, 0.5);
+    for (int n = 0; n < NUM_VOICES; n++) synth.noteOn(48 + n, 100, micros());
+    synth.renderNextBlock();
+
+    const int blocks = BENCH_BLOCKS / 4;
+    double start = seconds();
+    for (int b = 0; b < blocks; b++) synth.renderNextBlock();
+    double elapsed = seconds() - start;
+
+    for (int n = 0; n < NUM_VOICES; n++) synth.noteOff(48 + n, micros());
+    synth.controlChange(120, 0, micros());
+    while (synth.renderNextBlock() > 0) {}
+
+    char label[48];
+    snprintf(label, sizeof(label), "engine  16 voices x%d", count);
+    report(label, (double)blocks * DMA_BUF_LEN * NUM_VOICES * count, elapsed);
+    printf("  %-30s %8.2f us per %d-sample block (%.0f us of audio)\n", "", elapsed * 1e6 / blocks, DMA_BUF_LEN,
+           DMA_BUF_LEN * 1e6 / I2S_SAMPLE_RATE);
+}
+
+int main() {
+    synth.begin();
+    synth.setADSR(0.001, 0.1, 1.0, 0.001);
+
+    printf("\nOscillator throughput (%d blocks of %d samples)\n", BENCH_BLOCKS, DMA_BUF_LEN);
+    for (WaveType wave : WAVES) {
+        benchBefore(wave);
+        for (int count = 1; count <= MAX_UNISON; count *= 2) benchAfter(wave, count, false);
+        benchAfter(wave, MAX_UNISON, true);
+    }
+
+    printf("\nEngine\n");
+    for (int count = 1; count <= MAX_UNISON; count *= 2) benchEngine(count);
+    return 0;
+}
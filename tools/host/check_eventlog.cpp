@@ -0,0 +1,270 @@
+// check_eventlog.cpp
+
+// Event log record and replay, through the engine:
+//   1. Starting a recording changes nothing: a note already sounding keeps
+//      sounding and the sample clock runs on
+//   2. A long performance (notes, timed notes, controllers, parameter batches,
+//      the arpeggiator, a preset recall and a retune) wraps the ring: the log
+//      keeps its most recent segments, each starting at a snapshot
+//   3. Replay from the oldest snapshot renders every retained segment
+//      bit-identical, whatever the engine was doing before the replay
+//   4. Download -> upload round trip; truncated or inconsistent uploads are
+//      refused. The log is left in build/ for eventlog_replay.
+//
+//     make -C tools/host check
+
+#include <Arduino.h>
+#include "Synth.h"
+#include "EventLog.h"
+#include "HostCheck.h"
+#include <math.h>
+
+// Defined by ESP32_Synth.ino on the device
+EventLog eventLog;
+
+#define PERFORMANCE_BLOCKS 9000
+#define RECALL_BLOCK 7600
+#define RETUNE_BLOCK 8200
+#define ARP_START_BLOCK 7000
+#define ARP_STOP_BLOCK 8600
+#define UPLOAD_CHUNK 1436          // one TCP segment of a multipart upload
+#define REPLAY_FILE "build/check_eventlog.bin"
+
+static Preset recalledSound;
+static EventLogData downloaded;
+
+static void setParams(const ParamUpdate* updates, int count) {
+    CHECK(synth.applyParams(updates, count));
+}
+
+static bool noteSounding(int note) {
+    for (int v = 0; v < NUM_VOICES; v++) {
+        const Voice& voice = synth.voices[v];
+        Envelope::State state = voice.envelope.getState();
+        if (voice.note == note && state != Envelope::IDLE && state != Envelope::RELEASE) return true;
+    }
+    return false;
+}
+
+static void stopLog() {
+    // Single-threaded: the request is taken at the next block
+    eventLog.stop(0);
+    synth.renderNextBlock();
+    CHECK(eventLog.isIdle());
+}
+
+static bool replay() {
+    if (!eventLog.startReplay()) return false;
+    for (uint32_t b = 0; !eventLog.isIdle() && b <= eventLog.data.header.blockCount + 1; b++) {
+        synth.renderNextBlock();
+    }
+    return eventLog.isIdle() && eventLog.replayComplete && eventLog.replayMatched &&
+           eventLog.segmentsMatched == eventLog.data.header.segmentCount;
+}
+
+// -------------------------------------------------------------------
+// --- NO RESET ---
+// -------------------------------------------------------------------
+
+static void checkNoReset() {
+    synth.noteOn(57, 100, micros());
+    for (int b = 0; b < 10; b++) synth.renderNextBlock();
+    CHECK(noteSounding(57));
+    uint32_t before = synth.sampleClock;
+
+    CHECK(eventLog.startRecording());
+    synth.renderNextBlock();
+    CHECK(eventLog.state == EVENT_LOG_RECORDING);
+    CHECK(noteSounding(57));
+    CHECK(synth.sampleClock == before + DMA_BUF_LEN);
+    CHECK(eventLog.data.header.segmentCount == 1 && eventLog.segment(0).sample == before);
+
+    stopLog();
+    CHECK(noteSounding(57));
+    synth.noteOff(57, micros());
+    synth.renderNextBlock();
+}
+
+// -------------------------------------------------------------------
+// --- WRAPPING PERFORMANCE ---
+// -------------------------------------------------------------------
+
+static uint32_t nextRandom(uint32_t& state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+static void prepareSounds() {
+    // The recalled sound, captured before the performance's own is set up
+    const ParamUpdate RECALLED[] = {
+        { PARAM_OSC1_WAVE, 1 }, { PARAM_OSC2_ENABLED, 1 }, { PARAM_OSC2_WAVE, 3 }, { PARAM_ATTACK, 0.02f },
+        { PARAM_RELEASE, 0.4f }, { PARAM_UNISON_VOICES, 3 }, { PARAM_UNISON_DETUNE, 12.0f },
+        { PARAM_LFO_RATE + 1, 3.0f }, { PARAM_MOD_SOURCE + 1, MOD_SRC_LFO2 }, { PARAM_MOD_DEST + 1, MOD_DST_PAN },
+        { PARAM_MOD_DEPTH + 1, 0.6f },
+    };
+    setParams(RECALLED, sizeof(RECALLED) / sizeof(RECALLED[0]));
+    synth.renderNextBlock();
+    presetCapture(recalledSound, "recalled");
+
+    const ParamUpdate PLAYED[] = {
+        { PARAM_OSC1_WAVE, 2 }, { PARAM_OSC2_ENABLED, 0 }, { PARAM_ATTACK, 0.005f }, { PARAM_RELEASE, 0.2f },
+        { PARAM_UNISON_VOICES, 1 }, { PARAM_SYNTH_MODE, 1 }, { PARAM_FM_RATIO, 2.0f }, { PARAM_FM_INDEX, 1.5f },
+        { PARAM_LFO_RATE, 5.0f }, { PARAM_MOD_SOURCE, MOD_SRC_LFO1 }, { PARAM_MOD_DEST, MOD_DST_PITCH },
+        { PARAM_MOD_DEPTH, 0.02f }, { PARAM_MOD_SOURCE + 1, MOD_SRC_MODWHEEL }, { PARAM_MOD_DEST + 1, MOD_DST_OSC1_GAIN },
+        { PARAM_MOD_DEPTH + 1, -0.5f }, { PARAM_SEQ_TEMPO, 133.0f }, { PARAM_ARP_MODE, ARP_RANDOM },
+    };
+    setParams(PLAYED, sizeof(PLAYED) / sizeof(PLAYED[0]));
+    synth.renderNextBlock();
+}
+
+static void perform() {
+    static double frequencies[NUM_MIDI_NOTES];
+    for (int n = 0; n < NUM_MIDI_NOTES; n++) {
+        frequencies[n] = 440.0 * pow(2.0, (n - 69) / 19.0);   // 19-EDO
+    }
+
+    uint32_t random = 0x2545F491;
+    int held[6];
+    int heldCount = 0;
+
+    for (int b = 0; b < PERFORMANCE_BLOCKS; b++) {
+        uint32_t r = nextRandom(random);
+
+        if (b % 5 == 0) {
+            if (heldCount == 6) {
+                synth.noteOff(held[0], micros());
+                memmove(held, held + 1, sizeof(int) * 5);
+                heldCount--;
+            }
+            held[heldCount] = 48 + r % 36;
+            // Every other note timed a few blocks ahead, as OSC bundles are
+            uint32_t due = (b % 10 == 0) ? micros() + 2000 + r % 3000 : 0;
+            synth.noteOn(held[heldCount++], 40 + (r >> 8) % 87, micros(), -1, due);
+        }
+        if (b % 23 == 0) synth.controlChange(1, (r >> 12) % 128, micros());
+        if (b % 37 == 0) synth.pitchBend((int)((r >> 4) % 16384) - 8192, micros());
+        if (b % 41 == 0) {
+            ParamUpdate batch[] = { { PARAM_OSC1_GAIN, 0.3f + (r % 70) / 100.0f },
+                                    { PARAM_FM_INDEX, (r >> 16) % 50 / 10.0f } };
+            setParams(batch, 2);
+        }
+        if (b % 97 == 0) synth.scheduleParam(PARAM_STEREO_SPREAD, (r % 100) / 100.0f, micros(), micros() + 1500);
+        if (b == 4000) synth.controlChange(64, 127, micros());
+        if (b == 4400) synth.controlChange(64, 0, micros());
+
+        if (b == ARP_START_BLOCK || b == ARP_STOP_BLOCK) {
+            ParamUpdate mode = { PARAM_SEQ_MODE, (float)(b == ARP_START_BLOCK ? SEQ_ARP : SEQ_OFF) };
+            setParams(&mode, 1);
+        }
+        if (b == RECALL_BLOCK) CHECK(synth.recallPreset(&recalledSound));
+        if (b == RETUNE_BLOCK) CHECK(synth.setTuning(frequencies));
+
+        synth.renderNextBlock();
+    }
+}
+
+static void checkWrap() {
+    prepareSounds();
+    uint32_t recordStart = synth.sampleClock;
+    CHECK(eventLog.startRecording());
+    perform();
+    stopLog();
+
+    const EventLogHeader& h = eventLog.data.header;
+    const EventLogSegment& oldest = eventLog.segment(0);
+    const EventLogSegment& newest = eventLog.segment(h.segmentCount - 1);
+    CHECK(eventLog.isValid());
+    CHECK((h.flags & EVENT_LOG_WRAPPED) && !(h.flags & EVENT_LOG_TRUNCATED));
+    CHECK(h.segmentCount == EVENT_LOG_SEGMENTS);
+    CHECK((int32_t)(oldest.sample - recordStart) > 0);
+    // Ends with the last block recorded before the stop
+    CHECK(newest.sample + newest.blockCount * DMA_BUF_LEN == synth.sampleClock - DMA_BUF_LEN);
+
+    // The recall and the retune each opened a segment of their own
+    bool recalled = false, retuned = false;
+    for (int k = 0; k < h.segmentCount; k++) {
+        recalled |= (eventLog.segment(k).flags & SEGMENT_RECALL) != 0;
+        retuned |= (eventLog.segment(k).flags & SEGMENT_RETUNE) != 0;
+    }
+    CHECK(recalled && retuned);
+
+    printf("  %d blocks recorded, kept %lu blocks and %lu entries from sample %lu in %d segments "
+           "(snapshot %u bytes, max %lu us)\n",
+           PERFORMANCE_BLOCKS, (unsigned long)h.blockCount, (unsigned long)h.entryCount,
+           (unsigned long)(oldest.sample - recordStart), h.segmentCount, (unsigned)sizeof(EngineSnapshot),
+           (unsigned long)eventLog.maxSnapshotMicros);
+}
+
+// -------------------------------------------------------------------
+// --- REPLAY ---
+// -------------------------------------------------------------------
+
+static void checkReplay() {
+    memcpy(&downloaded, &eventLog.data, eventLog.size());
+
+    // Whatever the engine is doing now is replaced by the oldest snapshot
+    ParamUpdate other[] = { { PARAM_OSC1_WAVE, 0 }, { PARAM_LFO_RATE, 0.5f } };
+    setParams(other, 2);
+    synth.noteOn(72, 127, micros());
+    for (int b = 0; b < 50; b++) synth.renderNextBlock();
+
+    CHECK(replay());
+    printf("  replay: %d/%d segments matched, block max %lu us, mean %lu us\n", eventLog.segmentsMatched,
+           eventLog.data.header.segmentCount, (unsigned long)eventLog.maxBlockMicros,
+           (unsigned long)(eventLog.totalBlockMicros / max(eventLog.replayBlocks, (uint32_t)1)));
+
+    // Nothing of the log keeps sounding afterwards
+    for (int b = 0; b < 200; b++) synth.renderNextBlock();
+    for (int v = 0; v < NUM_VOICES; v++) CHECK(synth.voices[v].envelope.getState() == Envelope::IDLE);
+}
+
+// -------------------------------------------------------------------
+// --- DOWNLOAD / UPLOAD ---
+// -------------------------------------------------------------------
+
+static bool upload(const EventLogData& log, size_t length) {
+    if (!eventLog.beginUpload()) return false;
+    for (size_t offset = 0; offset < length; offset += UPLOAD_CHUNK) {
+        size_t chunk = min(length - offset, (size_t)UPLOAD_CHUNK);
+        if (!eventLog.writeUpload((const uint8_t*)&log + offset, chunk)) return false;
+    }
+    return eventLog.endUpload();
+}
+
+static void checkUpload() {
+    static EventLogData corrupt;
+
+    CHECK(!upload(downloaded, sizeof(EventLogData) - sizeof(EventLogEntry)));
+    CHECK(eventLog.size() == 0 && !eventLog.startReplay());
+
+    const uint8_t oldest = downloaded.header.firstSegment;
+    memcpy(&corrupt, &downloaded, sizeof(corrupt));
+    corrupt.segments[(oldest + 1) % EVENT_LOG_SEGMENTS].sample += DMA_BUF_LEN;
+    CHECK(!upload(corrupt, sizeof(corrupt)));
+
+    memcpy(&corrupt, &downloaded, sizeof(corrupt));
+    corrupt.segments[oldest].start.scheduledCount = SCHEDULED_EVENT_SLOTS + 1;
+    CHECK(!upload(corrupt, sizeof(corrupt)));
+
+    CHECK(upload(downloaded, sizeof(downloaded)));
+    CHECK(memcmp(&eventLog.data, &downloaded, sizeof(downloaded)) == 0);
+    CHECK(replay());
+
+    FILE* file = fopen(REPLAY_FILE, "wb");
+    if (file) {
+        fwrite(&downloaded, 1, sizeof(downloaded), file);
+        fclose(file);
+    }
+}
+
+int main() {
+    synth.begin();
+
+    checkNoReset();
+    checkWrap();
+    checkReplay();
+    checkUpload();
+    return checkResult("check_eventlog");
+}
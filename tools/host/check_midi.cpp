@@ -0,0 +1,209 @@
+// check_midi.cpp
+
+// Serial MIDI over a pseudo-terminal: the pty's slave end stands in for the
+// UART behind MIDI_SERIAL, the test writes raw MIDI bytes into the master end.
+//   1. Decoding: running status, real-time bytes inside a message, SysEx,
+//      velocity-0 note-off and pitch bend, checked event by event
+//   2. Engine: the same stream through MidiInput::poll() into the voices
+//   3. Latency: pty write -> decoded event, one note-on at a time
+//   4. Throughput: MidiParser alone over a long in-memory stream
+//
+//     make -C tools/host check
+
+#include <Arduino.h>
+#include "Synth.h"
+#include "EventLog.h"
+#include "MidiInput.h"
+#include "HostCheck.h"
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+// Defined by ESP32_Synth.ino on the device
+EventLog eventLog;
+MidiInput midiInput;
+
+#define LATENCY_MESSAGES 2000
+#define LATENCY_TIMEOUT_US 2000000
+#define THROUGHPUT_BYTES (16 * 1024 * 1024)
+#define DIN_MIDI_BYTES_PER_SECOND 3125  // 31250 baud, 10 bits per byte
+
+static int ptyMaster = -1;
+
+// Raw pty: no line discipline between the bytes written and the bytes read
+static bool openPty() {
+    ptyMaster = posix_openpt(O_RDWR | O_NOCTTY);
+    if (ptyMaster < 0 || grantpt(ptyMaster) != 0 || unlockpt(ptyMaster) != 0) return false;
+
+    int slave = open(ptsname(ptyMaster), O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (slave < 0) return false;
+
+    struct termios raw;
+    tcgetattr(slave, &raw);
+    cfmakeraw(&raw);
+    tcsetattr(slave, TCSANOW, &raw);
+
+    MIDI_SERIAL.attach(slave);
+    return true;
+}
+
+static void send(const uint8_t* bytes, size_t length) {
+    CHECK(write(ptyMaster, bytes, length) == (ssize_t)length);
+    tcdrain(ptyMaster);
+}
+
+// tcdrain() does not wait for the pty to hand the bytes to the slave side;
+// a loaded machine delivers them late. For checks that read until the port
+// is empty, wait (with a timeout) until all of them are readable.
+static void deliver(const uint8_t* bytes, size_t length) {
+    int before = MIDI_SERIAL.available();
+    send(bytes, length);
+    uint32_t sent = micros();
+    while (MIDI_SERIAL.available() < before + (int)length && micros() - sent < LATENCY_TIMEOUT_US) {}
+    CHECK(MIDI_SERIAL.available() >= before + (int)length);
+}
+
+static const uint8_t STREAM[] = {
+    0x90, 60, 100,          // note on 60
+    64, 90,                 // running status: note on 64
+    67, 0xF8, 80,           // timing clock between the data bytes: note on 67
+    0xF0, 0x7D, 0x01, 0xF7, // SysEx cancels running status...
+    70, 70,                 // ...so these are dropped
+    0x80, 60, 0,            // note off 60
+    0x90, 64, 0,            // velocity 0: note off 64
+    0xE0, 0x00, 0x60,       // bend +4096
+    0xB1, 1, 127            // mod wheel, channel 2
+};
+#define STREAM_NOTE_ONS 8       // bytes up to the last note-on
+
+static void checkDecoding() {
+    static const MidiEvent EXPECTED[] = {
+        { 0, MIDI_NOTE_ON, 0, 60, 100, 0 },
+        { 0, MIDI_NOTE_ON, 0, 64, 90, 0 },
+        { 0, MIDI_NOTE_ON, 0, 67, 80, 0 },
+        { 0, MIDI_NOTE_OFF, 0, 60, 0, 0 },
+        { 0, MIDI_NOTE_OFF, 0, 64, 0, 0 },
+        { 0, MIDI_PITCH_BEND, 0, 0x00, 0x60, 4096 },
+        { 0, MIDI_CONTROL_CHANGE, 1, 1, 127, 0 },
+    };
+    const int expectedCount = sizeof(EXPECTED) / sizeof(EXPECTED[0]);
+
+    deliver(STREAM, sizeof(STREAM));
+
+    MidiParser parser;
+    parser.reset();
+    MidiEvent event;
+    int count = 0;
+    while (MIDI_SERIAL.available() > 0) {
+        if (!parser.parse((uint8_t)MIDI_SERIAL.read(), micros(), event)) continue;
+
+        if (count < expectedCount) {
+            const MidiEvent& want = EXPECTED[count];
+            CHECK(event.type == want.type && event.channel == want.channel);
+            CHECK(event.data1 == want.data1 && event.data2 == want.data2 && event.bend == want.bend);
+        }
+        count++;
+    }
+    CHECK(count == expectedCount);
+}
+
+static const Voice* findVoice(int note) {
+    for (int v = 0; v < NUM_VOICES; v++) {
+        if (synth.voices[v].note == note && synth.voices[v].envelope.getState() != Envelope::IDLE) return &synth.voices[v];
+    }
+    return NULL;
+}
+
+static void checkEngine() {
+    // A note released before its first sample never sounds: play the
+    // note-ons for a block before the rest of the stream
+    midiInput.begin();
+    deliver(STREAM, STREAM_NOTE_ONS);
+    midiInput.poll();
+    synth.renderNextBlock();
+    deliver(STREAM + STREAM_NOTE_ONS, sizeof(STREAM) - STREAM_NOTE_ONS);
+    midiInput.poll();
+    synth.renderNextBlock();
+
+    const Voice* held = findVoice(67);
+    const Voice* released = findVoice(60);
+    CHECK(held != NULL && held->envelope.getState() != Envelope::RELEASE);
+    CHECK(held != NULL && held->velocityGain == 80 * 32767 / 127);
+    CHECK(released != NULL && released->envelope.getState() == Envelope::RELEASE);
+    CHECK(findVoice(64) != NULL && findVoice(64)->envelope.getState() == Envelope::RELEASE);
+    CHECK(findVoice(70) == NULL);
+    CHECK(synth.pitchBendRatio > PITCH_RATIO_UNITY);
+    CHECK(synth.lastPlayingNote == 67 && synth.lastPlayingKeyIndex == -1);
+}
+
+static void checkLatency() {
+    MidiParser parser;
+    parser.reset();
+    MidiEvent event;
+    uint32_t worst = 0;
+    uint64_t total = 0;
+
+    for (int i = 0; i < LATENCY_MESSAGES; i++) {
+        uint8_t message[3] = { 0x90, (uint8_t)(i % 128), 100 };
+        uint32_t sent = micros();
+        send(message, sizeof(message));
+
+        // Generous timeout: a loaded machine can deschedule the reader, and a
+        // late message must not be mistaken for the next one
+        bool decoded = false;
+        while (!decoded && micros() - sent < LATENCY_TIMEOUT_US) {
+            if (MIDI_SERIAL.available() > 0) {
+                decoded = parser.parse((uint8_t)MIDI_SERIAL.read(), micros(), event) && event.data1 == i % 128;
+            }
+        }
+        CHECK(decoded);
+
+        uint32_t latency = event.timestamp - sent;
+        if (latency > worst) worst = latency;
+        total += latency;
+    }
+
+    printf("  pty write -> event: mean %.1f us, max %lu us over %d note-ons\n", (double)total / LATENCY_MESSAGES,
+           (unsigned long)worst, LATENCY_MESSAGES);
+}
+
+static void checkThroughput() {
+    // Note on/off pairs under running status, a clock byte every 16 bytes
+    static uint8_t stream[THROUGHPUT_BYTES];
+    size_t length = 0;
+    stream[length++] = 0x90;
+    while (length + 3 <= sizeof(stream)) {
+        if (length % 16 == 0) stream[length++] = 0xF8;
+        uint8_t note = (uint8_t)(length % 128);
+        stream[length++] = note;
+        stream[length++] = (note % 5 == 0) ? 0 : 100;
+    }
+
+    MidiParser parser;
+    parser.reset();
+    MidiEvent event;
+    uint32_t events = 0;
+    uint32_t start = micros();
+    for (size_t i = 0; i < length; i++) {
+        if (parser.parse(stream[i], 0, event)) events++;
+    }
+    double seconds = (micros() - start) / 1e6;
+
+    CHECK(events > length / 3);
+    printf("  parser: %.1f MB/s, %.1f M events/s (%.0fx DIN MIDI)\n", length / seconds / 1e6, events / seconds / 1e6,
+           length / seconds / DIN_MIDI_BYTES_PER_SECOND);
+}
+
+int main() {
+    synth.begin();
+    if (!openPty()) {
+        printf("check_midi: no pty available\n");
+        return 1;
+    }
+
+    checkDecoding();
+    checkEngine();
+    checkLatency();
+    checkThroughput();
+    return checkResult("check_midi");
+}
@@ -0,0 +1,330 @@
+// check_osc.cpp
+
+// OSC over real loopback UDP: the check sends datagrams to 127.0.0.1 and
+// OscServer receives them through the host WiFiUDP (a POSIX socket).
+//   1. Messages: notes, /param batches, malformed packets rejected whole;
+//      NaN and infinite arguments dropped, huge ones clamped to MIDI ranges
+//   2. Blobs: a length field near 2^32 must not wrap the bounds check
+//   3. Timetags: two bundles 10 ms apart on the sender's clock land 441
+//      samples apart on the audio clock, whatever the network adds below
+//      the schedule margin; a bundle later than the margin plays at once
+//   4. Latency: sendto() -> packet handled by OscServer::poll()
+//
+//     make -C tools/host check
+
+#include <Arduino.h>
+#include "Synth.h"
+#include "EventLog.h"
+#include "OscServer.h"
+#include "HostCheck.h"
+#include <math.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// Defined by ESP32_Synth.ino on the device
+EventLog eventLog;
+OscServer oscServer;
+
+#define LATENCY_PACKETS 2000
+#define LATENCY_TIMEOUT_US 2000000
+#define SENDER_EPOCH_SECONDS 1000   // arbitrary start of the sender's clock
+
+static int sender = -1;
+
+// -------------------------------------------------------------------
+// --- PACKET BUILDER ---
+// -------------------------------------------------------------------
+
+struct Packet {
+    uint8_t bytes[OSC_MAX_PACKET_SIZE];
+    size_t length = 0;
+
+    void putUint32(uint32_t value) {
+        bytes[length++] = value >> 24;
+        bytes[length++] = value >> 16;
+        bytes[length++] = value >> 8;
+        bytes[length++] = value;
+    }
+
+    void putString(const char* text) {
+        size_t size = strlen(text) + 1;
+        memcpy(&bytes[length], text, size);
+        length += size;
+        while (length & 3) bytes[length++] = 0;
+    }
+
+    void putFloat(float value) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        putUint32(bits);
+    }
+
+    // Message with float arguments only
+    void message(const char* address, int count, float a = 0.0f, float b = 0.0f) {
+        static const char* TAGS[] = { ",", ",f", ",ff" };
+        putString(address);
+        putString(TAGS[count]);
+        if (count > 0) putFloat(a);
+        if (count > 1) putFloat(b);
+    }
+
+    // Bundle holding one message; 'timeTag' in sender microseconds
+    void bundle(uint64_t senderMicros, const char* address, float a, float b) {
+        Packet element;
+        element.message(address, 2, a, b);
+
+        uint64_t seconds = SENDER_EPOCH_SECONDS + senderMicros / 1000000;
+        uint64_t fraction = ((senderMicros % 1000000) << 32) / 1000000 + 1;   // +1: round up to the microsecond
+        putString("#bundle");
+        putUint32((uint32_t)seconds);
+        putUint32((uint32_t)fraction);
+        putUint32((uint32_t)element.length);
+        memcpy(&bytes[length], element.bytes, element.length);
+        length += element.length;
+    }
+};
+
+static void send(const Packet& packet) {
+    struct sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(OSC_PORT);
+    CHECK(sendto(sender, packet.bytes, packet.length, 0, (struct sockaddr*)&address, sizeof(address)) ==
+          (ssize_t)packet.length);
+}
+
+// Polls until 'count' more packets have been handled
+static bool receive(uint32_t count) {
+    uint32_t target = oscServer.packetsReceived + count;
+    uint32_t start = micros();
+    while (oscServer.packetsReceived < target && micros() - start < LATENCY_TIMEOUT_US) {
+        oscServer.poll();
+    }
+    return oscServer.packetsReceived >= target;
+}
+
+static const Voice* findVoice(int note) {
+    for (int v = 0; v < NUM_VOICES; v++) {
+        if (synth.voices[v].note == note && synth.voices[v].envelope.getState() != Envelope::IDLE) return &synth.voices[v];
+    }
+    return NULL;
+}
+
+// -------------------------------------------------------------------
+// --- CHECKS ---
+// -------------------------------------------------------------------
+
+static void checkMessages() {
+    Packet note;
+    note.message("/note/on", 2, 60, 100);
+    send(note);
+
+    Packet params;
+    params.message("/param/attack", 1, 0.3f);
+    send(params);
+
+    CHECK(receive(2));
+    synth.renderNextBlock();
+    CHECK(findVoice(60) != NULL);
+    CHECK(synth.attackTime == 0.3f);
+
+    // A bad tail rejects the whole packet: the note before it never plays
+    uint32_t rejected = oscServer.packetsRejected;
+    Packet bad;
+    bad.putString("#bundle");
+    bad.putUint32(0);
+    bad.putUint32(1);
+    Packet element;
+    element.message("/note/on", 2, 62, 100);
+    bad.putUint32((uint32_t)element.length);
+    memcpy(&bad.bytes[bad.length], element.bytes, element.length);
+    bad.length += element.length;
+    bad.putUint32(64);   // element size past the end
+    send(bad);
+
+    CHECK(receive(1));
+    synth.renderNextBlock();
+    CHECK(oscServer.packetsRejected == rejected + 1);
+    CHECK(findVoice(62) == NULL);
+
+    Packet off;
+    off.message("/note/off", 1, 60);
+    send(off);
+    CHECK(receive(1));
+    synth.controlChange(120, 0, micros());
+    synth.renderNextBlock();
+
+    // Non-finite arguments never reach the engine; out-of-range ones are
+    // clamped before the float -> int conversion
+    const float NOT_FINITE[] = { NAN, INFINITY, -INFINITY };
+    for (float value : NOT_FINITE) {
+        Packet on, velocity, bend, cc;
+        on.message("/note/on", 2, value, 100);
+        velocity.message("/note/on", 2, 61, value);
+        bend.message("/bend", 1, value);
+        cc.message("/cc", 2, 1, value);
+        send(on);
+        send(velocity);
+        send(bend);
+        send(cc);
+        CHECK(receive(4));
+    }
+    synth.renderNextBlock();
+    CHECK(findVoice(61) == NULL);
+    CHECK(synth.pitchBendRatio == PITCH_RATIO_UNITY);
+
+    Packet huge, hugeBend;
+    huge.message("/note/on", 2, 3e9f, 1e12f);
+    hugeBend.message("/bend", 1, -5e9f);
+    send(huge);
+    send(hugeBend);
+    CHECK(receive(2));
+    synth.renderNextBlock();
+    const Voice* top = findVoice(127);
+    CHECK(top != NULL && top->velocityGain == 32767);
+    CHECK(synth.pitchBendRatio < PITCH_RATIO_UNITY);
+
+    synth.pitchBend(0, micros());
+    synth.controlChange(120, 0, micros());
+    synth.renderNextBlock();
+}
+
+static void checkBlobs() {
+    // Small blob: accepted
+    Packet blob;
+    blob.putString("/blob");
+    blob.putString(",b");
+    blob.putUint32(3);
+    blob.putUint32(0x01020300);
+    CHECK(oscParsePacket(blob.bytes, blob.length, NULL, NULL));
+
+    // Lengths that pad or add past 2^32: refused, whatever follows
+    const uint32_t lengths[] = { 0xFFFFFFFF, 0xFFFFFFFD, 0xFFFFFFFC, 5 };
+    for (uint32_t length : lengths) {
+        Packet overflow;
+        overflow.putString("/blob");
+        overflow.putString(",b");
+        overflow.putUint32(length);
+        overflow.putUint32(0);
+        CHECK(!oscParsePacket(overflow.bytes, overflow.length, NULL, NULL));
+    }
+
+    // ... and over the socket
+    uint32_t rejected = oscServer.packetsRejected;
+    Packet overflow;
+    overflow.putString("/note/on");
+    overflow.putString(",bff");
+    overflow.putUint32(0xFFFFFFFD);
+    overflow.putFloat(60);
+    overflow.putFloat(100);
+    send(overflow);
+    CHECK(receive(1));
+    CHECK(oscServer.packetsRejected == rejected + 1);
+}
+
+// Sample on which each scheduled note-on was applied, from the event log
+static int scheduledNoteSamples(uint32_t* samples, int maxSamples) {
+    int count = 0;
+    for (uint32_t i = 0; i < eventLog.data.header.entryCount && count < maxSamples; i++) {
+        const EventLogEntry& entry = eventLog.entry(i);
+        if (entry.kind == LOG_EVENT && entry.type == EVENT_NOTE_ON && (entry.flags & LOG_FLAG_SCHEDULED)) {
+            samples[count++] = entry.sample;
+        }
+    }
+    return count;
+}
+
+static void checkTimeTags() {
+    const int spacingUs = 10000;
+    const int expectedSamples = (int)((int64_t)spacingUs * I2S_SAMPLE_RATE / 1000000);
+
+    CHECK(eventLog.startRecording());
+    synth.renderNextBlock();
+
+    // The second bundle leaves the sender 10 ms later by its clock, but the
+    // network delays it by an extra 3 ms: the audio must not hear that. Both
+    // are polled on arrival, as the device's loop does, and drained together.
+    uint32_t senderStart = micros();
+    Packet first;
+    first.bundle(0, "/note/on", 60, 100);
+    send(first);
+    CHECK(receive(1));
+    usleep(spacingUs + 3000);
+    Packet second;
+    second.bundle(spacingUs, "/note/on", 64, 100);
+    send(second);
+    CHECK(receive(1));
+
+    uint32_t late = oscServer.lateMessages;
+    for (int b = 0; b < 2 * OSC_SCHEDULE_MARGIN_US * I2S_SAMPLE_RATE / 1000000 / DMA_BUF_LEN; b++) {
+        synth.renderNextBlock();
+    }
+
+    // Sent 40 ms after its timetag: past the margin, so it plays at once
+    while (micros() - senderStart < (uint32_t)spacingUs + 40000) usleep(1000);
+    Packet tardy;
+    tardy.bundle(spacingUs, "/note/on", 67, 100);
+    send(tardy);
+    CHECK(receive(1));
+    synth.renderNextBlock();
+    CHECK(oscServer.lateMessages == late + 1);
+    CHECK(findVoice(67) != NULL);
+
+    eventLog.stop(0);
+    synth.renderNextBlock();
+    CHECK(eventLog.isIdle());
+
+    uint32_t samples[4];
+    int count = scheduledNoteSamples(samples, 4);
+    CHECK(count == 2);
+    if (count == 2) {
+        int spacing = (int)(samples[1] - samples[0]);
+        CHECK(abs(spacing - expectedSamples) <= 1);
+        printf("  bundles 10 ms apart (+3 ms network jitter) played %d samples apart (expected %d)\n", spacing,
+               expectedSamples);
+    }
+
+    synth.controlChange(120, 0, micros());
+    synth.renderNextBlock();
+}
+
+static void checkLatency() {
+    uint32_t worst = 0;
+    uint64_t total = 0;
+    int received = 0;
+
+    for (int i = 0; i < LATENCY_PACKETS; i++) {
+        Packet bend;
+        bend.message("/bend", 1, (float)(i % 8192));
+        uint32_t sent = micros();
+        send(bend);
+        if (!receive(1)) continue;
+
+        uint32_t latency = micros() - sent;
+        if (latency > worst) worst = latency;
+        total += latency;
+        received++;
+        synth.renderNextBlock();
+    }
+
+    CHECK(received == LATENCY_PACKETS);
+    printf("  sendto -> handled: mean %.1f us, max %lu us over %d packets\n", (double)total / LATENCY_PACKETS,
+           (unsigned long)worst, LATENCY_PACKETS);
+}
+
+int main() {
+    synth.begin();
+    oscServer.begin();
+    sender = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sender < 0) {
+        printf("check_osc: no UDP socket available\n");
+        return 1;
+    }
+
+    checkMessages();
+    checkBlobs();
+    checkTimeTags();
+    checkLatency();
+    return checkResult("check_osc");
+}
@@ -0,0 +1,152 @@
+// check_params.cpp
+
+// The binary parameter frame path (ParamFrame.h) on the host:
+//   1. Allocation: decodeHexFrame -> parseParamFrame -> Synth::applyParams ->
+//      the batch landing in renderNextBlock, and findParam for OSC names,
+//      with every malloc in the process counted. Must be zero.
+//   2. Throughput: full 64-entry frames parsed and validated per second
+//   3. Pitch bend: every range PARAM_INFO accepts, end to end through the
+//      event queue, stays within +/-range semitones without wrapping
+//
+//     make -C tools/host check
+
+#include <Arduino.h>
+#include "Synth.h"
+#include "EventLog.h"
+#include "ParamFrame.h"
+#include "HostCheck.h"
+#include <math.h>
+
+// Defined by ESP32_Synth.ino on the device
+EventLog eventLog;
+
+#define THROUGHPUT_FRAMES 200000
+#define ALLOCATION_ROUNDS 1000
+
+// -------------------------------------------------------------------
+// --- ALLOCATION COUNTING ---
+// -------------------------------------------------------------------
+
+// Interposes the C allocator (operator new lands here too) and counts calls
+// while 'counting' is set
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t count, size_t size);
+extern "C" void* __libc_realloc(void* pointer, size_t size);
+extern "C" void __libc_free(void* pointer);
+
+static volatile bool counting = false;
+static volatile uint32_t allocations = 0;
+
+extern "C" void* malloc(size_t size) {
+    if (counting) allocations++;
+    return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t count, size_t size) {
+    if (counting) allocations++;
+    return __libc_calloc(count, size);
+}
+
+extern "C" void* realloc(void* pointer, size_t size) {
+    if (counting) allocations++;
+    return __libc_realloc(pointer, size);
+}
+
+extern "C" void free(void* pointer) { __libc_free(pointer); }
+
+// -------------------------------------------------------------------
+// --- CHECKS ---
+// -------------------------------------------------------------------
+
+// A frame with every entry in range, values varying with 'seed'
+static size_t buildFrame(uint8_t* frame, int count, int seed) {
+    size_t length = 0;
+    frame[length++] = PARAM_FRAME_MAGIC;
+    frame[length++] = (uint8_t)count;
+    for (int i = 0; i < count; i++) {
+        uint8_t id = (uint8_t)(PARAM_ATTACK + (seed + i) % 4);   // attack, decay, sustain, release
+        float value = ((seed + i) % 10) / 10.0f;
+        frame[length++] = id;
+        memcpy(&frame[length], &value, sizeof(float));
+        length += sizeof(float);
+    }
+    return length;
+}
+
+static void checkAllocation() {
+    uint8_t frame[MAX_PARAM_FRAME_SIZE];
+    char hex[2 * MAX_PARAM_FRAME_SIZE + 1];
+    ParamUpdate updates[MAX_PARAMS_PER_FRAME];
+
+    counting = true;
+    for (int round = 0; round < ALLOCATION_ROUNDS; round++) {
+        // HTTP fallback: hex in, binary out
+        size_t length = buildFrame(frame, 8, round);
+        for (size_t i = 0; i < length; i++) snprintf(&hex[2 * i], 3, "%02x", frame[i]);
+        int decoded = decodeHexFrame(hex, frame, sizeof(frame));
+
+        int count = parseParamFrame(frame, decoded, updates, MAX_PARAMS_PER_FRAME);
+        CHECK(count == 8);
+        CHECK(synth.applyParams(updates, count));
+        CHECK(findParam("fm_index") == PARAM_FM_INDEX);
+        synth.renderNextBlock();
+    }
+    counting = false;
+
+    CHECK(allocations == 0);
+    CHECK(synth.sustainLevel >= 0.0 && synth.sustainLevel <= 1.0);
+    printf("  %lu allocations over %d frames (decode, parse, stage, apply)\n", (unsigned long)allocations,
+           ALLOCATION_ROUNDS);
+}
+
+static void checkThroughput() {
+    static uint8_t frames[16][MAX_PARAM_FRAME_SIZE];
+    size_t lengths[16];
+    for (int f = 0; f < 16; f++) lengths[f] = buildFrame(frames[f], MAX_PARAMS_PER_FRAME, f);
+
+    ParamUpdate updates[MAX_PARAMS_PER_FRAME];
+    uint32_t entries = 0;
+    uint32_t start = micros();
+    for (int i = 0; i < THROUGHPUT_FRAMES; i++) {
+        int count = parseParamFrame(frames[i % 16], lengths[i % 16], updates, MAX_PARAMS_PER_FRAME);
+        entries += count;
+    }
+    double seconds = (micros() - start) / 1e6;
+
+    CHECK(entries == (uint32_t)THROUGHPUT_FRAMES * MAX_PARAMS_PER_FRAME);
+    printf("  parseParamFrame: %.2f M frames/s, %.1f M entries/s (%d entries per frame)\n",
+           THROUGHPUT_FRAMES / seconds / 1e6, entries / seconds / 1e6, MAX_PARAMS_PER_FRAME);
+}
+
+static void checkPitchBend() {
+    int maxRange = (int)PARAM_INFO[PARAM_PITCH_BEND_RANGE].maxValue;
+    for (int range = 0; range <= maxRange; range++) {
+        ParamUpdate update = { PARAM_PITCH_BEND_RANGE, (float)range };
+        CHECK(synth.applyParams(&update, 1));
+        synth.renderNextBlock();
+
+        const int bends[] = { -8192, -1, 1, 8191 };
+        for (int bend : bends) {
+            synth.pitchBend(bend, micros());
+            synth.renderNextBlock();
+
+            double semitones = 12.0 * log2((double)synth.pitchBendRatio / PITCH_RATIO_UNITY);
+            double expected = bend * range / 8192.0;
+            CHECK(fabs(semitones - expected) < 0.01);
+        }
+    }
+    CHECK(!paramInRange(PARAM_PITCH_BEND_RANGE, maxRange + 1.0f));
+
+    synth.pitchBend(0, micros());
+    synth.renderNextBlock();
+    CHECK(synth.pitchBendRatio == PITCH_RATIO_UNITY);
+}
+
+int main() {
+    synth.begin();
+
+    checkAllocation();
+    checkThroughput();
+    checkPitchBend();
+    return checkResult("check_params");
+}
@@ -0,0 +1,149 @@
+// check_presets.cpp
+
+// Presets through the Web UI handlers, the bank and the NVS stand-in:
+//   1. Store -> recall round trip: every parameter comes back bit-identical,
+//      and the coefficients the audio core uses are the stored ones, byte for
+//      byte (oscillator phases run free across notes, so the output words
+//      themselves are not compared)
+//   2. Persistence: a second bank opened on the same NVS namespace (as after
+//      a reboot) loads the slot and recalls the active preset
+//   3. Recall timing: presetApplyUs on the audio core, against one block
+//   4. /preset/store names: sanitized, clipped, defaulted, never read after
+//      the request argument is gone
+//
+//     make -C tools/host check
+
+#include <Arduino.h>
+#include "Synth.h"
+#include "UI.h"
+#include "HostCheck.h"
+
+// Defined by ESP32_Synth.ino on the device
+Control synthControl;
+OscServer oscServer;
+PresetBank presetBank;
+FootprintMonitor footprint;
+EventLog eventLog;
+
+#define SLOT 2
+#define RECALL_ROUNDS 1000
+
+// A sound far from the defaults in every section the preset covers
+static const ParamUpdate SOUND[] = {
+    { PARAM_OSC1_WAVE, 2 }, { PARAM_OSC2_WAVE, 3 }, { PARAM_OSC2_GAIN, 0.3f },
+    { PARAM_ATTACK, 0.002f }, { PARAM_DECAY, 0.3f }, { PARAM_SUSTAIN, 0.7f }, { PARAM_RELEASE, 1.2f },
+    { PARAM_ROOT_NOTE, 57 }, { PARAM_SCALE_TYPE, 2 },
+    { PARAM_UNISON_VOICES, 5 }, { PARAM_UNISON_DETUNE, 33.3f }, { PARAM_STEREO_SPREAD, 0.8f },
+    { PARAM_SYNTH_MODE, 1 }, { PARAM_FM_RATIO, 2.5f }, { PARAM_FM_INDEX, 3.7f },
+    { PARAM_PITCH_BEND_RANGE, 7 }, { PARAM_LFO_RATE + 1, 6.25f }, { PARAM_LFO_SHAPE + 2, 3 },
+};
+
+static const ParamUpdate OTHER_SOUND[] = {
+    { PARAM_OSC1_WAVE, 0 }, { PARAM_ATTACK, 0.5f }, { PARAM_UNISON_VOICES, 1 }, { PARAM_SYNTH_MODE, 0 },
+    { PARAM_FM_INDEX, 1.0f }, { PARAM_ROOT_NOTE, 60 }, { PARAM_LFO_RATE + 1, 1.0f },
+};
+
+static void apply(const ParamUpdate* updates, int count) {
+    CHECK(synth.applyParams(updates, count));
+    synth.renderNextBlock();
+}
+
+// The engine runs on exactly the coefficients 'preset' carries
+static bool engineMatches(const Preset& preset) {
+    return memcmp(&synth.envelopeCoefficients, &preset.envelope, sizeof(preset.envelope)) == 0 &&
+           memcmp(&synth.unisonCoefficients, &preset.unison, sizeof(preset.unison)) == 0 &&
+           synth.fmDepth == preset.fmDepth;
+}
+
+static void checkRoundTrip() {
+    apply(SOUND, sizeof(SOUND) / sizeof(SOUND[0]));
+    Preset stored;
+    presetCapture(stored, "Round Trip");
+
+    CHECK(server.request(HTTP_GET, "/preset/store", { { "slot", std::to_string(SLOT) }, { "name", "Round Trip" } }) == 200);
+
+    apply(OTHER_SOUND, sizeof(OTHER_SOUND) / sizeof(OTHER_SOUND[0]));
+    Preset other;
+    presetCapture(other, "Round Trip");
+    CHECK(memcmp(&other, &stored, sizeof(Preset)) != 0);
+    CHECK(!engineMatches(stored));
+
+    CHECK(server.request(HTTP_GET, "/preset/recall", { { "slot", std::to_string(SLOT) } }) == 200);
+    synth.renderNextBlock();
+    CHECK(!synth.isPresetPending());
+
+    Preset recalled;
+    presetCapture(recalled, "Round Trip");
+    CHECK(memcmp(&recalled, &stored, sizeof(Preset)) == 0);
+    CHECK(engineMatches(stored));
+}
+
+static void checkPersistence() {
+    apply(OTHER_SOUND, sizeof(OTHER_SOUND) / sizeof(OTHER_SOUND[0]));
+
+    // A fresh bank on the same namespace: loads every slot, recalls the active one
+    static PresetBank rebooted;
+    rebooted.begin();
+    CHECK(rebooted.isUsed(SLOT) && strcmp(rebooted.getName(SLOT), "Round Trip") == 0);
+    CHECK(rebooted.getActiveSlot() == SLOT);
+    synth.renderNextBlock();
+
+    Preset stored, recalled;
+    presetCapture(stored, "Round Trip");
+    CHECK(presetIsValid(stored));
+    CHECK(rebooted.recall(SLOT));
+    synth.renderNextBlock();
+    presetCapture(recalled, "Round Trip");
+    CHECK(memcmp(&recalled, &stored, sizeof(Preset)) == 0);
+    CHECK(engineMatches(stored));
+}
+
+static void checkRecallTiming() {
+    uint32_t worst = 0;
+    uint64_t total = 0;
+
+    for (int i = 0; i < RECALL_ROUNDS; i++) {
+        CHECK(presetBank.recall(SLOT));
+        CHECK(!presetBank.recall(SLOT));   // still owned by the audio core
+        synth.renderNextBlock();
+
+        uint32_t applyUs = synth.presetApplyUs;
+        if (applyUs > worst) worst = applyUs;
+        total += applyUs;
+    }
+
+    const uint32_t blockUs = DMA_BUF_LEN * 1000000 / I2S_SAMPLE_RATE;
+    CHECK(worst < blockUs);
+    printf("  recall on the audio core: mean %.2f us, max %lu us (block %lu us, %u-byte preset)\n",
+           (double)total / RECALL_ROUNDS, (unsigned long)worst, (unsigned long)blockUs, (unsigned)sizeof(Preset));
+}
+
+static void checkNames() {
+    struct { const char* given; const char* stored; } NAMES[] = {
+        { "Warm \"Pad\" <2>", "Warm Pad 2" },
+        { "A very long preset name indeed", "A very long pre" },
+        { "!!!", "Preset 4" },
+        { "", "Preset 4" },
+    };
+
+    for (const auto& name : NAMES) {
+        CHECK(server.request(HTTP_GET, "/preset/store", { { "slot", "3" }, { "name", name.given } }) == 200);
+        CHECK(strcmp(presetBank.getName(3), name.stored) == 0);
+    }
+
+    CHECK(server.request(HTTP_GET, "/preset/store", { { "slot", "8" }, { "name", "x" } }) == 400);
+    CHECK(server.request(HTTP_GET, "/preset/erase", { { "slot", "3" } }) == 200);
+    CHECK(!presetBank.isUsed(3));
+}
+
+int main() {
+    synth.begin();
+    presetBank.begin();
+    uiSetup();
+
+    checkRoundTrip();
+    checkPersistence();
+    checkRecallTiming();
+    checkNames();
+    return checkResult("check_presets");
+}
@@ -0,0 +1,272 @@
+// check_samples.cpp
+
+// Sample bank and player against a memory-mapped image, as the synth maps
+// its "samples" partition. The image is written in the tools/build_samples.py
+// layout, then mmap()ed read-only:
+//   1. Loops: at integer and fractional steps, every output sample equals the
+//      interpolation of the unrolled loop, across block and loop boundaries
+//   2. One-shots: silence past the last frame, inactive once it is reached
+//   3. stepFor(): 1.0 at the root note on a sample at the output rate, 0.5
+//      for one at half the rate, capped at SAMPLE_MAX_STEP above
+//   4. attach() refuses a bad magic, a misaligned offset, a length past the
+//      image, bad loop points and an unterminated name
+//   5. 16 players at SAMPLE_MAX_STEP render within the block budget
+//
+//     make -C tools/host check
+
+#include <Arduino.h>
+#include "Synth.h"
+#include "EventLog.h"
+#include "SampleBank.h"
+#include "HostCheck.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Defined by ESP32_Synth.ino on the device
+EventLog eventLog;
+
+#define IMAGE_FILE "build/check_samples.bin"
+#define ONE_SHOT 0
+#define LOOPED 1
+#define ONE_SHOT_FRAMES 1000
+#define LOOPED_FRAMES 300
+#define LOOP_START 100
+#define LOOP_END 250
+#define LOOP_BLOCKS 40
+#define TIMING_BLOCKS 5000
+
+struct Image {
+    SampleBankHeader header;
+    SampleInfo infos[2];
+    int16_t oneShot[ONE_SHOT_FRAMES];
+    int16_t looped[LOOPED_FRAMES];
+};
+static_assert(sizeof(SampleBankHeader) == 8 && sizeof(SampleInfo) == 40, "layout differs from build_samples.py");
+
+// Frame values that name their own position: a ramp, and the frame index
+static int16_t oneShotValue(uint32_t frame) { return (int16_t)(frame * 16); }
+static int16_t loopedValue(uint32_t frame) { return (int16_t)frame; }
+
+static void buildImage(Image& image) {
+    memset(&image, 0, sizeof(image));
+    image.header = { SAMPLE_BANK_MAGIC, SAMPLE_BANK_VERSION, 2 };
+
+    SampleInfo& oneShot = image.infos[ONE_SHOT];
+    strcpy(oneShot.name, "ramp");
+    oneShot.offset = offsetof(Image, oneShot);
+    oneShot.length = ONE_SHOT_FRAMES;
+    oneShot.sampleRate = I2S_SAMPLE_RATE;
+    oneShot.rootNote = 60;
+
+    SampleInfo& looped = image.infos[LOOPED];
+    strcpy(looped.name, "loop");
+    looped.offset = offsetof(Image, looped);
+    looped.length = LOOPED_FRAMES;
+    looped.loopStart = LOOP_START;
+    looped.loopEnd = LOOP_END;
+    looped.sampleRate = I2S_SAMPLE_RATE / 2;
+    looped.rootNote = 69;
+
+    for (uint32_t i = 0; i < ONE_SHOT_FRAMES; i++) image.oneShot[i] = oneShotValue(i);
+    for (uint32_t i = 0; i < LOOPED_FRAMES; i++) image.looped[i] = loopedValue(i);
+}
+
+// Written to a file and mapped back, as the partition is on the device
+static const uint8_t* mapImage(const Image& image, size_t& size) {
+    FILE* file = fopen(IMAGE_FILE, "wb");
+    CHECK(file != NULL);
+    if (file == NULL) return NULL;
+    fwrite(&image, 1, sizeof(image), file);
+    fclose(file);
+
+    int fd = open(IMAGE_FILE, O_RDONLY);
+    CHECK(fd >= 0);
+    if (fd < 0) return NULL;
+    size = (size_t)lseek(fd, 0, SEEK_END);
+    void* mapped = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    CHECK(mapped != MAP_FAILED);
+    return (mapped != MAP_FAILED) ? (const uint8_t*)mapped : NULL;
+}
+
+// -------------------------------------------------------------------
+// --- PLAYBACK ---
+// -------------------------------------------------------------------
+
+// Frame 'frame' of the looped sample with the loop unrolled
+static uint32_t unrolled(uint64_t frame) {
+    if (frame < LOOP_END) return (uint32_t)frame;
+    return LOOP_START + (uint32_t)((frame - LOOP_START) % (LOOP_END - LOOP_START));
+}
+
+static void checkLoop(const SampleBank& bank, uint32_t step) {
+    SamplePlayer player;
+    player.start(bank, LOOPED);
+
+    int wrong = 0;
+    uint64_t position = 0;   // Q16, never wrapped
+    for (int b = 0; b < LOOP_BLOCKS; b++) {
+        int32_t out[DMA_BUF_LEN];
+        player.render(out, DMA_BUF_LEN, step);
+
+        for (int i = 0; i < DMA_BUF_LEN; i++) {
+            int32_t a = loopedValue(unrolled(position >> 16));
+            int32_t c = loopedValue(unrolled((position >> 16) + 1));
+            int32_t frac = (int32_t)((position & 0xFFFF) >> 1);
+            if (out[i] != a + (((c - a) * frac) >> 15)) wrong++;
+            position += step;
+        }
+    }
+    CHECK(wrong == 0);
+    CHECK(player.isActive());
+    printf("  loop at step %.4f: %d samples over %llu loop passes, %d wrong\n", step / 65536.0,
+           LOOP_BLOCKS * DMA_BUF_LEN, (unsigned long long)((position >> 16) - LOOP_START) / (LOOP_END - LOOP_START),
+           wrong);
+}
+
+static void checkOneShot(const SampleBank& bank) {
+    SamplePlayer player;
+    player.start(bank, ONE_SHOT);
+
+    const int blocks = (ONE_SHOT_FRAMES + DMA_BUF_LEN - 1) / DMA_BUF_LEN;
+    int wrong = 0;
+    for (int b = 0; b < blocks; b++) {
+        CHECK(player.isActive());
+        int32_t out[DMA_BUF_LEN];
+        player.render(out, DMA_BUF_LEN, 1 << 16);
+        for (int i = 0; i < DMA_BUF_LEN; i++) {
+            uint32_t frame = b * DMA_BUF_LEN + i;
+            int32_t expected = (frame < ONE_SHOT_FRAMES) ? oneShotValue(frame) : 0;
+            if (out[i] != expected) wrong++;
+        }
+    }
+    CHECK(wrong == 0);
+    CHECK(!player.isActive());
+
+    int32_t out[DMA_BUF_LEN];
+    player.render(out, DMA_BUF_LEN, 1 << 16);
+    bool silent = true;
+    for (int i = 0; i < DMA_BUF_LEN; i++) silent &= (out[i] == 0);
+    CHECK(silent);
+}
+
+static void checkSteps(const SampleBank& bank) {
+    // Root-note increments are truncated on both sides: within one Q16 step
+    CHECK(abs((int)bank.stepFor(ONE_SHOT, NOTE_INCREMENT_12TET[60]) - 65536) <= 1);
+    CHECK(abs((int)bank.stepFor(LOOPED, NOTE_INCREMENT_12TET[69]) - 32768) <= 1);
+    CHECK(abs((int)bank.stepFor(ONE_SHOT, NOTE_INCREMENT_12TET[72]) - 131072) <= 2);
+    CHECK(bank.stepFor(ONE_SHOT, NOTE_INCREMENT_12TET[84]) <= SAMPLE_MAX_STEP);
+    CHECK(bank.stepFor(ONE_SHOT, NOTE_INCREMENT_12TET[96]) == SAMPLE_MAX_STEP);
+    CHECK(bank.stepFor(ONE_SHOT, NOTE_INCREMENT_12TET[127]) == SAMPLE_MAX_STEP);
+}
+
+// -------------------------------------------------------------------
+// --- VALIDATION ---
+// -------------------------------------------------------------------
+
+static bool attachCopy(const Image& image, size_t size) {
+    SampleBank bank;
+    bool attached = bank.attach((const uint8_t*)&image, size);
+    CHECK(attached == (bank.getCount() > 0));
+    return attached;
+}
+
+static void checkAttach(const Image& good) {
+    static Image image;
+    CHECK(attachCopy(good, sizeof(good)));
+    CHECK(!attachCopy(good, sizeof(SampleBankHeader) - 1));
+    CHECK(!attachCopy(good, offsetof(Image, looped) + 2));        // second sample cut off
+    SampleBank none;
+    CHECK(!none.attach(NULL, sizeof(good)));
+
+    image = good;
+    image.header.magic ^= 1;
+    CHECK(!attachCopy(image, sizeof(image)));
+
+    image = good;
+    image.header.count = SAMPLE_BANK_MAX_SAMPLES + 1;
+    CHECK(!attachCopy(image, sizeof(image)));
+
+    image = good;
+    image.infos[LOOPED].offset += 2;
+    CHECK(!attachCopy(image, sizeof(image)));
+
+    image = good;
+    image.infos[LOOPED].offset = sizeof(image) + 4;
+    CHECK(!attachCopy(image, sizeof(image)));
+
+    image = good;
+    image.infos[LOOPED].length = LOOPED_FRAMES + 1;
+    CHECK(!attachCopy(image, sizeof(image)));
+
+    image = good;
+    image.infos[ONE_SHOT].length = 0xFFFFFFFF;   // must not wrap the bounds check
+    CHECK(!attachCopy(image, sizeof(image)));
+
+    image = good;
+    image.infos[LOOPED].loopStart = LOOP_END;
+    CHECK(!attachCopy(image, sizeof(image)));
+
+    image = good;
+    image.infos[LOOPED].loopEnd = LOOPED_FRAMES + 1;
+    CHECK(!attachCopy(image, sizeof(image)));
+
+    image = good;
+    memset(image.infos[ONE_SHOT].name, 'a', SAMPLE_NAME_LENGTH);
+    CHECK(!attachCopy(image, sizeof(image)));
+}
+
+// -------------------------------------------------------------------
+// --- TIMING ---
+// -------------------------------------------------------------------
+
+static void checkTiming(const SampleBank& bank) {
+    static SamplePlayer players[NUM_VOICES];
+    for (int v = 0; v < NUM_VOICES; v++) players[v].start(bank, LOOPED);
+
+    int32_t out[DMA_BUF_LEN];
+    int64_t sink = 0;
+    uint32_t worst = 0;
+    uint64_t total = 0;
+    for (int b = 0; b < TIMING_BLOCKS; b++) {
+        uint32_t start = micros();
+        for (int v = 0; v < NUM_VOICES; v++) {
+            players[v].render(out, DMA_BUF_LEN, SAMPLE_MAX_STEP);
+            sink += out[b % DMA_BUF_LEN];
+        }
+        uint32_t elapsed = micros() - start;
+        if (elapsed > worst) worst = elapsed;
+        total += elapsed;
+    }
+
+    const uint32_t blockUs = DMA_BUF_LEN * 1000000 / I2S_SAMPLE_RATE;
+    double mean = (double)total / TIMING_BLOCKS;
+    CHECK(mean < blockUs);
+    printf("  %d players at step %d: mean %.2f us, max %lu us per block (block %lu us, sum %lld)\n", NUM_VOICES,
+           SAMPLE_MAX_STEP >> 16, mean, (unsigned long)worst, (unsigned long)blockUs, (long long)sink);
+}
+
+int main() {
+    static Image image;
+    buildImage(image);
+    checkAttach(image);
+
+    size_t size = 0;
+    const uint8_t* mapped = mapImage(image, size);
+    SampleBank bank;
+    CHECK(mapped != NULL && bank.attach(mapped, size));
+    if (bank.getCount() == 2) {
+        CHECK(strcmp(bank.getInfo(LOOPED).name, "loop") == 0 && bank.getData(LOOPED)[LOOP_START] == LOOP_START);
+
+        checkLoop(bank, 1 << 16);
+        checkLoop(bank, 0x18000);            // 1.5
+        checkLoop(bank, 0x3B6E1);            // 3.714..., odd fraction
+        checkLoop(bank, SAMPLE_MAX_STEP);
+        checkOneShot(bank);
+        checkSteps(bank);
+        checkTiming(bank);
+    }
+    if (mapped != NULL) munmap((void*)mapped, size);
+    return checkResult("check_samples");
+}
@@ -0,0 +1,217 @@
+// check_sequencer.cpp
+
+// Arpeggiator and step sequencer:
+//   1. Jitter: the Sequencer clocked block by block exactly as
+//      Synth::runSequencer clocks it, at tempos whose step is not a whole
+//      number of samples; every note-on must land on the rounded sample an
+//      ideal clock gives it (zero samples of jitter, no drift)
+//   2. Arp patterns: up and down keep cycling through the held notes across
+//      any number of steps, including past the step counter's wrap
+//   3. Mode changes, through the engine: a note played before the arpeggiator
+//      starts is released with the old mode, held keys do not come back the
+//      next time the arpeggiator starts, and outside the arpeggiator a played
+//      note-off ends the played voice but never the sequencer's own
+//
+//     make -C tools/host check
+
+#include <Arduino.h>
+#include "Synth.h"
+#include "EventLog.h"
+#include "Sequencer.h"
+#include "HostCheck.h"
+#include <math.h>
+
+// Defined by ESP32_Synth.ino on the device
+EventLog eventLog;
+
+#define JITTER_STEPS 10000
+
+// -------------------------------------------------------------------
+// --- JITTER ---
+// -------------------------------------------------------------------
+
+// Sample of every note-on over 'steps' steps, clocked like runSequencer():
+// process() at each block start and again at every event inside the block
+static void clockSteps(Sequencer& sequencer, int steps, uint32_t* onsets) {
+    SequencerEvent events[SEQ_MAX_EVENTS];
+    int found = 0;
+    uint32_t blockStart = 0;
+
+    while (found < steps) {
+        int offset = 0;
+        while (offset < DMA_BUF_LEN) {
+            uint32_t now = blockStart + offset;
+            int count = sequencer.process(now, events);
+            for (int i = 0; i < count && found < steps; i++) {
+                if (events[i].noteOn) onsets[found++] = now;
+            }
+            int32_t next = (int32_t)(sequencer.nextEventSample() - blockStart);
+            offset = constrain(next, offset + 1, DMA_BUF_LEN);
+        }
+        blockStart += DMA_BUF_LEN;
+    }
+}
+
+static void checkJitter() {
+    static uint32_t onsets[JITTER_STEPS];
+    const float TEMPOS[] = { 120.0f, 97.3f, 133.33f, 300.0f, 20.0f };
+
+    for (float tempo : TEMPOS) {
+        Sequencer sequencer;
+        sequencer.setTempo(tempo, I2S_SAMPLE_RATE);
+        SequencerEvent events[SEQ_MAX_EVENTS];
+        sequencer.setMode(SEQ_ARP, 0, events);
+        sequencer.holdNote(60, 100);
+
+        int steps = (tempo < 60.0f) ? JITTER_STEPS / 10 : JITTER_STEPS;
+        clockSteps(sequencer, steps, onsets);
+
+        // Ideal step k starts at k * samples-per-step, rounded to the sample
+        double samplesPerStep = I2S_SAMPLE_RATE * 60.0 / (tempo * SEQ_STEPS_PER_BEAT);
+        int worst = 0;
+        for (int k = 0; k < steps; k++) {
+            int error = abs((int)(onsets[k] - (uint32_t)llround(k * samplesPerStep)));
+            if (error > worst) worst = error;
+        }
+        CHECK(worst == 0);
+        printf("  %6.2f BPM (%.3f samples/step): max jitter %d samples over %d steps\n", tempo, samplesPerStep,
+               worst, steps);
+    }
+}
+
+// -------------------------------------------------------------------
+// --- ARP PATTERNS ---
+// -------------------------------------------------------------------
+
+static void checkPattern(ArpMode arpMode, const uint8_t* held, int heldCount) {
+    Sequencer sequencer;
+    sequencer.setTempo(120.0f, I2S_SAMPLE_RATE);
+    sequencer.arpMode = arpMode;
+    SequencerEvent events[SEQ_MAX_EVENTS];
+    sequencer.setMode(SEQ_ARP, 0, events);
+    for (int i = 0; i < heldCount; i++) sequencer.holdNote(held[i], 100);
+
+    // held[] is ascending: up walks it forwards, down backwards
+    int played = 0;
+    bool inOrder = true;
+    for (uint32_t now = 0; played < 5 * ARP_MAX_NOTES; now++) {
+        int count = sequencer.process(now, events);
+        for (int i = 0; i < count; i++) {
+            if (!events[i].noteOn) continue;
+            int position = played % heldCount;
+            uint8_t expected = (arpMode == ARP_UP) ? held[position] : held[heldCount - 1 - position];
+            inOrder &= (events[i].note == expected);
+            played++;
+        }
+    }
+    CHECK(inOrder);
+}
+
+static void checkPatterns() {
+    const uint8_t TRIAD[] = { 60, 64, 67 };
+    const uint8_t FIVE[] = { 48, 55, 60, 62, 67 };
+    checkPattern(ARP_UP, TRIAD, 3);
+    checkPattern(ARP_DOWN, TRIAD, 3);
+    checkPattern(ARP_UP, FIVE, 5);
+    checkPattern(ARP_DOWN, FIVE, 5);
+
+    // A note released mid-pattern: the walk carries on from where it was
+    Sequencer sequencer;
+    sequencer.setTempo(120.0f, I2S_SAMPLE_RATE);
+    SequencerEvent events[SEQ_MAX_EVENTS];
+    sequencer.setMode(SEQ_ARP, 0, events);
+    for (uint8_t note : TRIAD) sequencer.holdNote(note, 100);
+
+    uint8_t notes[8];
+    int played = 0;
+    for (uint32_t now = 0; played < 8; now++) {
+        if (played == 2) sequencer.releaseNote(67);
+        int count = sequencer.process(now, events);
+        for (int i = 0; i < count; i++) {
+            if (events[i].noteOn) notes[played++] = events[i].note;
+        }
+    }
+    const uint8_t EXPECTED[8] = { 60, 64, 60, 64, 60, 64, 60, 64 };
+    CHECK(memcmp(notes, EXPECTED, sizeof(EXPECTED)) == 0);
+}
+
+// -------------------------------------------------------------------
+// --- MODE CHANGES (ENGINE) ---
+// -------------------------------------------------------------------
+
+static void setParam(ParamId id, float value) {
+    ParamUpdate update = { (uint8_t)id, value };
+    CHECK(synth.applyParams(&update, 1));
+    synth.renderNextBlock();
+}
+
+static const Voice* findVoice(int note, bool sequenced) {
+    for (int v = 0; v < NUM_VOICES; v++) {
+        const Voice& voice = synth.voices[v];
+        Envelope::State state = voice.envelope.getState();
+        if (voice.note == note && voice.sequenced == sequenced && state != Envelope::IDLE && state != Envelope::RELEASE) {
+            return &voice;
+        }
+    }
+    return NULL;
+}
+
+static void renderSteps(int steps) {
+    int blocks = steps * (int)(I2S_SAMPLE_RATE * 60.0 / (120.0 * SEQ_STEPS_PER_BEAT)) / DMA_BUF_LEN + 1;
+    for (int b = 0; b < blocks; b++) synth.renderNextBlock();
+}
+
+static void checkModeChanges() {
+    setParam(PARAM_SEQ_TEMPO, 120.0f);
+    setParam(PARAM_SEQ_GATE, 100.0f);
+    setParam(PARAM_ARP_MODE, ARP_UP);
+
+    // Held before the arpeggiator starts: released by the mode change, and
+    // not in the arpeggiator's list either
+    synth.noteOn(60, 100, micros());
+    synth.renderNextBlock();
+    CHECK(findVoice(60, false) != NULL);
+    setParam(PARAM_SEQ_MODE, SEQ_ARP);
+    CHECK(findVoice(60, false) == NULL);
+    renderSteps(4);
+    CHECK(findVoice(60, true) == NULL);
+
+    // Its note-off, arriving while the arpeggiator runs, changes nothing
+    synth.noteOff(60, micros());
+    synth.noteOn(64, 100, micros());
+    renderSteps(1);
+    CHECK(findVoice(64, true) != NULL);
+
+    // Arp off with the key still down: the sequencer's voice ends, and the
+    // key is not replayed when the arpeggiator comes back
+    setParam(PARAM_SEQ_MODE, SEQ_OFF);
+    CHECK(findVoice(64, true) == NULL);
+    setParam(PARAM_SEQ_MODE, SEQ_ARP);
+    renderSteps(4);
+    CHECK(findVoice(64, true) == NULL);
+    synth.noteOff(64, micros());
+
+    // Step mode: a played note-off ends the played voice, but not the
+    // sequencer's voice on the same note
+    setParam(PARAM_SEQ_MODE, SEQ_STEP);
+    synth.noteOn(62, 100, micros());
+    synth.renderNextBlock();
+    CHECK(findVoice(60, true) != NULL && findVoice(62, false) != NULL);
+    synth.noteOff(62, micros());
+    synth.noteOff(60, micros());
+    synth.renderNextBlock();
+    CHECK(findVoice(60, true) != NULL && findVoice(62, false) == NULL);
+
+    setParam(PARAM_SEQ_MODE, SEQ_OFF);
+    synth.controlChange(120, 0, micros());
+    synth.renderNextBlock();
+}
+
+int main() {
+    synth.begin();
+
+    checkJitter();
+    checkPatterns();
+    checkModeChanges();
+    return checkResult("check_sequencer");
+}
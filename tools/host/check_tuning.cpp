@@ -0,0 +1,134 @@
+// check_tuning.cpp
+
+// Scala parsing and table building (Tuning.h), with no engine involved:
+//   1. .scl: cents and ratio lines, '!' comments anywhere, CRLF line ends,
+//      labels after a pitch; a missing or bad degree count, missing degrees
+//      and a period at the tonic are refused
+//   2. .kbm: 'x' keys unmapped, a reference note outside 0..127 refused
+//   3. The table built from both matches frequencies worked out by hand,
+//      with unmapped keys and keys outside first..last at 0 Hz; a reference
+//      on an unmapped key is refused
+//
+//     make -C tools/host check
+
+#include <Arduino.h>
+#include "Synth.h"
+#include "EventLog.h"
+#include "Tuning.h"
+#include "HostCheck.h"
+#include <math.h>
+
+// Defined by ESP32_Synth.ino on the device
+EventLog eventLog;
+
+// Five degrees over a 7-key pattern: whole tone, 5/4, 3/2, 7/4, octave
+static const char SCL[] =
+    "! pentatonic.scl\r\n"
+    "!\r\n"
+    "Just pentatonic\r\n"
+    " 5\r\n"
+    "!\r\n"
+    " 200.0\r\n"
+    " 5/4 major third\r\n"
+    "! the fifth\r\n"
+    " 3/2\r\n"
+    "\t7/4\r\n"
+    " 2\r\n";
+
+static const char KBM[] =
+    "! pentatonic.kbm\r\n"
+    "7\r\n"      // map size
+    "21\r\n"     // first note
+    "108\r\n"    // last note
+    "60\r\n"     // middle note: degree 0
+    "69\r\n"     // reference note
+    "440.0\r\n"  // reference frequency
+    "5\r\n"      // octave degree
+    "! mapping\r\n"
+    "0\r\nx\r\n1\r\n2\r\nX\r\n3\r\n4\r\n";
+
+static bool near(double value, double expected) {
+    return fabs(value - expected) <= expected * 1e-9;
+}
+
+static void checkScl(ScaleDefinition& scale) {
+    CHECK(parseScl(SCL, scale));
+    CHECK(strcmp(scale.description, "Just pentatonic") == 0);
+    CHECK(scale.count == 5);
+    CHECK(near(scale.cents[0], 200.0));
+    CHECK(near(scale.cents[1], 1200.0 * log2(5.0 / 4.0)));
+    CHECK(near(scale.cents[2], 1200.0 * log2(3.0 / 2.0)));
+    CHECK(near(scale.cents[3], 1200.0 * log2(7.0 / 4.0)));
+    CHECK(near(scale.cents[4], 1200.0));
+
+    // Same scale with LF line ends parses the same
+    ScaleDefinition lf;
+    CHECK(parseScl("Just pentatonic\n5\n200.0\n5/4\n3/2\n7/4\n2\n", lf));
+    CHECK(memcmp(lf.cents, scale.cents, sizeof(double) * 5) == 0);
+
+    ScaleDefinition bad;
+    const char* REFUSED[] = {
+        "",                                  // no description
+        "No count\r\n",                      // degree count missing
+        "! only comments\r\nNo count\r\n!\r\n",
+        "Bad count\r\nfive\r\n100.0\r\n",
+        "Zero count\r\n0\r\n",
+        "Short\r\n3\r\n100.0\r\n200.0\r\n",  // fewer degrees than counted
+        "Bad ratio\r\n1\r\n3/0\r\n",
+        "Period at the tonic\r\n1\r\n0.0\r\n",
+    };
+    for (const char* text : REFUSED) CHECK(!parseScl(text, bad));
+}
+
+static void checkKbm(KeyboardMapping& mapping) {
+    CHECK(parseKbm(KBM, mapping));
+    CHECK(mapping.mapSize == 7 && mapping.firstNote == 21 && mapping.lastNote == 108);
+    CHECK(mapping.middleNote == 60 && mapping.referenceNote == 69 && mapping.referenceFrequency == 440.0);
+    CHECK(mapping.octaveDegree == 5);
+    const int16_t MAP[7] = { 0, -1, 1, 2, -1, 3, 4 };
+    CHECK(memcmp(mapping.map, MAP, sizeof(MAP)) == 0);
+
+    KeyboardMapping bad;
+    CHECK(!parseKbm("0\r\n0\r\n127\r\n60\r\n128\r\n440.0\r\n12\r\n", bad));   // reference note
+    CHECK(!parseKbm("0\r\n0\r\n127\r\n60\r\n-1\r\n440.0\r\n12\r\n", bad));
+    CHECK(!parseKbm("2\r\n0\r\n127\r\n60\r\n69\r\n440.0\r\n12\r\n0\r\n", bad)); // one key short
+    CHECK(!parseKbm("1\r\n0\r\n127\r\n60\r\n69\r\n440.0\r\n12\r\ny\r\n", bad));
+    CHECK(!parseKbm("0\r\n0\r\n127\r\n60\r\n69\r\n0\r\n12\r\n", bad));        // 0 Hz reference
+}
+
+static void checkTable(const ScaleDefinition& scale, const KeyboardMapping& mapping) {
+    static double frequencies[TUNING_NUM_NOTES];
+    CHECK(buildTuningTable(scale, mapping, frequencies));
+
+    // Note 69 is degree 6 (one period + the whole tone): 440 Hz by definition
+    const struct { int note; double hz; } EXPECTED[] = {
+        { 21, 3.828080430 }, { 48, 55.0 }, { 60, 195.997717991 }, { 62, 220.0 }, { 63, 244.997147489 },
+        { 65, 293.996576986 }, { 66, 342.996006484 }, { 69, 440.0 }, { 72, 587.993153973 },
+        { 108, 21951.744414978 },
+    };
+    for (const auto& expected : EXPECTED) {
+        CHECK(fabs(frequencies[expected.note] - expected.hz) < 1e-6);
+    }
+
+    // 'x' keys in every period, and keys outside first..last, are silent
+    const int SILENT[] = { 20, 61, 64, 68, 71, 109, 127 };
+    for (int note : SILENT) CHECK(frequencies[note] == 0.0);
+
+    // A reference note on an unmapped key has no frequency to anchor to
+    KeyboardMapping unmapped = mapping;
+    unmapped.referenceNote = 61;
+    CHECK(!buildTuningTable(scale, unmapped, frequencies));
+
+    printf("  %s: note 60 %.6f Hz, 69 %.6f Hz, 72 %.6f Hz\n", scale.description, frequencies[60],
+           frequencies[69], frequencies[72]);
+}
+
+int main() {
+    static ScaleDefinition scale;
+    static KeyboardMapping mapping;
+
+    checkScl(scale);
+    checkKbm(mapping);
+    checkTable(scale, mapping);
+    return checkResult("check_tuning");
+}
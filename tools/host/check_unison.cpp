@@ -0,0 +1,104 @@
+// check_unison.cpp
+
+// Headroom of the voice's gain stages with a full unison stack:
+//   8 copies of a square or saw, started in phase, sum to ~2.83x full scale
+//   before osc1 gain, pan and velocity are applied. At full gain, centre pan
+//   and velocity 127 the voice output must be the single-copy output scaled
+//   by sqrt(8), sample for sample: no stage may wrap.
+//
+//     make -C tools/host check
+
+#include <Arduino.h>
+#include "Synth.h"
+#include "EventLog.h"
+#include "HostCheck.h"
+#include <math.h>
+
+// Defined by ESP32_Synth.ino on the device
+EventLog eventLog;
+
+#define NOTE 45
+#define SETTLE_BLOCKS 20
+#define COMPARE_BLOCKS 8
+
+static void setParam(ParamId id, float value) {
+    ParamUpdate update = { (uint8_t)id, value };
+    CHECK(synth.applyParams(&update, 1));
+    synth.renderNextBlock();
+}
+
+static Voice* findVoice(int note) {
+    for (int v = 0; v < NUM_VOICES; v++) {
+        if (synth.voices[v].note == note && synth.voices[v].envelope.getState() != Envelope::IDLE) {
+            return &synth.voices[v];
+        }
+    }
+    return NULL;
+}
+
+// Left output of one voice for COMPARE_BLOCKS blocks, every copy started at phase 0
+static void renderStack(WaveType wave, int copies, int32_t* out) {
+    setParam(PARAM_OSC1_WAVE, wave);
+    setParam(PARAM_UNISON_VOICES, copies);
+    synth.noteOn(NOTE, 127, micros());
+    synth.renderNextBlock();
+
+    Voice* voice = findVoice(NOTE);
+    CHECK(voice != NULL);
+    if (voice == NULL) return;
+
+    VoiceState state = voice->saveState();
+    memset(state.osc1.phase, 0, sizeof(state.osc1.phase));
+    voice->restoreState(state);
+    for (int b = 0; b < SETTLE_BLOCKS; b++) synth.renderNextBlock();
+
+    // The same voice rendered on its own, past the attack at sustain 1.0
+    for (int b = 0; b < COMPARE_BLOCKS; b++) {
+        int32_t mixR[DMA_BUF_LEN] = {0};
+        memset(out + b * DMA_BUF_LEN, 0, DMA_BUF_LEN * sizeof(int32_t));
+        voice->renderBlock(out + b * DMA_BUF_LEN, mixR, DMA_BUF_LEN);
+    }
+
+    synth.noteOff(NOTE, micros());
+    synth.controlChange(120, 0, micros());
+    while (synth.renderNextBlock() > 0) {}
+}
+
+static void checkStack(WaveType wave) {
+    static int32_t single[COMPARE_BLOCKS * DMA_BUF_LEN];
+    static int32_t stacked[COMPARE_BLOCKS * DMA_BUF_LEN];
+    renderStack(wave, 1, single);
+    renderStack(wave, MAX_UNISON, stacked);
+
+    const double scale = sqrt((double)MAX_UNISON);
+    int32_t peak = 0;
+    double worst = 0.0;
+    for (int i = 0; i < COMPARE_BLOCKS * DMA_BUF_LEN; i++) {
+        double error = fabs(stacked[i] - single[i] * scale);
+        if (error > worst) worst = error;
+        peak = max(peak, abs(stacked[i]));
+    }
+    // Rounding of the per-copy gains only; a wrap is off by 2^32 >> 15
+    CHECK(worst <= 0.01 * 32767);
+    CHECK(peak > 32767);
+    printf("  %-8s x%d: peak %ld (%.2fx full scale), max error %.0f against x1 * sqrt(%d)\n", WAVE_NAMES[wave],
+           MAX_UNISON, (long)peak, peak / 32767.0, worst, MAX_UNISON);
+}
+
+int main() {
+    synth.begin();
+    synth.setADSR(0.001, 0.001, 1.0, 0.001);
+    setParam(PARAM_OSC1_GAIN, 1.0f);
+    setParam(PARAM_OSC2_ENABLED, 0);
+    setParam(PARAM_UNISON_DETUNE, 0.0f);
+    setParam(PARAM_STEREO_SPREAD, 0.0f);
+
+    // A routed (idle) pan slot puts the pan stage in the signal path too
+    setParam(PARAM_MOD_SOURCE, MOD_SRC_MODWHEEL);
+    setParam(PARAM_MOD_DEST, MOD_DST_PAN);
+    setParam(PARAM_MOD_DEPTH, 1.0f);
+
+    checkStack(SQUARE);
+    checkStack(SAW);
+    return checkResult("check_unison");
+}
@@ -0,0 +1,142 @@
+// check_websocket.cpp
+
+// The Web UI's WebSocket channel against host stand-ins of the WebServer and
+// WebSocketsServer (tools/host/stubs), with UI.h compiled exactly as the
+// sketch includes it:
+//   - a client gets the current status on connect
+//   - status is pushed once per change, never while nothing changes
+//   - a binary parameter frame is applied as one batch at the next block
+//   - a bad frame is answered with an error and applies nothing
+//   - the /status and /params HTTP fallbacks agree with the WebSocket path
+//
+//     make -C tools/host check
+
+#include <Arduino.h>
+#include "Synth.h"
+#include "UI.h"
+#include "HostCheck.h"
+
+// Defined by ESP32_Synth.ino on the device
+Control synthControl;
+OscServer oscServer;
+PresetBank presetBank;
+FootprintMonitor footprint;
+EventLog eventLog;
+
+#define CLIENT 3
+
+static size_t buildFrame(uint8_t* frame, const ParamUpdate* updates, int count) {
+    size_t length = 0;
+    frame[length++] = PARAM_FRAME_MAGIC;
+    frame[length++] = (uint8_t)count;
+    for (int i = 0; i < count; i++) {
+        frame[length++] = updates[i].id;
+        memcpy(&frame[length], &updates[i].value, sizeof(float));  // little-endian host, as the ESP32
+        length += sizeof(float);
+    }
+    return length;
+}
+
+static const std::string& lastFrame() {
+    static const std::string none;
+    return webSocket.sent.empty() ? none : webSocket.sent.back().text;
+}
+
+static void checkConnect() {
+    webSocket.clientEvent(CLIENT, WStype_CONNECTED);
+    CHECK(webSocket.sent.size() == 1);
+    CHECK(webSocket.sent.back().client == CLIENT);
+    CHECK(lastFrame() == "{\"note\": \"None\"}");
+}
+
+static void checkPushOnChange() {
+    // The first pass publishes the initial status, then nothing changes and
+    // nothing more is pushed
+    size_t before = webSocket.sent.size();
+    for (int i = 0; i < 1000; i++) uiLoop();
+    CHECK(webSocket.sent.size() == before + 1);
+    CHECK(webSocket.sent.back().client == WEBSOCKETS_BROADCAST);
+    before = webSocket.sent.size();
+
+    // One MIDI note: exactly one broadcast, however often the loop runs
+    synth.noteOn(64, 100, micros());
+    synth.renderNextBlock();
+    for (int i = 0; i < 1000; i++) uiLoop();
+    CHECK(webSocket.sent.size() == before + 1);
+    CHECK(webSocket.sent.back().client == WEBSOCKETS_BROADCAST);
+    CHECK(lastFrame() == "{\"note\": \"MIDI (E4)\"}");
+
+    // A key on the keypad reports its key
+    synth.setKeyBitmap(1 << 2);
+    synth.renderNextBlock();
+    uiLoop();
+    CHECK(webSocket.sent.size() == before + 2);
+    char expected[48];
+    snprintf(expected, sizeof(expected), "{\"note\": \"K3 (%s%d)\"}", NOTE_NAMES[synth.currentScale[2] % 12],
+             synth.currentScale[2] / 12 - 1);
+    CHECK(lastFrame() == expected);
+
+    // The polled endpoint serves the same JSON
+    CHECK(server.request(HTTP_GET, "/status") == 200);
+    CHECK(server.responseBody == expected);
+
+    synth.setKeyBitmap(0);
+    synth.renderNextBlock();
+}
+
+static void checkParamFrames() {
+    const ParamUpdate updates[] = { { PARAM_ATTACK, 0.25f }, { PARAM_UNISON_VOICES, 4.0f }, { PARAM_FM_RATIO, 3.0f } };
+    uint8_t frame[MAX_PARAM_FRAME_SIZE];
+    size_t length = buildFrame(frame, updates, 3);
+
+    size_t before = webSocket.sent.size();
+    webSocket.clientEvent(CLIENT, WStype_BIN, frame, length);
+    CHECK(webSocket.sent.size() == before);  // no reply on success
+
+    // Staged, then applied together at the block boundary
+    CHECK(synth.attackTime != 0.25);
+    synth.renderNextBlock();
+    CHECK(synth.attackTime == 0.25);
+    CHECK(synth.unisonVoices == 4 && synth.unisonCoefficients.count == 4);
+    CHECK(synth.fmRatio == 3.0);
+
+    // One entry out of range: the whole frame is refused
+    const ParamUpdate bad[] = { { PARAM_ATTACK, 0.5f }, { PARAM_SUSTAIN, 2.0f } };
+    length = buildFrame(frame, bad, 2);
+    webSocket.clientEvent(CLIENT, WStype_BIN, frame, length);
+    synth.renderNextBlock();
+    CHECK(webSocket.sent.size() == before + 1 && webSocket.sent.back().client == CLIENT);
+    CHECK(lastFrame() == "{\"error\": \"Invalid Frame\"}");
+    CHECK(synth.attackTime == 0.25);
+
+    // Truncated frame
+    length = buildFrame(frame, updates, 3);
+    webSocket.clientEvent(CLIENT, WStype_BIN, frame, length - 1);
+    CHECK(webSocket.sent.size() == before + 2);
+
+    // HTTP fallback: the same frame, hex-encoded
+    const ParamUpdate release[] = { { PARAM_RELEASE, 1.5f } };
+    length = buildFrame(frame, release, 1);
+    char hex[2 * MAX_PARAM_FRAME_SIZE + 1];
+    for (size_t i = 0; i < length; i++) snprintf(&hex[2 * i], 3, "%02x", frame[i]);
+    CHECK(server.request(HTTP_POST, "/params", { { "plain", hex } }) == 200);
+    synth.renderNextBlock();
+    CHECK(synth.releaseTime == 1.5);
+}
+
+static void checkDisconnect() {
+    webSocket.clientEvent(CLIENT, WStype_DISCONNECTED);
+    CHECK(webSocket.connectedClients() == 0);
+    CHECK(!webSocket.sendTXT(CLIENT, "{}"));
+}
+
+int main() {
+    synth.begin();
+    uiSetup();
+
+    checkConnect();
+    checkPushOnChange();
+    checkParamFrames();
+    checkDisconnect();
+    return checkResult("check_websocket");
+}
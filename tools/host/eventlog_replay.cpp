@@ -0,0 +1,92 @@
+// eventlog_replay.cpp
+
+// Replays an event log downloaded from /eventlog/download through the host
+// build of the engine: the same snapshots, entries and output CRCs the
+// device checks, with per-block render times on this machine.
+//
+//     make -C tools/host
+//     tools/host/build/eventlog_replay eventlog.bin [timings.bin]
+//
+// The optional second file gets the block timings in the /eventlog/timings
+// format (uint16 us per block), for tools/eventlog.py --timings. Exits 0
+// when every segment replayed bit-identical.
+
+#include <Arduino.h>
+#include "Synth.h"
+#include "EventLog.h"
+
+// Defined by ESP32_Synth.ino on the device
+EventLog eventLog;
+
+static bool load(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "error: cannot open %s\n", path);
+        return false;
+    }
+
+    // Through the upload path, so the file is checked exactly as the device checks it
+    bool ok = eventLog.beginUpload();
+    uint8_t chunk[1024];
+    size_t length;
+    while (ok && (length = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        ok = eventLog.writeUpload(chunk, length);
+    }
+    fclose(file);
+
+    if (!ok || !eventLog.endUpload()) {
+        fprintf(stderr, "error: %s is not an event log of this firmware (version %d, %u bytes)\n", path,
+                EVENT_LOG_VERSION, (unsigned)sizeof(EventLogData));
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "usage: %s eventlog.bin [timings.bin]\n", argv[0]);
+        return 2;
+    }
+
+    synth.begin();
+    if (!load(argv[1])) return 2;
+    if (!eventLog.startReplay()) {
+        fprintf(stderr, "error: replay refused\n");
+        return 2;
+    }
+
+    // One block past the log: the block that ends the replay renders live
+    uint32_t limit = eventLog.data.header.blockCount + 1;
+    for (uint32_t b = 0; b < limit && !eventLog.isIdle(); b++) {
+        synth.renderNextBlock();
+    }
+
+    const EventLogHeader& h = eventLog.data.header;
+    const uint32_t blockUs = DMA_BUF_LEN * 1000000 / I2S_SAMPLE_RATE;
+    printf("%lu blocks (%.2f s) from sample %lu: %d/%d segments matched%s\n", (unsigned long)eventLog.replayBlocks,
+           eventLog.replayBlocks * (double)DMA_BUF_LEN / I2S_SAMPLE_RATE, (unsigned long)eventLog.segment(0).sample,
+           eventLog.segmentsMatched, h.segmentCount, eventLog.replayMatched ? ", bit-identical" : "");
+    if (eventLog.firstMismatch >= 0) {
+        printf("first mismatch in segment %d, at sample %lu\n", eventLog.firstMismatch,
+               (unsigned long)eventLog.segment(eventLog.firstMismatch).sample);
+    }
+    printf("block render: max %lu us (block %lu), mean %.2f us (one block plays in %lu us)\n",
+           (unsigned long)eventLog.maxBlockMicros, (unsigned long)eventLog.worstBlock,
+           eventLog.replayBlocks ? (double)eventLog.totalBlockMicros / eventLog.replayBlocks : 0.0,
+           (unsigned long)blockUs);
+
+    char json[512];
+    if (eventLog.format(json, sizeof(json)) >= 0) printf("%s\n", json);
+
+    if (argc == 3) {
+        FILE* file = fopen(argv[2], "wb");
+        if (!file) {
+            fprintf(stderr, "error: cannot write %s\n", argv[2]);
+            return 2;
+        }
+        uint32_t blocks = min(eventLog.replayBlocks, (uint32_t)EVENT_LOG_TIMING_BLOCKS);
+        fwrite(eventLog.blockMicros, sizeof(uint16_t), blocks, file);
+        fclose(file);
+    }
+    return eventLog.replayMatched ? 0 : 1;
+}
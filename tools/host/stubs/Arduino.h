@@ -0,0 +1,102 @@
+// arduino.h (host)
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Just enough of the Arduino-ESP32 core to build the engine sources on Linux.
+// Timing comes from the host's monotonic clock, Serial prints to stdout.
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+#include "freertos/FreeRTOS.h"
+
+#define PI 3.1415926535897932384626433832795
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define SERIAL_8N1 0x800001c
+#define PROGMEM
+
+using std::max;
+using std::min;
+
+template <class T, class L, class H>
+auto constrain(T x, L low, H high) -> decltype(x + low + high) {
+    return x < low ? low : (x > high ? high : x);
+}
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+// --- String ---
+class String {
+private:
+    std::string text;
+
+public:
+    String() {}
+    String(const char* s) : text(s ? s : "") {}
+    String(const std::string& s) : text(s) {}
+    explicit String(int value) : text(std::to_string(value)) {}
+
+    const char* c_str() const { return text.c_str(); }
+    unsigned int length() const { return (unsigned int)text.size(); }
+    long toInt() const { return strtol(text.c_str(), NULL, 10); }
+    float toFloat() const { return strtof(text.c_str(), NULL); }
+    String& operator+=(const String& other) { text += other.text; return *this; }
+    bool operator==(const String& other) const { return text == other.text; }
+    bool operator==(const char* other) const { return text == other; }
+    bool operator!=(const char* other) const { return text != other; }
+};
+
+// --- Serial ---
+// Output goes to stdout. On the host a port reads from a file descriptor
+// attached with attach() (a pty, a pipe), otherwise it never has input.
+class HardwareSerial {
+private:
+    int fd = -1;
+
+public:
+    void begin(unsigned long baud, uint32_t config = SERIAL_8N1, int8_t rxPin = -1, int8_t txPin = -1);
+    void attach(int inputFd) { fd = inputFd; }
+    int available();
+    int read();
+    size_t write(uint8_t byte);
+    size_t write(const uint8_t* buffer, size_t size);
+    int printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+    size_t print(const char* text);
+    size_t println(const char* text = "");
+    operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+extern HardwareSerial Serial2;
+
+// --- ESP ---
+class EspClass {
+public:
+    uint32_t getCycleCount();   // 240 MHz equivalent of the host clock
+    uint32_t getHeapSize();
+    uint32_t getFreeHeap();
+    uint32_t getMinFreeHeap();
+    uint32_t getMaxAllocHeap();
+};
+
+extern EspClass ESP;
+
+#endif
@@ -0,0 +1,62 @@
+// preferences.h (host)
+
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+// NVS stand-in: namespaces live in memory for the life of the process and
+// are shared by every Preferences object, so a second object opened on the
+// same namespace sees what the first wrote, as after a reboot
+#include <Arduino.h>
+#include <map>
+#include <string>
+#include <vector>
+
+class Preferences {
+private:
+    typedef std::map<std::string, std::vector<uint8_t>> Namespace;
+
+    static Namespace& storage(const char* name) {
+        static std::map<std::string, Namespace> flash;
+        return flash[name];
+    }
+
+    Namespace* opened = NULL;
+    Namespace& values() { return opened != NULL ? *opened : storage(""); }
+
+public:
+    bool begin(const char* name, bool = false) {
+        opened = &storage(name);
+        return true;
+    }
+    void end() { opened = NULL; }
+
+    size_t putBytes(const char* key, const void* value, size_t length) {
+        values()[key].assign((const uint8_t*)value, (const uint8_t*)value + length);
+        return length;
+    }
+
+    size_t getBytes(const char* key, void* buffer, size_t length) {
+        auto it = values().find(key);
+        if (it == values().end()) return 0;
+        size_t copied = min(length, it->second.size());
+        memcpy(buffer, it->second.data(), copied);
+        return copied;
+    }
+
+    size_t getBytesLength(const char* key) {
+        auto it = values().find(key);
+        return it == values().end() ? 0 : it->second.size();
+    }
+
+    size_t putChar(const char* key, int8_t value) { return putBytes(key, &value, 1); }
+
+    int8_t getChar(const char* key, int8_t defaultValue = 0) {
+        int8_t value = defaultValue;
+        getBytes(key, &value, 1);
+        return value;
+    }
+
+    bool remove(const char* key) { return values().erase(key) > 0; }
+};
+
+#endif
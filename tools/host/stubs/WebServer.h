@@ -0,0 +1,141 @@
+// webserver.h (host)
+
+#ifndef HOST_WEBSERVER_H
+#define HOST_WEBSERVER_H
+
+// Stand-in for the ESP32 WebServer: no sockets. A check calls request()
+// with a URI and query arguments, the matching handler runs exactly as
+// handleClient() would run it, and the response is kept for inspection.
+#include <Arduino.h>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_POST, HTTP_PUT, HTTP_DELETE };
+enum HTTPUploadStatus { UPLOAD_FILE_START, UPLOAD_FILE_WRITE, UPLOAD_FILE_END, UPLOAD_FILE_ABORTED };
+
+#define HTTP_UPLOAD_BUFLEN 1436
+
+struct HTTPUpload {
+    HTTPUploadStatus status;
+    String filename;
+    size_t totalSize;
+    size_t currentSize;
+    uint8_t buf[HTTP_UPLOAD_BUFLEN];
+};
+
+class WebServer {
+public:
+    typedef std::function<void(void)> THandlerFunction;
+
+private:
+    struct Route {
+        std::string uri;
+        HTTPMethod method;
+        THandlerFunction handler;
+        THandlerFunction uploadHandler;
+    };
+
+    std::vector<Route> routes;
+    std::map<std::string, std::string> args;
+    std::map<std::string, std::string> requestHeaders;
+    HTTPMethod requestMethod = HTTP_GET;
+    HTTPUpload currentUpload;
+
+    const Route* find(HTTPMethod method, const char* uri) const {
+        for (const Route& route : routes) {
+            if (route.uri == uri && (route.method == HTTP_ANY || route.method == method)) return &route;
+        }
+        return NULL;
+    }
+
+public:
+    // Last response
+    int responseCode = 0;
+    std::string responseType;
+    std::string responseBody;
+    std::map<std::string, std::string> responseHeaders;
+
+    explicit WebServer(int) {}
+    void begin() {}
+    void handleClient() {}
+    void collectHeaders(const char**, size_t) {}
+
+    void on(const char* uri, THandlerFunction handler) { on(uri, HTTP_ANY, handler); }
+    void on(const char* uri, HTTPMethod method, THandlerFunction handler) { routes.push_back({ uri, method, handler, NULL }); }
+    void on(const char* uri, HTTPMethod method, THandlerFunction handler, THandlerFunction uploadHandler) {
+        routes.push_back({ uri, method, handler, uploadHandler });
+    }
+
+    // Host stand-in: runs the handler for 'uri' and returns the status code
+    // (404 if nothing is registered). A POST body goes in the "plain" argument.
+    int request(HTTPMethod method, const char* uri, const std::map<std::string, std::string>& query = {},
+                const std::map<std::string, std::string>& headers = {}) {
+        const Route* route = find(method, uri);
+        responseCode = 404;
+        responseType.clear();
+        responseBody.clear();
+        responseHeaders.clear();
+        if (route == NULL) return responseCode;
+
+        args = query;
+        requestHeaders = headers;
+        requestMethod = method;
+        route->handler();
+        return responseCode;
+    }
+
+    // Host stand-in: streams 'data' to the upload handler in HTTP_UPLOAD_BUFLEN
+    // chunks, then runs the request handler
+    int upload(const char* uri, const uint8_t* data, size_t length) {
+        const Route* route = find(HTTP_POST, uri);
+        if (route == NULL || !route->uploadHandler) return 404;
+
+        currentUpload.status = UPLOAD_FILE_START;
+        currentUpload.totalSize = 0;
+        currentUpload.currentSize = 0;
+        route->uploadHandler();
+        for (size_t offset = 0; offset < length; offset += HTTP_UPLOAD_BUFLEN) {
+            currentUpload.status = UPLOAD_FILE_WRITE;
+            currentUpload.currentSize = min(length - offset, (size_t)HTTP_UPLOAD_BUFLEN);
+            memcpy(currentUpload.buf, data + offset, currentUpload.currentSize);
+            currentUpload.totalSize += currentUpload.currentSize;
+            route->uploadHandler();
+        }
+        currentUpload.status = UPLOAD_FILE_END;
+        currentUpload.currentSize = 0;
+        route->uploadHandler();
+        return request(HTTP_POST, uri);
+    }
+
+    // Handler API (the parts of the ESP32 WebServer the sketch uses)
+    String arg(const char* name) {
+        auto it = args.find(name);
+        return it == args.end() ? String() : String(it->second);
+    }
+    bool hasArg(const char* name) { return args.count(name) > 0; }
+    HTTPMethod method() { return requestMethod; }
+    HTTPUpload& upload() { return currentUpload; }
+    String header(const char* name) {
+        auto it = requestHeaders.find(name);
+        return it == requestHeaders.end() ? String() : String(it->second);
+    }
+    bool hasHeader(const char* name) { return requestHeaders.count(name) > 0; }
+    void sendHeader(const char* name, const char* value, bool = false) { responseHeaders[name] = value; }
+
+    void send(int code) { send(code, "", ""); }
+    void send(int code, const char* type, const String& content) { send(code, type, content.c_str()); }
+    void send(int code, const char* type, const char* content) {
+        responseCode = code;
+        responseType = type;
+        responseBody = content;
+    }
+    void send_P(int code, const char* type, const char* content, size_t length) {
+        responseCode = code;
+        responseType = type;
+        responseBody.assign(content, length);
+    }
+};
+
+#endif
@@ -0,0 +1,70 @@
+// websocketsserver.h (host)
+
+#ifndef HOST_WEBSOCKETS_SERVER_H
+#define HOST_WEBSOCKETS_SERVER_H
+
+// Stand-in for the arduinoWebSockets server: no sockets. A check delivers
+// client events with clientEvent(), the sketch's event handler runs exactly
+// as loop() would run it, and every frame the sketch sends is kept in 'sent'.
+#include <Arduino.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+typedef enum {
+    WStype_ERROR, WStype_DISCONNECTED, WStype_CONNECTED, WStype_TEXT, WStype_BIN,
+    WStype_FRAGMENT_TEXT_START, WStype_FRAGMENT_BIN_START, WStype_FRAGMENT, WStype_FRAGMENT_FIN,
+    WStype_PING, WStype_PONG
+} WStype_t;
+
+#define WEBSOCKETS_BROADCAST 0xFF   // 'client' of a broadcast frame in 'sent'
+
+class WebSocketsServer {
+public:
+    typedef std::function<void(uint8_t num, WStype_t type, uint8_t* payload, size_t length)> WebSocketServerEvent;
+
+    struct Frame {
+        uint8_t client;
+        std::string text;
+    };
+
+private:
+    WebSocketServerEvent handler;
+    bool connected[WEBSOCKETS_BROADCAST] = {};
+
+public:
+    std::vector<Frame> sent;
+
+    explicit WebSocketsServer(uint16_t) {}
+    void begin() {}
+    void loop() {}
+    void onEvent(WebSocketServerEvent event) { handler = event; }
+
+    // Host stand-in: a client connects, disconnects or sends a frame
+    void clientEvent(uint8_t client, WStype_t type, const uint8_t* payload = NULL, size_t length = 0) {
+        if (type == WStype_CONNECTED) connected[client] = true;
+        if (type == WStype_DISCONNECTED) connected[client] = false;
+
+        std::vector<uint8_t> copy(payload, payload + length);
+        if (handler) handler(client, type, copy.data(), length);
+    }
+
+    bool sendTXT(uint8_t client, const char* payload, size_t = 0) {
+        if (!connected[client]) return false;
+        sent.push_back({ client, payload });
+        return true;
+    }
+
+    bool broadcastTXT(const char* payload, size_t = 0) {
+        sent.push_back({ WEBSOCKETS_BROADCAST, payload });
+        return true;
+    }
+
+    int connectedClients() {
+        int count = 0;
+        for (bool c : connected) count += c;
+        return count;
+    }
+};
+
+#endif
@@ -0,0 +1,22 @@
+// wifi.h (host)
+
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+// Access point stand-in: nothing is brought up, the AP address is fixed
+#include <Arduino.h>
+
+class IPAddress {
+public:
+    String toString() const { return String("192.168.4.1"); }
+};
+
+class WiFiClass {
+public:
+    bool softAP(const char*, const char* = NULL) { return true; }
+    IPAddress softAPIP() { return IPAddress(); }
+};
+
+extern WiFiClass WiFi;
+
+#endif
@@ -0,0 +1,71 @@
+// wifiudp.h (host)
+
+#ifndef HOST_WIFIUDP_H
+#define HOST_WIFIUDP_H
+
+// UDP over a real, non-blocking POSIX socket bound to every local address,
+// so a check can send datagrams to 127.0.0.1 and the sketch receives them
+// through the same parsePacket() / read() calls as on the ESP32
+#include <Arduino.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+class WiFiUDP {
+private:
+    int fd = -1;
+    bool unread = false;   // parsePacket() returned a datagram not yet read
+
+    void discard() {
+        if (unread) recv(fd, NULL, 0, MSG_DONTWAIT);
+        unread = false;
+    }
+
+public:
+    ~WiFiUDP() { stop(); }
+
+    uint8_t begin(uint16_t port) {
+        stop();
+        fd = socket(AF_INET, SOCK_DGRAM, 0);
+        if (fd < 0) return 0;
+
+        struct sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+        address.sin_port = htons(port);
+        if (bind(fd, (struct sockaddr*)&address, sizeof(address)) != 0) {
+            stop();
+            return 0;
+        }
+        return 1;
+    }
+
+    void stop() {
+        if (fd >= 0) close(fd);
+        fd = -1;
+        unread = false;
+    }
+
+    // Size of the next datagram (0 if none); an unread previous one is dropped
+    int parsePacket() {
+        if (fd < 0) return 0;
+        discard();
+
+        ssize_t size = recv(fd, NULL, 0, MSG_PEEK | MSG_TRUNC | MSG_DONTWAIT);
+        if (size <= 0) return 0;
+        unread = true;
+        return (int)size;
+    }
+
+    // Copies the datagram; bytes past 'length' are lost, as on the ESP32
+    int read(uint8_t* buffer, size_t length) {
+        if (!unread) return 0;
+        unread = false;
+        ssize_t size = recv(fd, buffer, length, MSG_DONTWAIT);
+        return (size > 0) ? (int)size : 0;
+    }
+
+    void flush() { discard(); }
+};
+
+#endif
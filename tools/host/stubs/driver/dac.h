@@ -0,0 +1,12 @@
+// dac.h (host)
+
+#ifndef HOST_DRIVER_DAC_H
+#define HOST_DRIVER_DAC_H
+
+#include "driver/i2s.h"
+
+typedef enum { DAC_CHANNEL_1 = 0, DAC_CHANNEL_2 = 1 } dac_channel_t;
+
+esp_err_t dac_output_enable(dac_channel_t channel);
+
+#endif